@@ -1,6 +1,8 @@
 set(JLT_WITH_MEM_CHECKS 1) # Enable for testing only
 set(JLT_WITH_DEBUG_LOGGING 1) # Force log level to be debug
 set(JLT_WITH_MULTI_WINDOWS 0) # Include support for multiple windows
+set(JLT_WITH_LOCK_PROFILING 0) # Record lock contention statistics
+set(JLT_WITH_AVX2_TESTS 0) # Also build AVX2 variants of the tests (needs an AVX2 CPU to run)
 
 # Paths
 set(JLT_BUILD_DIR ${CMAKE_BINARY_DIR}) # Build path
@@ -0,0 +1,99 @@
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <jolt/algorithms.hpp>
+#include <jolt/parallel-algorithms.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/threadpool.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+
+constexpr size_t N_ITEMS = 4 * 1024 * 1024; // Items processed per benchmark case
+constexpr int N_REPEATS = 5;                // Number of times each case is run
+
+struct Rng {
+    uint64_t m_state = 0x9E3779B97F4A7C15ull;
+
+    uint64_t next() {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+
+        return m_state;
+    }
+};
+
+template<typename F>
+static void run_case(std::string const &name, F &&func) {
+    double best = 1.0e9;
+
+    for(int r = 0; r < N_REPEATS; ++r) {
+        bench::Stopwatch sw;
+        func();
+        best = std::min(best, sw.get_elapsed());
+    }
+
+    bench::report(name, N_ITEMS, best);
+}
+
+int main() {
+    threading::initialize();
+
+    auto &pool = threading::get_default_thread_pool();
+    auto const input = memory::allocate_array<uint64_t>(N_ITEMS);
+    auto const work = memory::allocate_array<uint64_t>(N_ITEMS);
+    auto const floats = memory::allocate_array<float>(N_ITEMS);
+    auto const floats_out = memory::allocate_array<float>(N_ITEMS);
+    auto const key = [](uint64_t const x) { return x; };
+    auto const heavy = [](float const x) { return std::sqrt(x) * std::sin(x) + std::cos(x); };
+    Rng rng;
+    volatile double sink = 0;
+
+    std::cout << "Worker threads: " << pool.get_thread_count() << std::endl;
+
+    for(size_t i = 0; i < N_ITEMS; ++i) {
+        input[i] = rng.next();
+        floats[i] = static_cast<float>(input[i] % 100000);
+    }
+
+    run_case("sort/serial", [&]() {
+        memcpy(work, input, N_ITEMS * sizeof(uint64_t));
+        algorithms::sort(work, N_ITEMS, key);
+    });
+    run_case("sort/parallel", [&]() {
+        memcpy(work, input, N_ITEMS * sizeof(uint64_t));
+        algorithms::parallel_sort(work, N_ITEMS, key);
+    });
+
+    run_case("transform/serial", [&]() {
+        for(size_t i = 0; i < N_ITEMS; ++i) { floats_out[i] = heavy(floats[i]); }
+    });
+    run_case("transform/parallel", [&]() {
+        algorithms::parallel_transform(floats, N_ITEMS, floats_out, heavy);
+    });
+
+    run_case("reduce/serial", [&]() {
+        uint64_t acc = 0;
+
+        for(size_t i = 0; i < N_ITEMS; ++i) { acc += input[i] >> 16; }
+
+        sink = static_cast<double>(acc);
+    });
+    run_case("reduce/parallel", [&]() {
+        sink = static_cast<double>(algorithms::parallel_reduce(
+          input,
+          N_ITEMS,
+          static_cast<uint64_t>(0),
+          [](uint64_t const x) { return x >> 16; },
+          [](uint64_t const a, uint64_t const b) { return a + b; }));
+    });
+
+    memory::free_array(floats_out);
+    memory::free_array(floats);
+    memory::free_array(work);
+    memory::free_array(input);
+
+    return 0;
+}
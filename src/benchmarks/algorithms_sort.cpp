@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <jolt/algorithms.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+
+constexpr size_t N_ITEMS = 1024 * 1024; // Items sorted per benchmark case
+constexpr int N_REPEATS = 5;            // Number of times each case is run
+
+/**
+ * Item shaped like a draw command: sorted by a 64-bit key, with a payload.
+ */
+struct DrawItem {
+    uint64_t m_key;
+    uint32_t m_payload[2];
+};
+
+struct Rng {
+    uint64_t m_state = 0x9E3779B97F4A7C15ull;
+
+    uint64_t next() {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+
+        return m_state;
+    }
+};
+
+enum class Distribution { Random, Sorted, Reversed, FewUnique, OrganPipe, SortedNoise };
+
+constexpr Distribution DISTRIBUTIONS[] = {
+  Distribution::Random,
+  Distribution::Sorted,
+  Distribution::Reversed,
+  Distribution::FewUnique,
+  Distribution::OrganPipe,
+  Distribution::SortedNoise};
+
+static char const *get_distribution_name(Distribution const dist) {
+    switch(dist) {
+        case Distribution::Random:
+            return "random";
+        case Distribution::Sorted:
+            return "sorted";
+        case Distribution::Reversed:
+            return "reversed";
+        case Distribution::FewUnique:
+            return "few-unique";
+        case Distribution::OrganPipe:
+            return "organ-pipe";
+        case Distribution::SortedNoise:
+            return "sorted+1%noise";
+    }
+
+    return "";
+}
+
+static void generate(uint64_t *const keys, size_t const len, Distribution const dist) {
+    Rng rng;
+
+    for(size_t i = 0; i < len; ++i) {
+        switch(dist) {
+            case Distribution::Random:
+                keys[i] = rng.next();
+                break;
+
+            case Distribution::Sorted:
+            case Distribution::SortedNoise:
+                keys[i] = i;
+                break;
+
+            case Distribution::Reversed:
+                keys[i] = len - i;
+                break;
+
+            case Distribution::FewUnique:
+                keys[i] = rng.next() % 16;
+                break;
+
+            case Distribution::OrganPipe:
+                keys[i] = i < len / 2 ? i : len - i;
+                break;
+        }
+    }
+
+    if(dist == Distribution::SortedNoise) {
+        for(size_t i = 0; i < len / 100; ++i) { keys[rng.next() % len] = rng.next() % len; }
+    }
+}
+
+template<typename T, typename F>
+static void run_case(std::string const &name, T const *const input, T *const work, F &&sort_func) {
+    double best = 1.0e9;
+
+    for(int r = 0; r < N_REPEATS; ++r) {
+        memcpy(work, input, N_ITEMS * sizeof(T));
+
+        bench::Stopwatch sw;
+        sort_func(work, N_ITEMS);
+        best = std::min(best, sw.get_elapsed());
+    }
+
+    bench::report(name, N_ITEMS, best);
+}
+
+int main() {
+    threading::initialize();
+
+    auto const keys = memory::allocate_array<uint64_t>(N_ITEMS);
+    auto const u64_input = memory::allocate_array<uint64_t>(N_ITEMS);
+    auto const u64_work = memory::allocate_array<uint64_t>(N_ITEMS);
+    auto const draw_input = memory::allocate_array<DrawItem>(N_ITEMS);
+    auto const draw_work = memory::allocate_array<DrawItem>(N_ITEMS);
+    auto const u64_key = [](uint64_t const x) { return x; };
+    auto const draw_key = [](DrawItem const &x) { return x.m_key; };
+    auto const draw_less = [](DrawItem const &a, DrawItem const &b) { return a.m_key < b.m_key; };
+
+    for(Distribution const dist : DISTRIBUTIONS) {
+        std::string const dist_name = get_distribution_name(dist);
+
+        generate(keys, N_ITEMS, dist);
+
+        for(size_t i = 0; i < N_ITEMS; ++i) {
+            u64_input[i] = keys[i];
+            draw_input[i] = DrawItem{keys[i], {static_cast<uint32_t>(i), 0}};
+        }
+
+        run_case("u64/" + dist_name + "/std::sort", u64_input, u64_work, [](uint64_t *p, size_t n) {
+            std::sort(p, p + n);
+        });
+        run_case("u64/" + dist_name + "/sort", u64_input, u64_work, [&](uint64_t *p, size_t n) {
+            algorithms::sort(p, n, u64_key);
+        });
+        run_case("u64/" + dist_name + "/radix_sort", u64_input, u64_work, [&](uint64_t *p, size_t n) {
+            algorithms::radix_sort(p, n, u64_key);
+        });
+
+        run_case("draw/" + dist_name + "/std::sort", draw_input, draw_work, [&](DrawItem *p, size_t n) {
+            std::sort(p, p + n, draw_less);
+        });
+        run_case("draw/" + dist_name + "/sort", draw_input, draw_work, [&](DrawItem *p, size_t n) {
+            algorithms::sort(p, n, draw_key);
+        });
+        run_case("draw/" + dist_name + "/radix_sort", draw_input, draw_work, [&](DrawItem *p, size_t n) {
+            algorithms::radix_sort(p, n, draw_key);
+        });
+    }
+
+    memory::free_array(draw_work);
+    memory::free_array(draw_input);
+    memory::free_array(u64_work);
+    memory::free_array(u64_input);
+    memory::free_array(keys);
+
+    return 0;
+}
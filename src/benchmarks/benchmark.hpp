@@ -0,0 +1,46 @@
+#ifndef JLT_BENCHMARKS_BENCHMARK_HPP
+#define JLT_BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string_view>
+
+namespace jolt::bench {
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * Wall-clock stopwatch, started upon construction.
+     */
+    class Stopwatch {
+        clock::time_point m_begin;
+
+      public:
+        Stopwatch() : m_begin{clock::now()} {}
+
+        void restart() { m_begin = clock::now(); }
+
+        /**
+         * Return the number of seconds elapsed since construction or the last restart.
+         */
+        [[nodiscard]] double get_elapsed() const {
+            return std::chrono::duration<double>(clock::now() - m_begin).count();
+        }
+    };
+
+    /**
+     * Print a line of benchmark results.
+     *
+     * @param name The name of the benchmark case.
+     * @param n_ops The number of operations performed.
+     * @param seconds The time taken to perform `n_ops` operations.
+     */
+    inline void report(std::string_view name, size_t const n_ops, double const seconds) {
+        std::cout << std::left << std::setw(48) << name << std::right << std::setw(12) << std::fixed
+                  << std::setprecision(3) << seconds * 1000.0 << " ms" << std::setw(14) << std::setprecision(2)
+                  << n_ops / seconds / 1.0e6 << " Mops/s" << std::setw(10) << std::setprecision(2)
+                  << seconds * 1.0e9 / n_ops << " ns/op" << std::endl;
+    }
+} // namespace jolt::bench
+
+#endif /* JLT_BENCHMARKS_BENCHMARK_HPP */
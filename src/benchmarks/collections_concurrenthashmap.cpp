@@ -0,0 +1,132 @@
+#include <atomic>
+#include <string>
+#include <emmintrin.h>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/lockguard.hpp>
+#include <jolt/collections/hashmap.hpp>
+#include <jolt/collections/concurrenthashmap.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+using namespace jolt::threading;
+using namespace jolt::collections;
+
+constexpr size_t N_LOOKUPS = 4 * 1024 * 1024; // Total lookups per benchmark case
+constexpr uint64_t N_KEYS = 4096;             // Keys in the map
+constexpr unsigned MAX_THREADS = 16;
+
+/**
+ * Baseline: a hash map guarded by a single lock.
+ */
+struct LockedHashMap {
+    Lock m_lock;
+    HashMap<uint64_t, uint64_t, hash::Identity> m_map{1024};
+
+    void set_value(uint64_t const key, uint64_t const value) {
+        LockGuard guard{m_lock};
+
+        m_map.set_value(key, value);
+    }
+
+    bool get_value(uint64_t const key, uint64_t &value) {
+        LockGuard guard{m_lock};
+        uint64_t const *const result = m_map.get_value(key);
+
+        if(result) {
+            value = *result;
+        }
+
+        return result;
+    }
+};
+
+using ConcurrentMap = ConcurrentHashMap<uint64_t, uint64_t, hash::Identity>;
+
+template<typename M>
+struct BenchData {
+    M &m_map;
+    size_t m_lookups_per_reader;
+    std::atomic<bool> m_go{false};
+    std::atomic<unsigned> m_n_readers_done{0};
+    std::atomic<uint64_t> m_checksum{0};
+};
+
+template<typename M>
+void reader(void *param) {
+    auto &data = *reinterpret_cast<BenchData<M> *>(param);
+    uint64_t checksum = 0, value = 0;
+
+    while(!data.m_go.load(std::memory_order_acquire)) { _mm_pause(); }
+
+    for(size_t i = 0; i < data.m_lookups_per_reader; ++i) {
+        if(data.m_map.get_value((i * 2654435761u) % N_KEYS, value)) {
+            checksum += value;
+        }
+    }
+
+    data.m_checksum += checksum;
+    ++data.m_n_readers_done;
+}
+
+/**
+ * Keep registering new keys while the readers run, as a loader thread would.
+ */
+template<typename M>
+void writer(void *param) {
+    auto &data = *reinterpret_cast<BenchData<M> *>(param);
+    uint64_t key = N_KEYS;
+
+    while(!data.m_go.load(std::memory_order_acquire)) { _mm_pause(); }
+
+    for(; !data.m_n_readers_done.load(std::memory_order_relaxed); ++key) { data.m_map.set_value(key, key); }
+}
+
+template<typename M>
+void run_case(const char *const name, M &map, unsigned const n_readers, bool const with_writer) {
+    BenchData<M> data{map, N_LOOKUPS / n_readers};
+    Thread *threads[MAX_THREADS + 1];
+    unsigned const n_threads = n_readers + with_writer;
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i] = jltnew(Thread, i < n_readers ? &reader<M> : &writer<M>);
+        threads[i]->start(&data);
+    }
+
+    bench::Stopwatch sw;
+    data.m_go.store(true, std::memory_order_release);
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i]->join();
+        jltfree(threads[i]);
+    }
+
+    bench::report(
+      std::string{name} + " " + std::to_string(n_readers) + "R" + (with_writer ? "+1W" : ""),
+      N_LOOKUPS,
+      sw.get_elapsed());
+}
+
+template<typename M>
+void run_cases(const char *const name, unsigned const max_threads, bool const with_writer) {
+    for(unsigned n = 1; n <= max_threads; n *= 2) {
+        M map;
+
+        for(uint64_t key = 0; key < N_KEYS; ++key) { map.set_value(key, key); }
+
+        run_case(name, map, n, with_writer);
+    }
+}
+
+int main() {
+    threading::initialize();
+
+    unsigned const max_threads = min(max(get_available_processor_count() - 1, 1u), MAX_THREADS);
+
+    run_cases<ConcurrentMap>("ConcurrentHashMap", max_threads, false);
+    run_cases<LockedHashMap>("Lock+HashMap", max_threads, false);
+    run_cases<ConcurrentMap>("ConcurrentHashMap", max_threads, true);
+    run_cases<LockedHashMap>("Lock+HashMap", max_threads, true);
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <string>
+#include <emmintrin.h>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/lockguard.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/spscqueue.hpp>
+#include <jolt/collections/mpmcqueue.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+using namespace jolt::threading;
+using namespace jolt::collections;
+
+constexpr size_t N_ITEMS = 4 * 1024 * 1024; // Total items transferred per benchmark case
+constexpr size_t QUEUE_CAPACITY = 1024;
+constexpr unsigned MAX_THREADS_PER_SIDE = 8;
+
+/**
+ * Baseline: a vector guarded by a lock, as used for cross-thread handoff before the queues existed.
+ */
+struct LockedVector {
+    Lock m_lock;
+    Vector<uint64_t> m_items = Vector<uint64_t>(QUEUE_CAPACITY);
+
+    bool push(uint64_t const item) {
+        LockGuard guard{m_lock};
+
+        if(m_items.get_length() >= QUEUE_CAPACITY) {
+            return false;
+        }
+
+        m_items.push(item);
+
+        return true;
+    }
+
+    bool pop(uint64_t &item) {
+        LockGuard guard{m_lock};
+
+        if(!m_items.get_length()) {
+            return false;
+        }
+
+        item = m_items.pop();
+
+        return true;
+    }
+};
+
+template<typename Q>
+struct BenchData {
+    Q &m_queue;
+    size_t m_items_per_producer;
+    size_t m_items_per_consumer;
+    std::atomic<bool> m_go{false};
+    std::atomic<uint64_t> m_checksum{0};
+};
+
+template<typename Q>
+void producer(void *param) {
+    auto &data = *reinterpret_cast<BenchData<Q> *>(param);
+
+    while(!data.m_go.load(std::memory_order_acquire)) { _mm_pause(); }
+
+    for(uint64_t i = 1; i <= data.m_items_per_producer; ++i) {
+        while(!data.m_queue.push(i)) { _mm_pause(); }
+    }
+}
+
+template<typename Q>
+void consumer(void *param) {
+    auto &data = *reinterpret_cast<BenchData<Q> *>(param);
+    uint64_t checksum = 0, item;
+
+    while(!data.m_go.load(std::memory_order_acquire)) { _mm_pause(); }
+
+    for(size_t i = 0; i < data.m_items_per_consumer; ++i) {
+        while(!data.m_queue.pop(item)) { _mm_pause(); }
+
+        checksum += item;
+    }
+
+    data.m_checksum += checksum;
+}
+
+template<typename Q>
+void run_case(const char *const name, Q &queue, unsigned const n_producers, unsigned const n_consumers) {
+    BenchData<Q> data{queue, N_ITEMS / n_producers, N_ITEMS / n_consumers};
+    Thread *threads[2 * MAX_THREADS_PER_SIDE];
+    unsigned const n_threads = n_producers + n_consumers;
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i] = jltnew(Thread, i < n_producers ? &producer<Q> : &consumer<Q>);
+        threads[i]->start(&data);
+    }
+
+    bench::Stopwatch sw;
+    data.m_go.store(true, std::memory_order_release);
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i]->join();
+        jltfree(threads[i]);
+    }
+
+    double const elapsed = sw.get_elapsed();
+    uint64_t const per_producer = data.m_items_per_producer;
+
+    if(data.m_checksum.load() != per_producer * (per_producer + 1) / 2 * n_producers) {
+        std::cout << "CHECKSUM MISMATCH ";
+    }
+
+    bench::report(
+      std::string{name} + " " + std::to_string(n_producers) + "P/" + std::to_string(n_consumers) + "C",
+      N_ITEMS,
+      elapsed);
+}
+
+int main() {
+    threading::initialize();
+
+    unsigned const max_side = min(max(get_available_processor_count() / 2, 1u), MAX_THREADS_PER_SIDE);
+
+    {
+        SPSCQueue<uint64_t> q{QUEUE_CAPACITY};
+        run_case("SPSCQueue", q, 1, 1);
+    }
+
+    for(unsigned n = 1; n <= max_side; n *= 2) {
+        MPMCQueue<uint64_t> q{QUEUE_CAPACITY};
+        run_case("MPMCQueue", q, n, n);
+    }
+
+    for(unsigned n = 1; n <= max_side; n *= 2) {
+        LockedVector q;
+        run_case("Lock+Vector", q, n, n);
+    }
+
+    return 0;
+}
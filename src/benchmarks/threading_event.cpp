@@ -0,0 +1,99 @@
+#include <atomic>
+#include <string>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/event.hpp>
+#include <jolt/threading/semaphore.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+using namespace jolt::threading;
+
+constexpr unsigned N_ROUNDS = 20000;
+constexpr unsigned N_SLEEPS = 100;
+constexpr uint64_t SLEEP_NS = 50000;
+
+/**
+ * Adapters giving the primitives the same signal/wait interface.
+ */
+struct EventAdapter {
+    Event m_event{true};
+
+    void signal() { m_event.set(); }
+    void wait() { m_event.wait(); }
+};
+
+struct SemaphoreAdapter {
+    Semaphore m_sem;
+
+    void signal() { m_sem.release(); }
+    void wait() { m_sem.acquire(); }
+};
+
+template<typename S>
+struct PingPong {
+    S m_ping;
+    S m_pong;
+};
+
+template<typename S>
+void ponger(void *param) {
+    auto &data = *reinterpret_cast<PingPong<S> *>(param);
+
+    for(unsigned i = 0; i < N_ROUNDS; ++i) {
+        data.m_ping.wait();
+        data.m_pong.signal();
+    }
+}
+
+/**
+ * Measure the round trip of a signal to another thread and back.
+ */
+template<typename S>
+void run_ping_pong(const char *const name) {
+    auto &data = *jltnew(PingPong<S>);
+    Thread thread{&ponger<S>};
+
+    thread.start(&data);
+
+    bench::Stopwatch sw;
+
+    for(unsigned i = 0; i < N_ROUNDS; ++i) {
+        data.m_ping.signal();
+        data.m_pong.wait();
+    }
+
+    double const elapsed = sw.get_elapsed();
+
+    thread.join();
+    bench::report(std::string{name} + " round trip", N_ROUNDS, elapsed);
+
+    jltfree(&data);
+}
+
+/**
+ * Measure how long a request to sleep for `SLEEP_NS` actually takes.
+ */
+void run_sleep() {
+    bench::Stopwatch sw;
+
+    for(unsigned i = 0; i < N_SLEEPS; ++i) { sleep_for(SLEEP_NS); }
+
+    bench::report("sleep_for " + std::to_string(SLEEP_NS / 1000) + "us", N_SLEEPS, sw.get_elapsed());
+
+    sw.restart();
+
+    for(unsigned i = 0; i < N_SLEEPS; ++i) { jolt::threading::sleep(1); }
+
+    bench::report("sleep 1ms", N_SLEEPS, sw.get_elapsed());
+}
+
+int main() {
+    threading::initialize();
+
+    run_ping_pong<EventAdapter>("Event");
+    run_ping_pong<SemaphoreAdapter>("Semaphore");
+    run_sleep();
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <atomic>
+#include <string>
+#include <emmintrin.h>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/threadpool.hpp>
+#include <jolt/threading/jobsystem.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+using namespace jolt::threading;
+
+constexpr size_t N_JOBS = 1024 * 1024; // Total jobs run per benchmark case
+constexpr size_t BATCH_LENGTH = 4096;  // Jobs submitted before waiting for completion
+constexpr size_t FAN_OUT = 64;         // Children submitted by each parent job in the nested case
+
+struct NestedData {
+    JobSystem *m_system;
+    JobCounter *m_counter;
+};
+
+void empty_job(void *) {}
+
+void counted_job(void *param) { reinterpret_cast<std::atomic<size_t> *>(param)->fetch_sub(1); }
+
+void parent_job(void *param) {
+    auto &data = *reinterpret_cast<NestedData *>(param);
+
+    for(size_t i = 0; i < FAN_OUT; ++i) { data.m_system->run(&empty_job, nullptr, data.m_counter); }
+}
+
+/**
+ * Baseline: the same empty jobs submitted to the shared-queue thread pool.
+ */
+void run_thread_pool_case(unsigned const n_threads) {
+    ThreadPool pool{n_threads};
+    std::atomic<size_t> n_pending{0};
+
+    bench::Stopwatch sw;
+
+    for(size_t batch = 0; batch < N_JOBS; batch += BATCH_LENGTH) {
+        n_pending.store(BATCH_LENGTH, std::memory_order_relaxed);
+
+        for(size_t i = 0; i < BATCH_LENGTH; ++i) { pool.submit(&counted_job, &n_pending); }
+
+        while(n_pending.load(std::memory_order_acquire)) {
+            if(!pool.run_pending_task()) {
+                _mm_pause();
+            }
+        }
+    }
+
+    bench::report("ThreadPool flat " + std::to_string(n_threads) + "T", N_JOBS, sw.get_elapsed());
+}
+
+void run_flat_case(unsigned const n_workers) {
+    JobSystem system{n_workers};
+    JobCounter counter;
+
+    bench::Stopwatch sw;
+
+    for(size_t batch = 0; batch < N_JOBS; batch += BATCH_LENGTH) {
+        for(size_t i = 0; i < BATCH_LENGTH; ++i) { system.run(&empty_job, nullptr, &counter); }
+
+        system.wait(counter);
+    }
+
+    bench::report("JobSystem flat " + std::to_string(n_workers) + "W", N_JOBS, sw.get_elapsed());
+}
+
+void run_nested_case(unsigned const n_workers) {
+    JobSystem system{n_workers};
+    JobCounter counter;
+    NestedData data{&system, &counter};
+    size_t const n_parents = N_JOBS / FAN_OUT;
+    size_t const parents_per_batch = BATCH_LENGTH / FAN_OUT;
+
+    bench::Stopwatch sw;
+
+    for(size_t batch = 0; batch < n_parents; batch += parents_per_batch) {
+        for(size_t i = 0; i < parents_per_batch; ++i) { system.run(&parent_job, &data, &counter); }
+
+        system.wait(counter);
+    }
+
+    bench::report(
+      "JobSystem nested " + std::to_string(n_workers) + "W", n_parents * (FAN_OUT + 1), sw.get_elapsed());
+}
+
+int main() {
+    threading::initialize();
+
+    unsigned const max_workers = max(get_available_processor_count(), 1u);
+
+    for(unsigned n = 1; n <= max_workers; n *= 2) { run_thread_pool_case(n); }
+    for(unsigned n = 1; n <= max_workers; n *= 2) { run_flat_case(n); }
+    for(unsigned n = 1; n <= max_workers; n *= 2) { run_nested_case(n); }
+
+    return 0;
+}
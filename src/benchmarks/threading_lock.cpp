@@ -0,0 +1,101 @@
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <emmintrin.h>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/lock.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+using namespace jolt::threading;
+
+constexpr size_t N_ACQUISITIONS = 4 * 1024 * 1024; // Total lock acquisitions per benchmark case
+constexpr unsigned MAX_THREADS = 16;
+constexpr unsigned SHORT_SECTION_LENGTH = 1;  // Counter increments while holding the lock, short case
+constexpr unsigned LONG_SECTION_LENGTH = 256; // Counter increments while holding the lock, long case
+
+/**
+ * Baseline: the standard library mutex, behind the same interface as `Lock`.
+ */
+struct StdMutex {
+    std::mutex m_mutex;
+
+    void acquire() { m_mutex.lock(); }
+    void release() { m_mutex.unlock(); }
+};
+
+template<typename L>
+struct BenchData {
+    L m_lock;
+    size_t m_acquisitions_per_thread;
+    unsigned m_section_length;
+    std::atomic<bool> m_go{false};
+    volatile uint64_t m_counter = 0; //< Protected by `m_lock`.
+};
+
+template<typename L>
+void contender(void *param) {
+    auto &data = *reinterpret_cast<BenchData<L> *>(param);
+
+    while(!data.m_go.load(std::memory_order_acquire)) { _mm_pause(); }
+
+    for(size_t i = 0; i < data.m_acquisitions_per_thread; ++i) {
+        data.m_lock.acquire();
+
+        for(unsigned j = 0; j < data.m_section_length; ++j) { data.m_counter = data.m_counter + 1; }
+
+        data.m_lock.release();
+    }
+}
+
+template<typename L>
+void run_case(const char *const name, unsigned const n_threads, unsigned const section_length) {
+    auto &data = *jltnew(BenchData<L>);
+    Thread *threads[MAX_THREADS];
+    size_t const n_acquisitions = N_ACQUISITIONS / section_length;
+
+    data.m_acquisitions_per_thread = n_acquisitions / n_threads;
+    data.m_section_length = section_length;
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i] = jltnew(Thread, &contender<L>);
+        threads[i]->start(&data);
+    }
+
+    bench::Stopwatch sw;
+    data.m_go.store(true, std::memory_order_release);
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i]->join();
+        jltfree(threads[i]);
+    }
+
+    double const elapsed = sw.get_elapsed();
+
+    if(data.m_counter != data.m_acquisitions_per_thread * n_threads * section_length) {
+        std::cout << "COUNTER MISMATCH ";
+    }
+
+    bench::report(
+      std::string{name} + " " + std::to_string(n_threads) + "T/" + std::to_string(section_length) + "I",
+      data.m_acquisitions_per_thread * n_threads,
+      elapsed);
+
+    jltfree(&data);
+}
+
+int main() {
+    threading::initialize();
+
+    unsigned const max_threads = min(max(get_available_processor_count() * 2, 2u), MAX_THREADS);
+
+    for(unsigned const section_length : {SHORT_SECTION_LENGTH, LONG_SECTION_LENGTH}) {
+        for(unsigned n = 1; n <= max_threads; n *= 2) {
+            run_case<Lock>("Lock", n, section_length);
+            run_case<StdMutex>("std::mutex", n, section_length);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <atomic>
+#include <string>
+#include <emmintrin.h>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/lock.hpp>
+#include <jolt/threading/spinlock.hpp>
+#include <jolt/threading/ticketlock.hpp>
+#include <jolt/threading/mcslock.hpp>
+#include "benchmark.hpp"
+
+using namespace jolt;
+using namespace jolt::threading;
+
+constexpr unsigned MIN_THREADS = 2;
+constexpr unsigned MAX_THREADS = 64;
+constexpr size_t CASE_DURATION_MS = 250; // Duration of each benchmark case
+constexpr unsigned SECTION_LENGTH = 16;  // Counter increments while holding the lock
+
+/**
+ * Adapters giving all the locks the same interface.
+ */
+struct SpinLockAdapter {
+    SpinLock m_lock;
+
+    void acquire() { m_lock.acquire(); }
+    void release() { m_lock.release(); }
+};
+
+struct MCSLockAdapter {
+    MCSLock m_lock;
+
+    // Each thread holds a single lock at a time: one node per thread is enough
+    static thread_local MCSLock::Node t_node;
+
+    void acquire() { m_lock.acquire(t_node); }
+    void release() { m_lock.release(t_node); }
+};
+
+thread_local MCSLock::Node MCSLockAdapter::t_node;
+
+template<typename L>
+struct BenchData {
+    L m_lock;
+    std::atomic<bool> m_go{false};
+    std::atomic<bool> m_stop{false};
+    volatile uint64_t m_counter = 0;      //< Protected by `m_lock`.
+    uint64_t m_acquisitions[MAX_THREADS]; //< Acquisitions per thread.
+    std::atomic<unsigned> m_next_index{0};
+};
+
+template<typename L>
+void contender(void *param) {
+    auto &data = *reinterpret_cast<BenchData<L> *>(param);
+    unsigned const index = data.m_next_index++;
+    uint64_t n_acquisitions = 0;
+
+    while(!data.m_go.load(std::memory_order_acquire)) { _mm_pause(); }
+
+    while(!data.m_stop.load(std::memory_order_relaxed)) {
+        data.m_lock.acquire();
+
+        for(unsigned j = 0; j < SECTION_LENGTH; ++j) { data.m_counter = data.m_counter + 1; }
+
+        data.m_lock.release();
+        ++n_acquisitions;
+    }
+
+    data.m_acquisitions[index] = n_acquisitions;
+}
+
+/**
+ * Run a lock for a fixed duration and report the throughput and the fairness, as the ratio between
+ * the least and the most acquisitions made by a single thread.
+ */
+template<typename L>
+void run_case(const char *const name, unsigned const n_threads) {
+    auto &data = *jltnew(BenchData<L>);
+    Thread *threads[MAX_THREADS];
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i] = jltnew(Thread, &contender<L>);
+        threads[i]->start(&data);
+    }
+
+    bench::Stopwatch sw;
+    data.m_go.store(true, std::memory_order_release);
+    jolt::threading::sleep(CASE_DURATION_MS);
+    data.m_stop.store(true, std::memory_order_relaxed);
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        threads[i]->join();
+        jltfree(threads[i]);
+    }
+
+    double const elapsed = sw.get_elapsed();
+    uint64_t total = 0, least = UINT64_MAX, most = 0;
+
+    for(unsigned i = 0; i < n_threads; ++i) {
+        total += data.m_acquisitions[i];
+        least = min(least, data.m_acquisitions[i]);
+        most = max(most, data.m_acquisitions[i]);
+    }
+
+    if(data.m_counter != total * SECTION_LENGTH) {
+        std::cout << "COUNTER MISMATCH ";
+    }
+
+    std::string const fairness = std::to_string(most ? least * 100 / most : 0);
+
+    bench::report(
+      std::string{name} + " " + std::to_string(n_threads) + "T, fairness " + fairness + "%", total, elapsed);
+
+    jltfree(&data);
+}
+
+int main() {
+    threading::initialize();
+
+    for(unsigned n = MIN_THREADS; n <= MAX_THREADS; n *= 2) {
+        run_case<SpinLockAdapter>("SpinLock", n);
+        run_case<TicketLock>("TicketLock", n);
+        run_case<MCSLockAdapter>("MCSLock", n);
+        run_case<Lock>("Lock", n);
+    }
+
+    return 0;
+}
@@ -1,12 +1,521 @@
 #ifndef JLT_ALGORITHMS_HPP
 #define JLT_ALGORITHMS_HPP
 
-#include <jolt/collections/vector.hpp>
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
+#include <utility>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
 
 namespace jolt::algorithms {
+    namespace detail {
+        constexpr size_t INSERTION_SORT_THRESHOLD = 24;    //< Ranges shorter than this are insertion-sorted.
+        constexpr size_t NINTHER_THRESHOLD = 128;          //< Ranges longer than this use a pseudomedian of 9.
+        constexpr size_t PARTIAL_INSERTION_SORT_LIMIT = 8; //< Moves allowed before giving up on a nearly-sorted run.
+        constexpr size_t PARTITION_BLOCK_SIZE = 64;        //< Items classified per block when partitioning.
+        constexpr size_t RADIX_SORT_THRESHOLD = 64;        //< Ranges shorter than this are not radix-sorted.
+
+        /**
+         * Swap two items by moving them.
+         */
+        template<typename T>
+        constexpr void swap_items(T *const a, T *const b) {
+            T tmp = std::move(*a);
+
+            *a = std::move(*b);
+            *b = std::move(tmp);
+        }
+
+        template<typename T, typename L>
+        constexpr void sort2(T *const a, T *const b, L &less) {
+            if(less(*b, *a)) {
+                swap_items(a, b);
+            }
+        }
+
+        template<typename T, typename L>
+        constexpr void sort3(T *const a, T *const b, T *const c, L &less) {
+            sort2(a, b, less);
+            sort2(b, c, less);
+            sort2(a, b, less);
+        }
+
+        template<typename T, typename L>
+        constexpr void insertion_sort(T *const begin, T *const end, L &less) {
+            if(begin == end) {
+                return;
+            }
+
+            for(T *cur = begin + 1; cur != end; ++cur) {
+                T *sift = cur;
+
+                if(less(*sift, *(sift - 1))) {
+                    T tmp = std::move(*sift);
+
+                    do {
+                        *sift = std::move(*(sift - 1));
+                        --sift;
+                    } while(sift != begin && less(tmp, *(sift - 1)));
+
+                    *sift = std::move(tmp);
+                }
+            }
+        }
+
+        /**
+         * Insertion sort that assumes the item right before `begin` is not greater than any item in
+         * the range, and can therefore skip the bounds check.
+         */
+        template<typename T, typename L>
+        constexpr void unguarded_insertion_sort(T *const begin, T *const end, L &less) {
+            if(begin == end) {
+                return;
+            }
+
+            for(T *cur = begin + 1; cur != end; ++cur) {
+                T *sift = cur;
+
+                if(less(*sift, *(sift - 1))) {
+                    T tmp = std::move(*sift);
+
+                    do {
+                        *sift = std::move(*(sift - 1));
+                        --sift;
+                    } while(less(tmp, *(sift - 1)));
+
+                    *sift = std::move(tmp);
+                }
+            }
+        }
+
+        /**
+         * Insertion sort that gives up after moving more than `PARTIAL_INSERTION_SORT_LIMIT` items.
+         *
+         * @return True if the range has been sorted, false if the sort was aborted.
+         */
+        template<typename T, typename L>
+        constexpr bool partial_insertion_sort(T *const begin, T *const end, L &less) {
+            if(begin == end) {
+                return true;
+            }
+
+            size_t moved = 0;
+
+            for(T *cur = begin + 1; cur != end; ++cur) {
+                T *sift = cur;
+
+                if(less(*sift, *(sift - 1))) {
+                    T tmp = std::move(*sift);
+
+                    do {
+                        *sift = std::move(*(sift - 1));
+                        --sift;
+                    } while(sift != begin && less(tmp, *(sift - 1)));
+
+                    *sift = std::move(tmp);
+                    moved += cur - sift;
+                }
+
+                if(moved > PARTIAL_INSERTION_SORT_LIMIT) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<typename T, typename L>
+        constexpr void sift_down(T *const heap, size_t i, size_t const len, L &less) {
+            T tmp = std::move(heap[i]);
+
+            while(true) {
+                size_t child = 2 * i + 1;
+
+                if(child >= len) {
+                    break;
+                }
+
+                child += child + 1 < len && less(heap[child], heap[child + 1]);
+
+                if(!less(tmp, heap[child])) {
+                    break;
+                }
+
+                heap[i] = std::move(heap[child]);
+                i = child;
+            }
+
+            heap[i] = std::move(tmp);
+        }
+
+        /**
+         * Worst-case O(n log n) fallback, used when partitioning keeps going badly.
+         */
+        template<typename T, typename L>
+        constexpr void heapsort(T *const begin, T *const end, L &less) {
+            size_t const len = end - begin;
+
+            for(size_t i = len / 2; i-- > 0;) { sift_down(begin, i, len, less); }
+
+            for(size_t i = len; i-- > 1;) {
+                swap_items(begin, begin + i);
+                sift_down(begin, 0, i, less);
+            }
+        }
+
+        /**
+         * Partition a range around its first item, placing the items equal to the pivot to the left.
+         * Used when the pivot is equal to the item preceding the range, which means the range holds
+         * many duplicates that need not be sorted any further.
+         *
+         * @return The pivot's final position.
+         */
+        template<typename T, typename L>
+        constexpr T *partition_left(T *const begin, T *const end, L &less) {
+            T pivot = std::move(*begin);
+            T *first = begin;
+            T *last = end;
+
+            while(less(pivot, *--last)) {}
+
+            if(last + 1 == end) {
+                while(first < last && !less(pivot, *++first)) {}
+            } else {
+                while(!less(pivot, *++first)) {}
+            }
+
+            while(first < last) {
+                swap_items(first, last);
+
+                while(less(pivot, *--last)) {}
+                while(!less(pivot, *++first)) {}
+            }
+
+            *begin = std::move(*last);
+            *last = std::move(pivot);
+
+            return last;
+        }
+
+        /**
+         * Result of a partitioning pass.
+         */
+        template<typename T>
+        struct PartitionResult {
+            T *m_pivot;                  //< The pivot's final position.
+            bool m_already_partitioned; //< Whether no item had to be moved.
+        };
+
+        /**
+         * Partition a range around its first item, placing the items equal to the pivot to the right.
+         */
+        template<typename T, typename L>
+        constexpr PartitionResult<T> partition_right(T *const begin, T *const end, L &less) {
+            T pivot = std::move(*begin);
+            T *first = begin;
+            T *last = end;
+
+            // The median-of-3 guarantees these loops stop within the range
+            while(less(*++first, pivot)) {}
+
+            if(first - 1 == begin) {
+                while(first < last && !less(*--last, pivot)) {}
+            } else {
+                while(!less(*--last, pivot)) {}
+            }
+
+            bool const already_partitioned = first >= last;
+
+            while(first < last) {
+                swap_items(first, last);
+
+                while(less(*++first, pivot)) {}
+                while(!less(*--last, pivot)) {}
+            }
+
+            T *const pivot_pos = first - 1;
+
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+
+            return PartitionResult<T>{pivot_pos, already_partitioned};
+        }
+
+        /**
+         * Swap `num` pairs of misplaced items, found at the given offsets from the two block bases.
+         * When the counts match, plain swaps are used to keep descending inputs linear; otherwise the
+         * items are moved along a single cycle, which takes one move per item instead of three.
+         */
+        template<typename T>
+        constexpr void swap_offsets(
+          T *const first,
+          T *const last,
+          unsigned char const *const offsets_l,
+          unsigned char const *const offsets_r,
+          size_t const num,
+          bool const use_swaps) {
+            if(use_swaps) {
+                for(size_t i = 0; i < num; ++i) { swap_items(first + offsets_l[i], last - offsets_r[i]); }
+            } else if(num) {
+                T *l = first + offsets_l[0];
+                T *r = last - offsets_r[0];
+                T tmp = std::move(*l);
+
+                *l = std::move(*r);
+
+                for(size_t i = 1; i < num; ++i) {
+                    l = first + offsets_l[i];
+                    *r = std::move(*l);
+                    r = last - offsets_r[i];
+                    *l = std::move(*r);
+                }
+
+                *r = std::move(tmp);
+            }
+        }
+
+        /**
+         * Branchless variant of `partition_right()`. Items are first classified a block at a time,
+         * storing the offsets of the misplaced ones without branching on the comparison result, then
+         * swapped in bulk (Edelkamp & Weiß, "BlockQuicksort").
+         */
+        template<typename T, typename L>
+        constexpr PartitionResult<T> partition_right_branchless(T *const begin, T *const end, L &less) {
+            T pivot = std::move(*begin);
+            T *first = begin;
+            T *last = end;
+
+            while(less(*++first, pivot)) {}
+
+            if(first - 1 == begin) {
+                while(first < last && !less(*--last, pivot)) {}
+            } else {
+                while(!less(*--last, pivot)) {}
+            }
+
+            bool const already_partitioned = first >= last;
+
+            if(!already_partitioned) {
+                swap_items(first, last);
+                ++first;
+
+                unsigned char offsets_l[PARTITION_BLOCK_SIZE];
+                unsigned char offsets_r[PARTITION_BLOCK_SIZE];
+                T *offsets_l_base = first;
+                T *offsets_r_base = last;
+                size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+                while(first < last) {
+                    // Only refill the blocks that have been fully consumed
+                    size_t const num_unknown = last - first;
+                    size_t const left_split = num_l ? 0 : (num_r ? num_unknown : num_unknown / 2);
+                    size_t const right_split = num_r ? 0 : num_unknown - left_split;
+                    size_t const left_count = min(left_split, PARTITION_BLOCK_SIZE);
+                    size_t const right_count = min(right_split, PARTITION_BLOCK_SIZE);
+
+                    for(size_t i = 0; i < left_count; ++i) {
+                        offsets_l[num_l] = static_cast<unsigned char>(i);
+                        num_l += !less(*first, pivot);
+                        ++first;
+                    }
+
+                    for(size_t i = 0; i < right_count; ++i) {
+                        offsets_r[num_r] = static_cast<unsigned char>(i + 1);
+                        num_r += less(*--last, pivot);
+                    }
+
+                    size_t const num = min(num_l, num_r);
+
+                    swap_offsets(
+                      offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+
+                    num_l -= num;
+                    num_r -= num;
+                    start_l += num;
+                    start_r += num;
+
+                    if(!num_l) {
+                        start_l = 0;
+                        offsets_l_base = first;
+                    }
+
+                    if(!num_r) {
+                        start_r = 0;
+                        offsets_r_base = last;
+                    }
+                }
+
+                // Only one side can have misplaced items left: move them next to the boundary
+                if(num_l) {
+                    while(num_l--) { swap_items(offsets_l_base + offsets_l[start_l + num_l], --last); }
+
+                    first = last;
+                }
+
+                if(num_r) {
+                    while(num_r--) {
+                        swap_items(offsets_r_base - offsets_r[start_r + num_r], first);
+                        ++first;
+                    }
+
+                    last = first;
+                }
+            }
+
+            T *const pivot_pos = first - 1;
+
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+
+            return PartitionResult<T>{pivot_pos, already_partitioned};
+        }
+
+        /**
+         * Break up patterns that lead to bad partitions by swapping a few items around.
+         */
+        template<typename T>
+        constexpr void shuffle_partitions(T *const begin, T *const pivot_pos, T *const end) {
+            size_t const l_size = pivot_pos - begin;
+            size_t const r_size = end - (pivot_pos + 1);
+
+            if(l_size >= INSERTION_SORT_THRESHOLD) {
+                swap_items(begin, begin + l_size / 4);
+                swap_items(pivot_pos - 1, pivot_pos - l_size / 4);
+
+                if(l_size > NINTHER_THRESHOLD) {
+                    swap_items(begin + 1, begin + (l_size / 4 + 1));
+                    swap_items(begin + 2, begin + (l_size / 4 + 2));
+                    swap_items(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                    swap_items(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                }
+            }
+
+            if(r_size >= INSERTION_SORT_THRESHOLD) {
+                swap_items(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                swap_items(end - 1, end - r_size / 4);
+
+                if(r_size > NINTHER_THRESHOLD) {
+                    swap_items(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                    swap_items(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                    swap_items(end - 2, end - (1 + r_size / 4));
+                    swap_items(end - 3, end - (2 + r_size / 4));
+                }
+            }
+        }
+
+        template<bool Branchless, typename T, typename L>
+        constexpr void pdqsort_loop(T *begin, T *const end, L &less, int bad_allowed, bool leftmost) {
+            while(true) {
+                size_t const size = end - begin;
+
+                if(size < INSERTION_SORT_THRESHOLD) {
+                    if(leftmost) {
+                        insertion_sort(begin, end, less);
+                    } else {
+                        unguarded_insertion_sort(begin, end, less);
+                    }
+
+                    return;
+                }
+
+                // Move the pivot to `begin`
+                size_t const s2 = size / 2;
+
+                if(size > NINTHER_THRESHOLD) {
+                    sort3(begin, begin + s2, end - 1, less);
+                    sort3(begin + 1, begin + (s2 - 1), end - 2, less);
+                    sort3(begin + 2, begin + (s2 + 1), end - 3, less);
+                    sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), less);
+                    swap_items(begin, begin + s2);
+                } else {
+                    sort3(begin + s2, begin, end - 1, less);
+                }
+
+                // If the pivot equals the item before the range, every item equal to it is already
+                // in its final position: put them on the left and only sort what's on the right.
+                if(!leftmost && !less(*(begin - 1), *begin)) {
+                    begin = partition_left(begin, end, less) + 1;
+                    continue;
+                }
+
+                PartitionResult<T> const part = Branchless ? partition_right_branchless(begin, end, less)
+                                                           : partition_right(begin, end, less);
+                T *const pivot_pos = part.m_pivot;
+                size_t const l_size = pivot_pos - begin;
+                size_t const r_size = end - (pivot_pos + 1);
+
+                if(l_size < size / 8 || r_size < size / 8) {
+                    if(--bad_allowed == 0) {
+                        heapsort(begin, end, less);
+                        return;
+                    }
+
+                    shuffle_partitions(begin, pivot_pos, end);
+                } else if(
+                  part.m_already_partitioned && partial_insertion_sort(begin, pivot_pos, less)
+                  && partial_insertion_sort(pivot_pos + 1, end, less)) {
+                    return;
+                }
+
+                pdqsort_loop<Branchless>(begin, pivot_pos, less, bad_allowed, leftmost);
+
+                begin = pivot_pos + 1;
+                leftmost = false;
+            }
+        }
+
+        /**
+         * Return the number of bits needed to represent `n`.
+         */
+        constexpr int bit_width(size_t n) {
+            int width = 0;
+
+            for(; n; n >>= 1) { ++width; }
+
+            return width;
+        }
+
+        /**
+         * Map an arithmetic key to an unsigned integer with the same ordering.
+         */
+        template<typename K>
+        constexpr auto to_radix_key(K const key) {
+            if constexpr(std::is_floating_point<K>::value) {
+                static_assert(sizeof(K) == 4 || sizeof(K) == 8, "Unsupported floating point type");
+
+                using radix_type = typename std::conditional<sizeof(K) == 4, uint32_t, uint64_t>::type;
+                constexpr int sign_shift = sizeof(K) * 8 - 1;
+
+                auto const bits = std::bit_cast<radix_type>(key);
+                // Negative: flip all the bits. Positive: flip the sign bit only.
+                radix_type const mask = static_cast<radix_type>(0 - (bits >> sign_shift))
+                                        | (static_cast<radix_type>(1) << sign_shift);
+
+                return static_cast<radix_type>(bits ^ mask);
+            } else {
+                using radix_type = typename std::make_unsigned<K>::type;
+
+                if constexpr(std::is_signed<K>::value) {
+                    return static_cast<radix_type>(
+                      static_cast<radix_type>(key) ^ (static_cast<radix_type>(1) << (sizeof(K) * 8 - 1)));
+                } else {
+                    return static_cast<radix_type>(key);
+                }
+            }
+        }
+    } // namespace detail
+
     /**
-     * Quick-sort elements in an array in place.
+     * Sort elements in an array in place.
+     *
+     * This is a pattern-defeating quicksort: a quicksort that falls back to insertion sort for short
+     * ranges, detects already sorted and many-duplicates ranges, shuffles the input when partitions
+     * turn out badly, and falls back to heapsort after too many bad partitions, guaranteeing
+     * O(n log n) in the worst case. When the key is arithmetic, partitioning is branchless.
+     *
+     * The sort is not stable. Items are moved, never copied.
      *
      * @param ptr Pointer to the array to sort.
      * @param len Length of the array to sort.
@@ -21,63 +530,99 @@ namespace jolt::algorithms {
      * @endcode
      */
     template<typename value_type>
-    void constexpr quicksort(value_type *const ptr, size_t const len, auto key) {
-        using pointer = value_type *;
-        using key_type = decltype(key(*ptr));
+    void constexpr sort(value_type *const ptr, size_t const len, auto key) {
+        using key_type = typename std::remove_cvref<decltype(key(*ptr))>::type;
 
-        struct Frame {
-            pointer ptr;
-            size_t len;
-        };
+        constexpr bool branchless = std::is_arithmetic<key_type>::value || std::is_pointer<key_type>::value;
+        auto less = [&key](value_type &left, value_type &right) { return key(left) < key(right); };
 
-        collections::Vector<Frame> stack;
-        stack.push({ptr, len});
+        if(len > 1) {
+            detail::pdqsort_loop<branchless>(ptr, ptr + len, less, detail::bit_width(len), true);
+        }
+    }
 
-        while(stack.get_length()) {
-            // Pop so it's more efficient on the vector side
-            // and does depth-first scan so it's more cache efficient.
-            auto const [p, p_len] = stack.pop(); // p is beginning of array
-            pointer pivot = p + (p_len / 2);     // Choose pivot index
-            key_type const pivot_value = key(*pivot);
-            pointer const p_end = p + p_len;
-            pointer l = p, r = p_end - 1; // Left and right pointer
+    /**
+     * Sort elements in an array in place by an integral or floating point key, using an LSD radix
+     * sort with 8-bit digits.
+     *
+     * All the digit histograms are computed in a single pass over the input, and passes where all
+     * the keys share the same digit are skipped, so narrow key ranges (eg. hashes masked to a few
+     * bits or small draw keys) only pay for the digits that actually vary. Short arrays are sorted with
+     * an insertion sort instead.
+     *
+     * The sort is stable. Negative floating point keys are ordered before positive ones, including
+     * negative zero before positive zero.
+     *
+     * @param ptr Pointer to the array to sort.
+     * @param len Length of the array to sort.
+     * @param key A lambda expression accepting a single parameter, an item or reference to an item from the
+     * array, and providing as output an integral or floating point key.
+     *
+     * @remarks This function allocates a scratch buffer of `len` items.
+     */
+    template<typename value_type>
+    void radix_sort(value_type *const ptr, size_t const len, auto key) {
+        using key_type = typename std::remove_cvref<decltype(key(*ptr))>::type;
 
-            // Partition
-            while(l < r) {
-                key_type l_value = key(*l);
-                key_type r_value = key(*r);
+        static_assert(
+          std::is_arithmetic<key_type>::value && !std::is_same<key_type, bool>::value,
+          "Radix sort keys must be integral or floating point values");
+        static_assert(
+          std::is_trivially_copyable<value_type>::value, "Radix sort requires trivially copyable items");
 
-                while(l_value <= pivot_value && l < pivot) {
-                    ++l;
-                    l_value = key(*l);
-                }
+        constexpr size_t n_passes = sizeof(key_type);
 
-                while(r_value >= pivot_value && r > pivot) {
-                    --r;
-                    r_value = key(*r);
-                }
+        if(len < detail::RADIX_SORT_THRESHOLD) {
+            // Insertion sort is stable, unlike `sort()`, and comparing the radix keys orders the
+            // floating point keys like the passes below
+            auto less = [&key](value_type &left, value_type &right) {
+                return detail::to_radix_key(key(left)) < detail::to_radix_key(key(right));
+            };
 
-                if(l_value > r_value) {
-                    value_type tmp = *l;
-                    *l = *r;
-                    *r = tmp;
+            detail::insertion_sort(ptr, ptr + len, less);
+            return;
+        }
 
-                    pivot = choose(r, choose(l, pivot, r == pivot), l == pivot);
-                }
+        size_t counts[n_passes][256] = {};
+
+        for(size_t i = 0; i < len; ++i) {
+            auto const radix_key = detail::to_radix_key(key(ptr[i]));
+
+            for(size_t p = 0; p < n_passes; ++p) { ++counts[p][(radix_key >> (p * 8)) & 0xff]; }
+        }
+
+        value_type *const scratch = memory::allocate_array<value_type>(len);
+        value_type *src = ptr, *dst = scratch;
+
+        for(size_t p = 0; p < n_passes; ++p) {
+            size_t *const pass_counts = counts[p];
+            size_t const first_digit = (detail::to_radix_key(key(src[0])) >> (p * 8)) & 0xff;
+
+            if(pass_counts[first_digit] == len) {
+                continue; // All keys share this digit
             }
 
-            // Add next, left partition first
-            long long const left_len = pivot - p;
-            long long const right_len = p_end - pivot - 1;
+            for(size_t d = 0, offset = 0; d < 256; ++d) {
+                size_t const count = pass_counts[d];
 
-            if(left_len > 1) {
-                stack.push({p, static_cast<size_t>(left_len)});
+                pass_counts[d] = offset;
+                offset += count;
             }
 
-            if(right_len > 1) {
-                stack.push({pivot + 1, static_cast<size_t>(right_len)});
+            for(size_t i = 0; i < len; ++i) {
+                size_t const digit = (detail::to_radix_key(key(src[i])) >> (p * 8)) & 0xff;
+
+                dst[pass_counts[digit]++] = src[i];
             }
+
+            std::swap(src, dst);
         }
+
+        if(src != ptr) {
+            memcpy(ptr, src, len * sizeof(value_type));
+        }
+
+        memory::free_array(scratch, 0);
     }
 } // namespace jolt::algorithms
 
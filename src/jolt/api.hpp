@@ -1,13 +1,16 @@
 #ifndef JLT_API_HPP
 #define JLT_API_HPP
 
-#ifdef JLT_INTERNAL
+#ifndef _WIN32
+    #define JLTAPI __attribute__((visibility("default")))
+#elif defined(JLT_INTERNAL)
     #define JLTAPI __attribute__((dllexport))
 #else
     #define JLTAPI __attribute__((dllimport))
-#endif // JLT_INTERNAL
+#endif // _WIN32
 
 #define JLT_INLINE __attribute__((always_inline))
+#define JLT_TARGET(isa) __attribute__((target(isa)))
 
 #define JLT_MAYBE_UNUSED [[maybe_unused]]
 #define JLT_NODISCARD [[nodiscard]]
@@ -0,0 +1,543 @@
+#ifndef JLT_COLLECTIONS_BITSET_HPP
+#define JLT_COLLECTIONS_BITSET_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <immintrin.h>
+
+namespace jolt {
+    namespace collections {
+        /**
+         * A resizable sequence of bits.
+         *
+         * The bits are stored in 64-bit words, and the number of allocated words is always a multiple
+         * of `WORDS_PER_BLOCK`, so that bulk operations can process whole 256-bit blocks without a
+         * scalar tail. The bits past the length are always kept clear.
+         *
+         * On processors supporting AVX2, the set operations process one block per instruction;
+         * otherwise they process one word at a time. The path is chosen at runtime, unless AVX2 is
+         * enabled at compile time.
+         */
+        class BitSet {
+          public:
+            using word_type = uint64_t;
+
+            static constexpr size_t BITS_PER_WORD = sizeof(word_type) * 8; //< Number of bits in a word.
+            static constexpr size_t WORDS_PER_BLOCK = 4; //< Number of words in a 256-bit block.
+            static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max(); //< Search failure.
+
+          private:
+            word_type *m_words;            //< The storage words.
+            size_t m_n_words;              //< Number of allocated words.
+            size_t m_length;               //< Number of bits.
+            memory::flags_t m_alloc_flags; //< Allocation flags.
+
+            JLT_NODISCARD static constexpr size_t get_word_index(size_t const bit) {
+                return bit / BITS_PER_WORD;
+            }
+
+            JLT_NODISCARD static constexpr word_type get_bit_mask(size_t const bit) {
+                return word_type{1} << (bit % BITS_PER_WORD);
+            }
+
+            JLT_NODISCARD static constexpr size_t get_block_word_count(size_t const length) {
+                size_t const n_words = (length + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+                return (n_words + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK * WORDS_PER_BLOCK;
+            }
+
+            /**
+             * Clear the bits past the length.
+             */
+            void clear_tail() {
+                size_t const tail = m_length % BITS_PER_WORD;
+                size_t const n_used_words = get_used_word_count();
+
+                if(tail) {
+                    m_words[get_word_index(m_length)] &= (word_type{1} << tail) - 1;
+                }
+
+                if(n_used_words < m_n_words) {
+                    memset(m_words + n_used_words, 0, (m_n_words - n_used_words) * sizeof(word_type));
+                }
+            }
+
+            /**
+             * Assign a value to the bits of a word selected by a mask.
+             */
+            void assign_masked(size_t const word_idx, word_type const mask, bool const value) {
+                m_words[word_idx] = choose(m_words[word_idx] | mask, m_words[word_idx] & ~mask, value);
+            }
+
+            void reallocate(size_t const n_words) {
+                word_type *new_words = nullptr;
+
+                if(n_words) {
+                    memory::push_force_flags(m_alloc_flags);
+                    new_words = memory::allocate_array<word_type>(n_words);
+                    memory::pop_force_flags();
+                }
+
+                if(new_words) {
+                    size_t const n_copy = min(n_words, m_n_words);
+
+                    if(n_copy) {
+                        memcpy(new_words, m_words, n_copy * sizeof(word_type));
+                    }
+
+                    memset(new_words + n_copy, 0, (n_words - n_copy) * sizeof(word_type));
+                }
+
+                if(m_words) {
+                    memory::free_array(m_words);
+                }
+
+                m_words = new_words;
+                m_n_words = n_words;
+            }
+
+            struct AndOp {
+                JLT_NODISCARD static word_type apply(word_type const a, word_type const b) { return a & b; }
+                JLT_NODISCARD JLT_TARGET("avx2") static __m256i apply(__m256i const a, __m256i const b) {
+                    return _mm256_and_si256(a, b);
+                }
+            };
+
+            struct OrOp {
+                JLT_NODISCARD static word_type apply(word_type const a, word_type const b) { return a | b; }
+                JLT_NODISCARD JLT_TARGET("avx2") static __m256i apply(__m256i const a, __m256i const b) {
+                    return _mm256_or_si256(a, b);
+                }
+            };
+
+            struct XorOp {
+                JLT_NODISCARD static word_type apply(word_type const a, word_type const b) { return a ^ b; }
+                JLT_NODISCARD JLT_TARGET("avx2") static __m256i apply(__m256i const a, __m256i const b) {
+                    return _mm256_xor_si256(a, b);
+                }
+            };
+
+            struct AndNotOp {
+                JLT_NODISCARD static word_type apply(word_type const a, word_type const b) { return a & ~b; }
+                JLT_NODISCARD JLT_TARGET("avx2") static __m256i apply(__m256i const a, __m256i const b) {
+                    return _mm256_andnot_si256(b, a);
+                }
+            };
+
+            /**
+             * Return a value stating whether the processor supports AVX2.
+             */
+            JLT_NODISCARD static bool has_avx2() {
+#ifdef __AVX2__
+                return true;
+#else  // __AVX2__
+                static bool const result = __builtin_cpu_supports("avx2");
+
+                return result;
+#endif // __AVX2__
+            }
+
+            /**
+             * Combine each block of this set with the matching block of another, using AVX2.
+             */
+            template<typename Op>
+            JLT_TARGET("avx2") void combine_blocks(BitSet const &other) {
+                for(size_t i = 0; i < m_n_words; i += WORDS_PER_BLOCK) {
+                    auto const dst = reinterpret_cast<__m256i *>(m_words + i);
+                    auto const src = reinterpret_cast<__m256i const *>(other.m_words + i);
+
+                    _mm256_storeu_si256(dst, Op::apply(_mm256_loadu_si256(dst), _mm256_loadu_si256(src)));
+                }
+            }
+
+            /**
+             * Combine each word of this set with the matching word of another.
+             *
+             * @tparam Op The operation, providing `apply()` for words and for 256-bit blocks.
+             *
+             * @param other The other set. It must have the same length as this one.
+             */
+            template<typename Op>
+            void combine(BitSet const &other) {
+                jltassert2(m_length == other.m_length, "Bit sets have different lengths");
+
+                if(has_avx2()) {
+                    combine_blocks<Op>(other);
+
+                    return;
+                }
+
+                for(size_t i = 0; i < m_n_words; ++i) {
+                    m_words[i] = Op::apply(m_words[i], other.m_words[i]);
+                }
+            }
+
+            /**
+             * Find the first bit of a given value, starting from a given bit.
+             *
+             * @tparam Value The value to look for.
+             */
+            template<bool Value>
+            JLT_NODISCARD size_t find_first(size_t const from) const {
+                if(from >= m_length) {
+                    return NOT_FOUND;
+                }
+
+                size_t word_idx = get_word_index(from);
+                word_type word = choose(m_words[word_idx], ~m_words[word_idx], Value);
+
+                word &= ~word_type{0} << (from % BITS_PER_WORD);
+
+                for(size_t const n_words = get_used_word_count(); !word;) {
+                    if(++word_idx >= n_words) {
+                        return NOT_FOUND;
+                    }
+
+                    word = choose(m_words[word_idx], ~m_words[word_idx], Value);
+                }
+
+                size_t const result = word_idx * BITS_PER_WORD + std::countr_zero(word);
+
+                return choose(result, NOT_FOUND, result < m_length);
+            }
+
+          public:
+            /**
+             * Create a new bit set.
+             *
+             * @param length The number of bits.
+             * @param value The initial value of all the bits.
+             */
+            JLT_NODISCARD explicit BitSet(size_t const length = 0, bool const value = false) :
+              m_words{nullptr}, m_n_words{0}, m_length{0}, m_alloc_flags{memory::get_current_force_flags()} {
+                set_length(length, value);
+            }
+
+            JLT_NODISCARD BitSet(BitSet const &other) :
+              m_words{nullptr}, m_n_words{0}, m_length{0}, m_alloc_flags{other.m_alloc_flags} {
+                *this = other;
+            }
+
+            JLT_NODISCARD BitSet(BitSet &&other) :
+              m_words{other.m_words}, m_n_words{other.m_n_words}, m_length{other.m_length},
+              m_alloc_flags{other.m_alloc_flags} {
+                other.m_words = nullptr;
+                other.m_n_words = other.m_length = 0;
+            }
+
+            ~BitSet() {
+                if(m_words) {
+                    memory::free_array(m_words);
+                }
+            }
+
+            BitSet &operator=(BitSet const &other) {
+                if(this != &other) {
+                    if(m_n_words != other.m_n_words) {
+                        reallocate(other.m_n_words);
+                    }
+
+                    if(m_n_words) {
+                        memcpy(m_words, other.m_words, m_n_words * sizeof(word_type));
+                    }
+
+                    m_length = other.m_length;
+                }
+
+                return *this;
+            }
+
+            BitSet &operator=(BitSet &&other) {
+                if(this != &other) {
+                    if(m_words) {
+                        memory::free_array(m_words);
+                    }
+
+                    m_words = other.m_words;
+                    m_n_words = other.m_n_words;
+                    m_length = other.m_length;
+                    m_alloc_flags = other.m_alloc_flags;
+
+                    other.m_words = nullptr;
+                    other.m_n_words = other.m_length = 0;
+                }
+
+                return *this;
+            }
+
+            /**
+             * Change the number of bits.
+             *
+             * @param new_length The new number of bits.
+             * @param value The value of the bits added past the old length.
+             */
+            void set_length(size_t const new_length, bool const value = false) {
+                size_t const old_length = m_length;
+                size_t const n_words = get_block_word_count(new_length);
+
+                if(n_words != m_n_words) {
+                    reallocate(n_words);
+                }
+
+                m_length = new_length;
+
+                if(new_length > old_length) {
+                    if(value) {
+                        set_range(old_length, new_length, true);
+                    }
+                } else {
+                    clear_tail();
+                }
+            }
+
+            JLT_NODISCARD size_t get_length() const { return m_length; }
+
+            /**
+             * Return the number of words that contain at least one bit of the set.
+             */
+            JLT_NODISCARD size_t get_used_word_count() const {
+                return (m_length + BITS_PER_WORD - 1) / BITS_PER_WORD;
+            }
+
+            /**
+             * Return the storage words. The bits past the length are always clear.
+             */
+            JLT_NODISCARD word_type const *get_words() const { return m_words; }
+
+            JLT_NODISCARD bool get(size_t const bit) const {
+                jltassert2(bit < m_length, "Bit index out of bounds");
+
+                return m_words[get_word_index(bit)] & get_bit_mask(bit);
+            }
+
+            JLT_NODISCARD bool operator[](size_t const bit) const { return get(bit); }
+
+            void set(size_t const bit) {
+                jltassert2(bit < m_length, "Bit index out of bounds");
+
+                m_words[get_word_index(bit)] |= get_bit_mask(bit);
+            }
+
+            void set(size_t const bit, bool const value) {
+                if(value) {
+                    set(bit);
+                } else {
+                    reset(bit);
+                }
+            }
+
+            void reset(size_t const bit) {
+                jltassert2(bit < m_length, "Bit index out of bounds");
+
+                m_words[get_word_index(bit)] &= ~get_bit_mask(bit);
+            }
+
+            void flip(size_t const bit) {
+                jltassert2(bit < m_length, "Bit index out of bounds");
+
+                m_words[get_word_index(bit)] ^= get_bit_mask(bit);
+            }
+
+            /**
+             * Set the value of a range of bits.
+             *
+             * @param begin The index of the first bit of the range.
+             * @param end The index past the last bit of the range.
+             * @param value The value to assign to the bits.
+             */
+            void set_range(size_t const begin, size_t const end, bool const value) {
+                jltassert2(begin <= end && end <= m_length, "Bit range out of bounds");
+
+                if(begin == end) {
+                    return;
+                }
+
+                size_t const first_word = get_word_index(begin);
+                size_t const last_word = get_word_index(end - 1);
+                word_type const first_mask = ~word_type{0} << (begin % BITS_PER_WORD);
+                word_type const last_mask = ~word_type{0} >> (BITS_PER_WORD - 1 - (end - 1) % BITS_PER_WORD);
+
+                if(first_word == last_word) {
+                    assign_masked(first_word, first_mask & last_mask, value);
+
+                    return;
+                }
+
+                assign_masked(first_word, first_mask, value);
+
+                for(size_t i = first_word + 1; i < last_word; ++i) {
+                    m_words[i] = choose<word_type>(~word_type{0}, 0, value);
+                }
+
+                assign_masked(last_word, last_mask, value);
+            }
+
+            /**
+             * Set all the bits.
+             */
+            void set_all() { set_range(0, m_length, true); }
+
+            /**
+             * Clear all the bits.
+             */
+            void clear() {
+                if(m_n_words) {
+                    memset(m_words, 0, m_n_words * sizeof(word_type));
+                }
+            }
+
+            /**
+             * Return the number of set bits.
+             */
+            JLT_NODISCARD size_t count() const {
+                size_t result = 0;
+
+                for(size_t i = 0, n_words = get_used_word_count(); i < n_words; ++i) {
+                    result += std::popcount(m_words[i]);
+                }
+
+                return result;
+            }
+
+            /**
+             * Return a value stating whether at least one bit is set.
+             */
+            JLT_NODISCARD bool any() const { return find_first_set() != NOT_FOUND; }
+
+            /**
+             * Return a value stating whether no bit is set.
+             */
+            JLT_NODISCARD bool none() const { return !any(); }
+
+            /**
+             * Find the first set bit.
+             *
+             * @param from The index of the bit where to start the search.
+             *
+             * @return The index of the first set bit not before `from` or `NOT_FOUND`.
+             */
+            JLT_NODISCARD size_t find_first_set(size_t const from = 0) const {
+                return find_first<true>(from);
+            }
+
+            /**
+             * Find the first clear bit.
+             *
+             * @param from The index of the bit where to start the search.
+             *
+             * @return The index of the first clear bit not before `from` or `NOT_FOUND`.
+             */
+            JLT_NODISCARD size_t find_first_unset(size_t const from = 0) const {
+                return find_first<false>(from);
+            }
+
+            /**
+             * Find the first run of clear bits of a minimum length.
+             *
+             * @param length The minimum length of the run.
+             * @param from The index of the bit where to start the search.
+             *
+             * @return The index of the first bit of the run or `NOT_FOUND`.
+             */
+            JLT_NODISCARD size_t find_unset_run(size_t const length, size_t const from = 0) const {
+                for(size_t begin = find_first_unset(from); begin != NOT_FOUND;) {
+                    size_t const end = min(find_first_set(begin), m_length);
+
+                    if(end - begin >= length) {
+                        return begin;
+                    }
+
+                    begin = find_first_unset(end);
+                }
+
+                return NOT_FOUND;
+            }
+
+            /**
+             * Call a function on each run of consecutive set bits, in ascending order.
+             *
+             * @param func The function to call, with signature `void(size_t begin, size_t end)`, where
+             * `end` is the index past the last bit of the run.
+             */
+            template<typename F>
+            void for_each_run(F &&func) const {
+                for(size_t begin = find_first_set(); begin != NOT_FOUND;) {
+                    size_t const end = min(find_first_unset(begin), m_length);
+
+                    func(begin, end);
+
+                    begin = find_first_set(end);
+                }
+            }
+
+            /**
+             * Call a function on each set bit, in ascending order.
+             *
+             * @param func The function to call, with signature `void(size_t bit)`.
+             */
+            template<typename F>
+            void for_each_set(F &&func) const {
+                for(size_t i = 0, n_words = get_used_word_count(); i < n_words; ++i) {
+                    for(word_type word = m_words[i]; word; word &= word - 1) {
+                        func(i * BITS_PER_WORD + std::countr_zero(word));
+                    }
+                }
+            }
+
+            BitSet &operator&=(BitSet const &other) {
+                combine<AndOp>(other);
+
+                return *this;
+            }
+
+            BitSet &operator|=(BitSet const &other) {
+                combine<OrOp>(other);
+
+                return *this;
+            }
+
+            BitSet &operator^=(BitSet const &other) {
+                combine<XorOp>(other);
+
+                return *this;
+            }
+
+            /**
+             * Clear all the bits that are set in another set.
+             *
+             * @param other The other set. It must have the same length as this one.
+             */
+            BitSet &and_not(BitSet const &other) {
+                combine<AndNotOp>(other);
+
+                return *this;
+            }
+
+            /**
+             * Flip all the bits.
+             */
+            void flip_all() {
+                for(size_t i = 0, n_words = get_used_word_count(); i < n_words; ++i) {
+                    m_words[i] = ~m_words[i];
+                }
+
+                clear_tail();
+            }
+
+            JLT_NODISCARD bool operator==(BitSet const &other) const {
+                return m_length == other.m_length
+                       && (!m_n_words || !memcmp(m_words, other.m_words, m_n_words * sizeof(word_type)));
+            }
+
+            JLT_NODISCARD bool operator!=(BitSet const &other) const { return !(*this == other); }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_BITSET_HPP */
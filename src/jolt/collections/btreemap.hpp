@@ -0,0 +1,759 @@
+#ifndef JLT_COLLECTIONS_BTREEMAP_HPP
+#define JLT_COLLECTIONS_BTREEMAP_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "comparator.hpp"
+
+namespace jolt {
+    namespace collections {
+        template<typename K, typename T, typename C>
+        class BTreeMap;
+
+        /**
+         * Reference to a key/value pair stored in a B-tree map.
+         *
+         * @tparam K The key type.
+         * @tparam V The value type, possibly const-qualified.
+         */
+        template<typename K, typename V>
+        struct BTreeMapEntry {
+            const K &m_key; //< Key.
+            V &m_value;     //< Value.
+
+            JLT_NODISCARD const K &get_key() const { return m_key; }
+            JLT_NODISCARD V &get_value() const { return m_value; }
+        };
+
+        /**
+         * Iterator implementation for the B-tree map. Walks the linked list of leaves in key order.
+         *
+         * @tparam L The leaf node type, possibly const-qualified.
+         */
+        template<typename L>
+        struct BTreeMapIterator {
+            using leaf_type = L;
+            using key_type = typename std::remove_const<L>::type::key_type;
+            using value_type = typename std::conditional<
+              std::is_const<L>::value,
+              const typename std::remove_const<L>::type::value_type,
+              typename std::remove_const<L>::type::value_type>::type;
+            using entry_type = BTreeMapEntry<key_type, value_type>;
+
+          private:
+            template<typename A>
+            friend struct BTreeMapIterator;
+
+            leaf_type *m_leaf; //< Current leaf, `nullptr` at the end of the sequence.
+            uint32_t m_index;  //< Index within the current leaf.
+
+          public:
+            BTreeMapIterator(leaf_type *const leaf, uint32_t const index) : m_leaf{leaf}, m_index{index} {
+                normalize();
+            }
+
+            template<typename A>
+            BTreeMapIterator(const BTreeMapIterator<A> &other) : m_leaf{other.m_leaf}, m_index{other.m_index} {}
+
+            /**
+             * Move to the next leaf if the iterator is past the end of the current one.
+             */
+            void normalize() {
+                while(m_leaf && m_index >= m_leaf->m_count) {
+                    m_leaf = m_leaf->m_next;
+                    m_index = 0;
+                }
+            }
+
+            BTreeMapIterator &operator++() {
+                ++m_index;
+                normalize();
+
+                return *this;
+            }
+
+            BTreeMapIterator operator++(int) {
+                BTreeMapIterator other = *this;
+
+                ++*this;
+
+                return other;
+            }
+
+            template<typename It>
+            JLT_NODISCARD constexpr bool operator==(const It &other) const {
+                return m_leaf == other.m_leaf && (!m_leaf || m_index == other.m_index);
+            }
+
+            template<typename It>
+            JLT_NODISCARD constexpr bool operator!=(const It &other) const {
+                return !(*this == other);
+            }
+
+            JLT_NODISCARD entry_type operator*() const {
+                return entry_type{m_leaf->m_keys[m_index], m_leaf->m_values[m_index]};
+            }
+
+            JLT_NODISCARD const key_type &get_key() const { return m_leaf->m_keys[m_index]; }
+            JLT_NODISCARD value_type &get_value() const { return m_leaf->m_values[m_index]; }
+        };
+
+        /**
+         * A pair of iterators delimiting a sequence of entries.
+         */
+        template<typename It>
+        struct BTreeMapRange {
+            It m_begin, m_end;
+
+            JLT_NODISCARD It begin() const { return m_begin; }
+            JLT_NODISCARD It end() const { return m_end; }
+        };
+
+        /**
+         * Ordered map implemented as a B+ tree.
+         *
+         * Each node stores its keys in a contiguous array sized to roughly one cache line, so that
+         * the per-node search touches as little memory as possible. The values live only in the leaves,
+         * which are linked together to provide in-order and range iteration without walking back up
+         * the tree.
+         *
+         * @tparam K The key type. Must be default-constructible and copyable.
+         * @tparam T The value type. Must be default-constructible and copyable.
+         * @tparam C The key comparator type.
+         */
+        template<typename K, typename T, typename C = Less>
+        class BTreeMap {
+          public:
+            using key_type = K;
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+
+            /**
+             * Maximum number of keys held by a node.
+             */
+            static constexpr uint32_t MAX_KEYS = static_cast<uint32_t>(
+              max<size_t>(memory::CACHE_LINE_SIZE / sizeof(key_type), static_cast<size_t>(4)));
+
+            /**
+             * Minimum number of keys held by any node other than the root.
+             */
+            static constexpr uint32_t MIN_KEYS = MAX_KEYS / 2;
+
+          private:
+            struct alignas(memory::CACHE_LINE_SIZE) Node {
+                key_type m_keys[MAX_KEYS + 1]; //< Keys. The last slot is only used transiently while splitting.
+                uint32_t m_count;              //< Number of keys.
+                bool const m_leaf;             //< Whether this node is a leaf.
+
+                explicit Node(bool const leaf) : m_count{0}, m_leaf{leaf} {}
+            };
+
+            struct Leaf : public Node {
+                using key_type = K;
+                using value_type = T;
+
+                value_type m_values[MAX_KEYS + 1]; //< Values, one per key.
+                Leaf *m_prev;                      //< Previous leaf in key order.
+                Leaf *m_next;                      //< Next leaf in key order.
+
+                Leaf() : Node{true}, m_prev{nullptr}, m_next{nullptr} {}
+            };
+
+            struct Inner : public Node {
+                Node *m_children[MAX_KEYS + 2]; //< Children. Child `i` holds keys ordered before key `i`.
+
+                Inner() : Node{false} {}
+            };
+
+            /**
+             * Result of an insertion into a subtree.
+             */
+            struct InsertResult {
+                Node *m_split;       //< New right sibling, if the node has been split.
+                key_type m_separator; //< First key of `m_split`.
+                bool m_added;         //< Whether a new key has been added.
+            };
+
+          public:
+            using iterator = BTreeMapIterator<Leaf>;
+            using const_iterator = BTreeMapIterator<const Leaf>;
+            using range_type = BTreeMapRange<iterator>;
+            using const_range_type = BTreeMapRange<const_iterator>;
+
+          private:
+            Node *m_root;                  //< Root node, `nullptr` if the map is empty.
+            Leaf *m_first;                 //< Leftmost leaf.
+            size_t m_length;               //< Number of pairs.
+            memory::flags_t m_alloc_flags; //< Allocation flags.
+
+            template<typename N>
+            N *new_node() {
+                memory::push_force_flags(m_alloc_flags);
+                N *const node = memory::allocate_and_construct<N>();
+                memory::pop_force_flags();
+
+                return node;
+            }
+
+            static void free_node(Node *const node) {
+                if(node->m_leaf) {
+                    memory::free(static_cast<Leaf *>(node));
+                } else {
+                    memory::free(static_cast<Inner *>(node));
+                }
+            }
+
+            static void free_subtree(Node *const node) {
+                if(!node->m_leaf) {
+                    auto const inner = static_cast<Inner *>(node);
+
+                    for(uint32_t i = 0; i <= inner->m_count; ++i) { free_subtree(inner->m_children[i]); }
+                }
+
+                free_node(node);
+            }
+
+            /**
+             * Index of the first key in a node that is not ordered before `key`.
+             */
+            JLT_NODISCARD static uint32_t lower_bound_in(const Node *const node, const key_type &key) {
+                uint32_t i = 0;
+
+                while(i < node->m_count && C::compare(node->m_keys[i], key)) { ++i; }
+
+                return i;
+            }
+
+            /**
+             * Index of the first key in a node that is ordered after `key`.
+             */
+            JLT_NODISCARD static uint32_t upper_bound_in(const Node *const node, const key_type &key) {
+                uint32_t i = 0;
+
+                while(i < node->m_count && !C::compare(key, node->m_keys[i])) { ++i; }
+
+                return i;
+            }
+
+            JLT_NODISCARD bool keys_equal(const key_type &a, const key_type &b) const {
+                return !C::compare(a, b) && !C::compare(b, a);
+            }
+
+            /**
+             * Shift the items in `arr[pos, count)` one position to the right.
+             */
+            template<typename E>
+            static void shift_right(E *const arr, uint32_t const pos, uint32_t const count) {
+                for(uint32_t i = count; i > pos; --i) { arr[i] = std::move(arr[i - 1]); }
+            }
+
+            /**
+             * Shift the items in `arr[pos + 1, count)` one position to the left.
+             */
+            template<typename E>
+            static void shift_left(E *const arr, uint32_t const pos, uint32_t const count) {
+                for(uint32_t i = pos; i + 1 < count; ++i) { arr[i] = std::move(arr[i + 1]); }
+            }
+
+            /**
+             * Return the leaf that may contain `key`.
+             */
+            JLT_NODISCARD Leaf *find_leaf(const key_type &key) const {
+                Node *node = m_root;
+
+                while(node && !node->m_leaf) {
+                    auto const inner = static_cast<Inner *>(node);
+
+                    node = inner->m_children[upper_bound_in(inner, key)];
+                }
+
+                return static_cast<Leaf *>(node);
+            }
+
+            InsertResult insert_into_leaf(Leaf *const leaf, const key_type &key, const value_type &value) {
+                uint32_t const pos = lower_bound_in(leaf, key);
+
+                if(pos < leaf->m_count && keys_equal(leaf->m_keys[pos], key)) {
+                    leaf->m_values[pos] = value;
+
+                    return InsertResult{nullptr, key_type{}, false};
+                }
+
+                shift_right(leaf->m_keys, pos, leaf->m_count);
+                shift_right(leaf->m_values, pos, leaf->m_count);
+
+                leaf->m_keys[pos] = key;
+                leaf->m_values[pos] = value;
+
+                if(++leaf->m_count <= MAX_KEYS) {
+                    return InsertResult{nullptr, key_type{}, true};
+                }
+
+                // Split
+                Leaf *const right = new_node<Leaf>();
+                uint32_t const left_count = leaf->m_count / 2;
+
+                for(uint32_t i = left_count; i < leaf->m_count; ++i) {
+                    right->m_keys[i - left_count] = std::move(leaf->m_keys[i]);
+                    right->m_values[i - left_count] = std::move(leaf->m_values[i]);
+                }
+
+                right->m_count = leaf->m_count - left_count;
+                leaf->m_count = left_count;
+
+                right->m_next = leaf->m_next;
+                right->m_prev = leaf;
+
+                if(leaf->m_next) {
+                    leaf->m_next->m_prev = right;
+                }
+
+                leaf->m_next = right;
+
+                return InsertResult{right, right->m_keys[0], true};
+            }
+
+            InsertResult insert_into(Node *const node, const key_type &key, const value_type &value) {
+                if(node->m_leaf) {
+                    return insert_into_leaf(static_cast<Leaf *>(node), key, value);
+                }
+
+                auto const inner = static_cast<Inner *>(node);
+                uint32_t const pos = upper_bound_in(inner, key);
+                InsertResult result = insert_into(inner->m_children[pos], key, value);
+
+                if(!result.m_split) {
+                    return result;
+                }
+
+                shift_right(inner->m_keys, pos, inner->m_count);
+                shift_right(inner->m_children, pos + 1, inner->m_count + 1);
+
+                inner->m_keys[pos] = std::move(result.m_separator);
+                inner->m_children[pos + 1] = result.m_split;
+
+                if(++inner->m_count <= MAX_KEYS) {
+                    return InsertResult{nullptr, key_type{}, result.m_added};
+                }
+
+                // Split: the middle key moves up to the parent
+                Inner *const right = new_node<Inner>();
+                uint32_t const mid = inner->m_count / 2;
+
+                for(uint32_t i = mid + 1; i < inner->m_count; ++i) {
+                    right->m_keys[i - mid - 1] = std::move(inner->m_keys[i]);
+                }
+
+                for(uint32_t i = mid + 1; i <= inner->m_count; ++i) {
+                    right->m_children[i - mid - 1] = inner->m_children[i];
+                }
+
+                right->m_count = inner->m_count - mid - 1;
+                inner->m_count = mid;
+
+                return InsertResult{right, std::move(inner->m_keys[mid]), result.m_added};
+            }
+
+            /**
+             * Restore the minimum occupancy of the child at index `pos` of `parent`.
+             */
+            void rebalance_child(Inner *const parent, uint32_t const pos) {
+                Node *const child = parent->m_children[pos];
+                Node *const left = pos > 0 ? parent->m_children[pos - 1] : nullptr;
+                Node *const right = pos < parent->m_count ? parent->m_children[pos + 1] : nullptr;
+
+                if(left && left->m_count > MIN_KEYS) {
+                    borrow_from_left(parent, pos, child, left);
+                } else if(right && right->m_count > MIN_KEYS) {
+                    borrow_from_right(parent, pos, child, right);
+                } else if(left) {
+                    merge(parent, pos - 1, left, child);
+                } else {
+                    merge(parent, pos, child, right);
+                }
+            }
+
+            void borrow_from_left(Inner *const parent, uint32_t const pos, Node *const child, Node *const left) {
+                shift_right(child->m_keys, 0, child->m_count);
+
+                if(child->m_leaf) {
+                    auto const lchild = static_cast<Leaf *>(child);
+                    auto const lleft = static_cast<Leaf *>(left);
+
+                    shift_right(lchild->m_values, 0, child->m_count);
+
+                    child->m_keys[0] = std::move(left->m_keys[left->m_count - 1]);
+                    lchild->m_values[0] = std::move(lleft->m_values[left->m_count - 1]);
+                    parent->m_keys[pos - 1] = child->m_keys[0];
+                } else {
+                    auto const ichild = static_cast<Inner *>(child);
+                    auto const ileft = static_cast<Inner *>(left);
+
+                    shift_right(ichild->m_children, 0, child->m_count + 1);
+
+                    child->m_keys[0] = std::move(parent->m_keys[pos - 1]);
+                    ichild->m_children[0] = ileft->m_children[left->m_count];
+                    parent->m_keys[pos - 1] = std::move(left->m_keys[left->m_count - 1]);
+                }
+
+                ++child->m_count;
+                --left->m_count;
+            }
+
+            void borrow_from_right(Inner *const parent, uint32_t const pos, Node *const child, Node *const right) {
+                if(child->m_leaf) {
+                    auto const lchild = static_cast<Leaf *>(child);
+                    auto const lright = static_cast<Leaf *>(right);
+
+                    child->m_keys[child->m_count] = std::move(right->m_keys[0]);
+                    lchild->m_values[child->m_count] = std::move(lright->m_values[0]);
+
+                    shift_left(right->m_keys, 0, right->m_count);
+                    shift_left(lright->m_values, 0, right->m_count);
+
+                    parent->m_keys[pos] = right->m_keys[0];
+                } else {
+                    auto const ichild = static_cast<Inner *>(child);
+                    auto const iright = static_cast<Inner *>(right);
+
+                    child->m_keys[child->m_count] = std::move(parent->m_keys[pos]);
+                    ichild->m_children[child->m_count + 1] = iright->m_children[0];
+                    parent->m_keys[pos] = std::move(right->m_keys[0]);
+
+                    shift_left(right->m_keys, 0, right->m_count);
+                    shift_left(iright->m_children, 0, right->m_count + 1);
+                }
+
+                ++child->m_count;
+                --right->m_count;
+            }
+
+            /**
+             * Merge `right` into `left`, where `left` is the child at `sep_pos` of `parent`.
+             */
+            void merge(Inner *const parent, uint32_t const sep_pos, Node *const left, Node *const right) {
+                if(left->m_leaf) {
+                    auto const lleft = static_cast<Leaf *>(left);
+                    auto const lright = static_cast<Leaf *>(right);
+
+                    for(uint32_t i = 0; i < right->m_count; ++i) {
+                        left->m_keys[left->m_count + i] = std::move(right->m_keys[i]);
+                        lleft->m_values[left->m_count + i] = std::move(lright->m_values[i]);
+                    }
+
+                    left->m_count += right->m_count;
+                    lleft->m_next = lright->m_next;
+
+                    if(lright->m_next) {
+                        lright->m_next->m_prev = lleft;
+                    }
+                } else {
+                    auto const ileft = static_cast<Inner *>(left);
+                    auto const iright = static_cast<Inner *>(right);
+
+                    left->m_keys[left->m_count] = std::move(parent->m_keys[sep_pos]);
+
+                    for(uint32_t i = 0; i < right->m_count; ++i) {
+                        left->m_keys[left->m_count + 1 + i] = std::move(right->m_keys[i]);
+                    }
+
+                    for(uint32_t i = 0; i <= right->m_count; ++i) {
+                        ileft->m_children[left->m_count + 1 + i] = iright->m_children[i];
+                    }
+
+                    left->m_count += right->m_count + 1;
+                }
+
+                shift_left(parent->m_keys, sep_pos, parent->m_count);
+                shift_left(parent->m_children, sep_pos + 1, parent->m_count + 1);
+                --parent->m_count;
+
+                free_node(right);
+            }
+
+            bool remove_from(Node *const node, const key_type &key) {
+                if(node->m_leaf) {
+                    auto const leaf = static_cast<Leaf *>(node);
+                    uint32_t const pos = lower_bound_in(leaf, key);
+
+                    if(pos >= leaf->m_count || !keys_equal(leaf->m_keys[pos], key)) {
+                        return false;
+                    }
+
+                    shift_left(leaf->m_keys, pos, leaf->m_count);
+                    shift_left(leaf->m_values, pos, leaf->m_count);
+                    --leaf->m_count;
+
+                    return true;
+                }
+
+                auto const inner = static_cast<Inner *>(node);
+                uint32_t const pos = upper_bound_in(inner, key);
+
+                if(!remove_from(inner->m_children[pos], key)) {
+                    return false;
+                }
+
+                if(inner->m_children[pos]->m_count < MIN_KEYS) {
+                    rebalance_child(inner, pos);
+                }
+
+                return true;
+            }
+
+            template<typename It, typename L>
+            JLT_NODISCARD static It make_iterator(L *const leaf, uint32_t const index) {
+                return It{leaf, index};
+            }
+
+          public:
+            /**
+             * Create a new empty map.
+             */
+            JLT_NODISCARD BTreeMap() :
+              m_root{nullptr}, m_first{nullptr}, m_length{0}, m_alloc_flags{memory::get_current_force_flags()} {}
+
+            /**
+             * Create a new map, copy of another.
+             *
+             * @param other The other map.
+             */
+            JLT_NODISCARD BTreeMap(const BTreeMap &other) : BTreeMap{} {
+                for(auto const entry : other) { add(entry.get_key(), entry.get_value()); }
+            }
+
+            /**
+             * Create a new map, taking ownership of the data of another.
+             *
+             * @param other The other map.
+             *
+             * @remarks After this constructor returns, the other map will be empty.
+             */
+            JLT_NODISCARD BTreeMap(BTreeMap &&other) :
+              m_root{other.m_root}, m_first{other.m_first}, m_length{other.m_length}, m_alloc_flags{
+                                                                                        other.m_alloc_flags} {
+                other.m_root = nullptr;
+                other.m_first = nullptr;
+                other.m_length = 0;
+            }
+
+            ~BTreeMap() { clear(); }
+
+            BTreeMap &operator=(const BTreeMap &other) = delete;
+
+            /**
+             * Add a key/value pair.
+             *
+             * @param key The key.
+             * @param value The value.
+             *
+             * @remarks This is an alias to `set_value()`.
+             */
+            void add(const key_type &key, const value_type &value) { set_value(key, value); }
+
+            /**
+             * Set a key/value pair.
+             *
+             * @param key The key.
+             * @param value The value.
+             */
+            void set_value(const key_type &key, const value_type &value) {
+                if(!m_root) {
+                    m_first = new_node<Leaf>();
+                    m_root = m_first;
+                }
+
+                InsertResult result = insert_into(m_root, key, value);
+
+                if(result.m_split) {
+                    Inner *const new_root = new_node<Inner>();
+
+                    new_root->m_keys[0] = std::move(result.m_separator);
+                    new_root->m_children[0] = m_root;
+                    new_root->m_children[1] = result.m_split;
+                    new_root->m_count = 1;
+
+                    m_root = new_root;
+                }
+
+                m_length += result.m_added;
+            }
+
+            /**
+             * Remove an item.
+             *
+             * @param key The key.
+             *
+             * @return True if the item was removed, false if the key was not present.
+             */
+            bool remove(const key_type &key) {
+                if(!m_root || !remove_from(m_root, key)) {
+                    return false;
+                }
+
+                --m_length;
+
+                if(!m_root->m_count) {
+                    Node *const old_root = m_root;
+
+                    if(m_root->m_leaf) {
+                        m_root = nullptr;
+                        m_first = nullptr;
+                    } else {
+                        m_root = static_cast<Inner *>(m_root)->m_children[0];
+                    }
+
+                    free_node(old_root);
+                }
+
+                return true;
+            }
+
+            /**
+             * Remove all items.
+             */
+            void clear() {
+                if(m_root) {
+                    free_subtree(m_root);
+                }
+
+                m_root = nullptr;
+                m_first = nullptr;
+                m_length = 0;
+            }
+
+            /**
+             * Checks whether a key is present.
+             *
+             * @param key The key to check.
+             *
+             * @return True if the key is present in the map, false if not.
+             */
+            JLT_NODISCARD bool contains_key(const key_type &key) const { return get_value(key) != nullptr; }
+
+            /**
+             * Return a value for the given key.
+             *
+             * @param key The key.
+             *
+             * @return The value for the given key or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD const_pointer get_value(const key_type &key) const {
+                Leaf *const leaf = find_leaf(key);
+
+                if(leaf) {
+                    uint32_t const pos = lower_bound_in(leaf, key);
+
+                    if(pos < leaf->m_count && keys_equal(leaf->m_keys[pos], key)) {
+                        return &leaf->m_values[pos];
+                    }
+                }
+
+                return nullptr;
+            }
+
+            /**
+             * Return a value for the given key.
+             *
+             * @param key The key.
+             *
+             * @return The value for the given key or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD pointer get_value(const key_type &key) {
+                const BTreeMap *const self = this;
+
+                return const_cast<pointer>(self->get_value(key));
+            }
+
+            /**
+             * Return a value for the given key or a default value.
+             *
+             * @param key The key.
+             *
+             * @return The value for the given key or `default_value` if the key is not present.
+             */
+            JLT_NODISCARD const_reference
+            get_value_with_default(const key_type &key, const_reference default_value) const {
+                const_pointer const value = get_value(key);
+
+                return value ? *value : default_value;
+            }
+
+            /**
+             * Return the number of items.
+             */
+            JLT_NODISCARD size_t get_length() const { return m_length; }
+
+            /**
+             * Return an iterator to the first entry whose key is not ordered before `key`.
+             */
+            JLT_NODISCARD iterator lower_bound(const key_type &key) {
+                Leaf *const leaf = find_leaf(key);
+
+                return leaf ? iterator{leaf, lower_bound_in(leaf, key)} : end();
+            }
+
+            /**
+             * Return an iterator to the first entry whose key is not ordered before `key`.
+             */
+            JLT_NODISCARD const_iterator lower_bound(const key_type &key) const {
+                return const_cast<BTreeMap *>(this)->lower_bound(key);
+            }
+
+            /**
+             * Return an iterator to the first entry whose key is ordered after `key`.
+             */
+            JLT_NODISCARD iterator upper_bound(const key_type &key) {
+                Leaf *const leaf = find_leaf(key);
+
+                return leaf ? iterator{leaf, upper_bound_in(leaf, key)} : end();
+            }
+
+            /**
+             * Return an iterator to the first entry whose key is ordered after `key`.
+             */
+            JLT_NODISCARD const_iterator upper_bound(const key_type &key) const {
+                return const_cast<BTreeMap *>(this)->upper_bound(key);
+            }
+
+            /**
+             * Return the entries whose keys are in the range [`from`, `to`).
+             *
+             * @param from The first key of the range.
+             * @param to The key past the end of the range.
+             */
+            JLT_NODISCARD range_type range(const key_type &from, const key_type &to) {
+                return range_type{lower_bound(from), lower_bound(to)};
+            }
+
+            /**
+             * Return the entries whose keys are in the range [`from`, `to`).
+             *
+             * @param from The first key of the range.
+             * @param to The key past the end of the range.
+             */
+            JLT_NODISCARD const_range_type range(const key_type &from, const key_type &to) const {
+                return const_range_type{lower_bound(from), lower_bound(to)};
+            }
+
+            JLT_NODISCARD iterator begin() { return iterator{m_first, 0}; }
+            JLT_NODISCARD iterator end() { return iterator{nullptr, 0}; }
+
+            JLT_NODISCARD const_iterator begin() const { return const_iterator{m_first, 0}; }
+            JLT_NODISCARD const_iterator end() const { return const_iterator{nullptr, 0}; }
+
+            JLT_NODISCARD const_iterator cbegin() const { return const_iterator{m_first, 0}; }
+            JLT_NODISCARD const_iterator cend() const { return const_iterator{nullptr, 0}; }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_BTREEMAP_HPP */
@@ -0,0 +1,33 @@
+#ifndef JLT_COLLECTIONS_COMPARATOR_HPP
+#define JLT_COLLECTIONS_COMPARATOR_HPP
+
+#include <jolt/api.hpp>
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Default ordering for ordered collections, based on `operator<`.
+         *
+         * Custom comparators must provide a static `compare()` function with the same signature,
+         * returning true if the left value is ordered before the right value.
+         */
+        struct Less {
+            template<typename T>
+            JLT_NODISCARD static constexpr bool compare(const T &left, const T &right) {
+                return left < right;
+            }
+        };
+
+        /**
+         * Reverse ordering for ordered collections, based on `operator<`.
+         */
+        struct Greater {
+            template<typename T>
+            JLT_NODISCARD static constexpr bool compare(const T &left, const T &right) {
+                return right < left;
+            }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_COMPARATOR_HPP */
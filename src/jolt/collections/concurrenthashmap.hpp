@@ -0,0 +1,605 @@
+#ifndef JLT_COLLECTIONS_CONCURRENTHASHMAP_HPP
+#define JLT_COLLECTIONS_CONCURRENTHASHMAP_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <emmintrin.h>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/hash.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/lock.hpp>
+#include <jolt/threading/lockguard.hpp>
+#include "keyvaluepair.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Hash map that can be read and modified by many threads at once.
+         *
+         * The map is split into a fixed number of stripes, selected by the key hash. Each stripe is an
+         * open-addressing table with its own lock, so writers only contend when they hit the same
+         * stripe, and a stripe can grow without blocking the others.
+         *
+         * When both the key and value types are trivially copyable, reads never take a lock: each
+         * stripe carries a sequence number that writers bump before and after every change, and
+         * readers copy the pair out and retry if the sequence number changed meanwhile. Tables
+         * replaced by a resize are retired rather than freed, so that a reader racing with the resize
+         * never touches freed memory. Each stripe counts the readers probing it, and its retired tables
+         * are freed by the next change to the stripe that finds no reader in it, so at most the tables
+         * retired while readers were continuously present are kept. For other types, reads take the
+         * stripe lock.
+         *
+         * Lookups return copies of the values, since a pointer into the map could be invalidated by
+         * another thread at any time. Use `update()` to modify a value in place.
+         *
+         * @tparam K The key type.
+         * @tparam T The value type.
+         * @tparam H The hash computation class type.
+         */
+        template<typename K, typename T, typename H = jolt::hash::XXHash>
+        class ConcurrentHashMap {
+          public:
+            using key_type = K;
+            using value_type = T;
+            using reference = T &;
+            using const_reference = const T &;
+            using pair_type = KeyValuePair<K, T>;
+
+            static constexpr size_t DEFAULT_STRIPE_COUNT = 16; //< Default number of stripes.
+            static constexpr size_t DEFAULT_CAPACITY = 16;     //< Default initial capacity of each stripe.
+
+            /**
+             * Whether lookups run without taking any lock.
+             */
+            static constexpr bool LOCK_FREE_READS =
+              std::is_trivially_copyable<K>::value && std::is_trivially_copyable<T>::value;
+
+          private:
+            enum SlotState : uint8_t { SLOT_EMPTY = 0, SLOT_FULL = 1, SLOT_DELETED = 2 };
+
+            static constexpr size_t NOT_FOUND = ~static_cast<size_t>(0);
+
+            /**
+             * Open-addressing table of a stripe.
+             */
+            struct Table {
+                Table *m_next_retired; //< Next table in the list of retired tables.
+                size_t m_capacity;     //< Number of slots, a power of two.
+                uint8_t *m_states;     //< State of each slot.
+                pair_type *m_pairs;    //< Slot pairs, constructed only where the state is `SLOT_FULL`.
+            };
+
+            /**
+             * A stripe. Aligned to a cache line, so that writers of neighbouring stripes don't
+             * contend for the same line.
+             */
+            struct alignas(memory::CACHE_LINE_SIZE) Segment {
+                threading::Lock m_lock;            //< Writers lock.
+                std::atomic<uint32_t> m_version;   //< Sequence number, odd while a change is in progress.
+                std::atomic<Table *> m_table;      //< Current table.
+                size_t m_length;                   //< Number of pairs.
+                size_t m_n_deleted;                //< Number of slots in the `SLOT_DELETED` state.
+                Table *m_retired;                  //< Tables replaced by a resize.
+                std::atomic<uint32_t> m_n_readers; //< Number of lock-free readers probing the stripe.
+
+                Segment() : m_lock{threading::LockSite{"ConcurrentHashMap::Segment"}} {}
+            };
+
+            /**
+             * Exclusive access to a stripe for modification.
+             */
+            class WriteGuard {
+                Segment &m_segment;
+
+              public:
+                explicit WriteGuard(Segment &segment) : m_segment{segment} {
+                    m_segment.m_lock.acquire();
+
+                    if constexpr(LOCK_FREE_READS) {
+                        m_segment.m_version.store(
+                          m_segment.m_version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                        std::atomic_thread_fence(std::memory_order_release);
+                    }
+                }
+
+                WriteGuard(WriteGuard const &) = delete;
+                WriteGuard &operator=(WriteGuard const &) = delete;
+
+                ~WriteGuard() {
+                    if constexpr(LOCK_FREE_READS) {
+                        free_retired_tables(m_segment);
+
+                        m_segment.m_version.store(
+                          m_segment.m_version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                    }
+
+                    m_segment.m_lock.release();
+                }
+            };
+
+            Segment **m_segments; //< The stripes.
+            size_t m_stripe_bits; //< Log2 of the number of stripes.
+
+            JLT_NODISCARD static hash::hash_t compute_hash(key_type const &key) {
+                // Spread the bits, as the hash function may be weak (e.g. identity)
+                return H::hash(&key, sizeof(key)) * 0x9E3779B97F4A7C15ull;
+            }
+
+            JLT_NODISCARD Segment &get_segment(hash::hash_t const hash) const {
+                return *m_segments[m_stripe_bits ? static_cast<size_t>(hash >> (64 - m_stripe_bits)) : 0];
+            }
+
+            JLT_NODISCARD static size_t get_home_slot(Table const &table, hash::hash_t const hash) {
+                return static_cast<size_t>(hash ^ (hash >> 32)) & (table.m_capacity - 1);
+            }
+
+            JLT_NODISCARD static Table *create_table(size_t const capacity) {
+                Table *const table = memory::allocate<Table>();
+
+                table->m_next_retired = nullptr;
+                table->m_capacity = capacity;
+                table->m_states = memory::allocate_array<uint8_t>(capacity);
+                table->m_pairs = memory::allocate_array<pair_type>(capacity);
+
+                memset(table->m_states, SLOT_EMPTY, capacity);
+
+                return table;
+            }
+
+            static void destroy_table(Table *const table) {
+                if constexpr(!std::is_trivially_destructible<pair_type>::value) {
+                    for(size_t i = 0; i < table->m_capacity; ++i) {
+                        if(table->m_states[i] == SLOT_FULL) {
+                            table->m_pairs[i].~pair_type();
+                        }
+                    }
+                }
+
+                memory::free_array(table->m_pairs, 0);
+                memory::free_array(table->m_states);
+                memory::free(table);
+            }
+
+            /**
+             * Free the retired tables of a stripe, unless a reader may still be probing them. The
+             * caller must hold the stripe's lock.
+             */
+            static void free_retired_tables(Segment &segment) {
+                // Readers register before loading the table: once none is registered, a new reader
+                // can only load the current table
+                if(!segment.m_retired || segment.m_n_readers.load(std::memory_order_seq_cst)) {
+                    return;
+                }
+
+                while(Table *const table = segment.m_retired) {
+                    segment.m_retired = table->m_next_retired;
+
+                    // Pairs were moved out when the table was retired
+                    memory::free_array(table->m_pairs, 0);
+                    memory::free_array(table->m_states);
+                    memory::free(table);
+                }
+            }
+
+            /**
+             * Find the slot containing a key.
+             *
+             * @return The index of the slot or `NOT_FOUND`.
+             */
+            JLT_NODISCARD static size_t
+            find_slot(Table const &table, key_type const &key, hash::hash_t const hash) {
+                size_t const mask = table.m_capacity - 1;
+
+                for(size_t i = 0, slot = get_home_slot(table, hash); i < table.m_capacity;
+                    ++i, slot = (slot + 1) & mask) {
+                    switch(table.m_states[slot]) {
+                        case SLOT_EMPTY:
+                            return NOT_FOUND;
+
+                        case SLOT_FULL:
+                            if(table.m_pairs[slot].get_key() == key) {
+                                return slot;
+                            }
+                            break;
+
+                        default:
+                            break;
+                    }
+                }
+
+                return NOT_FOUND;
+            }
+
+            /**
+             * Find the slot where a key that isn't in the table can be stored.
+             */
+            JLT_NODISCARD static size_t find_free_slot(Table const &table, hash::hash_t const hash) {
+                size_t const mask = table.m_capacity - 1;
+                size_t slot = get_home_slot(table, hash);
+
+                while(table.m_states[slot] == SLOT_FULL) { slot = (slot + 1) & mask; }
+
+                return slot;
+            }
+
+            /**
+             * Ensure a stripe has room for one more pair, rebuilding its table if needed. The caller
+             * must hold the stripe's write guard.
+             */
+            static void ensure_capacity(Segment &segment) {
+                Table *const old_table = segment.m_table.load(std::memory_order_relaxed);
+                size_t const capacity = old_table->m_capacity;
+
+                // Keep the load factor - tombstones included - below 3/4
+                if((segment.m_length + segment.m_n_deleted + 1) * 4 <= capacity * 3) {
+                    return;
+                }
+
+                size_t const new_capacity =
+                  choose(capacity * 2, capacity, (segment.m_length + 1) * 2 > capacity);
+                Table *const new_table = create_table(new_capacity);
+
+                for(size_t i = 0; i < capacity; ++i) {
+                    if(old_table->m_states[i] == SLOT_FULL) {
+                        pair_type &pair = old_table->m_pairs[i];
+                        size_t const slot = find_free_slot(*new_table, compute_hash(pair.get_key()));
+
+                        memory::construct(new_table->m_pairs + slot, std::move(pair));
+                        new_table->m_states[slot] = SLOT_FULL;
+                    }
+                }
+
+                // Ordered before the reader count check in `free_retired_tables()`
+                segment.m_table.store(new_table, std::memory_order_seq_cst);
+                segment.m_n_deleted = 0;
+
+                if constexpr(LOCK_FREE_READS) {
+                    // Readers may still be probing the old table
+                    old_table->m_next_retired = segment.m_retired;
+                    segment.m_retired = old_table;
+                } else {
+                    destroy_table(old_table);
+                }
+            }
+
+            /**
+             * Look up a key and copy its value out.
+             *
+             * @return True if the key is present, false if not.
+             */
+            bool read_value(key_type const &key, value_type *const out) const {
+                hash::hash_t const hash = compute_hash(key);
+                Segment &segment = get_segment(hash);
+
+                if constexpr(LOCK_FREE_READS) {
+                    alignas(value_type) uint8_t value_buf[sizeof(value_type)] = {};
+
+                    // Keep the tables retired from now on alive until the reader is done
+                    segment.m_n_readers.fetch_add(1, std::memory_order_seq_cst);
+
+                    while(true) {
+                        uint32_t const version = segment.m_version.load(std::memory_order_acquire);
+
+                        if(version & 1) {
+                            _mm_pause(); // A writer is busy
+                            continue;
+                        }
+
+                        Table const &table = *segment.m_table.load(std::memory_order_seq_cst);
+                        size_t const slot = find_slot(table, key, hash);
+
+                        if(slot != NOT_FOUND && out) {
+                            memcpy(value_buf, &table.m_pairs[slot].get_value(), sizeof(value_type));
+                        }
+
+                        std::atomic_thread_fence(std::memory_order_acquire);
+
+                        if(segment.m_version.load(std::memory_order_relaxed) == version) {
+                            segment.m_n_readers.fetch_sub(1, std::memory_order_release);
+
+                            if(slot != NOT_FOUND && out) {
+                                memcpy(static_cast<void *>(out), value_buf, sizeof(value_type));
+                            }
+
+                            return slot != NOT_FOUND;
+                        }
+                    }
+                } else {
+                    threading::LockGuard<threading::Lock> lock{segment.m_lock};
+                    Table const &table = *segment.m_table.load(std::memory_order_relaxed);
+                    size_t const slot = find_slot(table, key, hash);
+
+                    if(slot != NOT_FOUND && out) {
+                        *out = table.m_pairs[slot].get_value();
+                    }
+
+                    return slot != NOT_FOUND;
+                }
+            }
+
+            /**
+             * Store a value for a key.
+             *
+             * @param overwrite Whether to overwrite the value if the key is already present.
+             *
+             * @return True if the key has been added, false if it was already present.
+             */
+            bool write_value(key_type const &key, const_reference value, bool const overwrite) {
+                hash::hash_t const hash = compute_hash(key);
+                Segment &segment = get_segment(hash);
+                WriteGuard guard{segment};
+                Table *table = segment.m_table.load(std::memory_order_relaxed);
+                size_t slot = find_slot(*table, key, hash);
+
+                if(slot != NOT_FOUND) {
+                    if(overwrite) {
+                        table->m_pairs[slot].set_value(value);
+                    }
+
+                    return false;
+                }
+
+                ensure_capacity(segment);
+
+                table = segment.m_table.load(std::memory_order_relaxed);
+                slot = find_free_slot(*table, hash);
+
+                segment.m_n_deleted -= table->m_states[slot] == SLOT_DELETED;
+                memory::construct(table->m_pairs + slot, key, value);
+                table->m_states[slot] = SLOT_FULL;
+                ++segment.m_length;
+
+                return true;
+            }
+
+          public:
+            /**
+             * Create a new concurrent hash map.
+             *
+             * @param stripe_count The number of stripes. It will be rounded up to the next power of two.
+             * @param capacity The initial capacity of each stripe. It will be rounded up to the next
+             * power of two.
+             *
+             * @remarks More stripes reduce contention between writers at the cost of some memory.
+             */
+            explicit ConcurrentHashMap(
+              size_t const stripe_count = DEFAULT_STRIPE_COUNT, size_t const capacity = DEFAULT_CAPACITY) :
+              m_stripe_bits{static_cast<size_t>(std::bit_width(max<size_t>(stripe_count, 1) - 1))} {
+                size_t const n_stripes = static_cast<size_t>(1) << m_stripe_bits;
+                size_t const table_capacity = std::bit_ceil(max<size_t>(capacity, 4));
+
+                m_segments = memory::allocate_array<Segment *>(n_stripes);
+
+                for(size_t i = 0; i < n_stripes; ++i) {
+                    Segment *const segment = memory::allocate_and_construct<Segment>();
+
+                    segment->m_version.store(0, std::memory_order_relaxed);
+                    segment->m_table.store(create_table(table_capacity), std::memory_order_relaxed);
+                    segment->m_length = 0;
+                    segment->m_n_deleted = 0;
+                    segment->m_retired = nullptr;
+                    segment->m_n_readers.store(0, std::memory_order_relaxed);
+
+                    m_segments[i] = segment;
+                }
+            }
+
+            ConcurrentHashMap(ConcurrentHashMap const &) = delete;
+            ConcurrentHashMap &operator=(ConcurrentHashMap const &) = delete;
+
+            ~ConcurrentHashMap() {
+                reclaim();
+
+                for(size_t i = 0, n = get_stripe_count(); i < n; ++i) {
+                    destroy_table(m_segments[i]->m_table.load(std::memory_order_relaxed));
+                    memory::free(m_segments[i]);
+                }
+
+                memory::free_array(m_segments);
+            }
+
+            /**
+             * Set the value for a key, adding the key if not present.
+             *
+             * @param key The key.
+             * @param value The value.
+             */
+            void set_value(key_type const &key, const_reference value) { write_value(key, value, true); }
+
+            /**
+             * Add a key/value pair.
+             *
+             * @param key The key.
+             * @param value The value.
+             *
+             * @remarks This is an alias to `set_value()`.
+             */
+            void add(key_type const &key, const_reference value) { set_value(key, value); }
+
+            /**
+             * Add a key/value pair only if the key is not present yet.
+             *
+             * @param key The key.
+             * @param value The value.
+             *
+             * @return True if the pair has been added, false if the key was already present.
+             */
+            bool add_if_absent(key_type const &key, const_reference value) {
+                return write_value(key, value, false);
+            }
+
+            /**
+             * Copy the value for a key.
+             *
+             * @param key The key.
+             * @param out The variable that will receive the value, if the key is present.
+             *
+             * @return True if the key is present, false if not.
+             */
+            bool get_value(key_type const &key, reference out) const { return read_value(key, &out); }
+
+            /**
+             * Return the value for a key or a default value.
+             *
+             * @param key The key.
+             * @param default_value The value to return if the key is not present.
+             */
+            JLT_NODISCARD value_type
+            get_value_with_default(key_type const &key, const_reference default_value) const {
+                value_type result = default_value;
+
+                read_value(key, &result);
+
+                return result;
+            }
+
+            /**
+             * Checks whether a key is present.
+             *
+             * @param key The key to check.
+             */
+            JLT_NODISCARD bool contains_key(key_type const &key) const { return read_value(key, nullptr); }
+
+            /**
+             * Modify the value for a key in place.
+             *
+             * @param key The key.
+             * @param func The function to call on the value, with signature `void(T &value)`. It's
+             * called with the stripe locked and must not access the map.
+             *
+             * @return True if the key is present, false if not.
+             */
+            template<typename F>
+            bool update(key_type const &key, F &&func) {
+                hash::hash_t const hash = compute_hash(key);
+                Segment &segment = get_segment(hash);
+                WriteGuard guard{segment};
+                Table &table = *segment.m_table.load(std::memory_order_relaxed);
+                size_t const slot = find_slot(table, key, hash);
+
+                if(slot == NOT_FOUND) {
+                    return false;
+                }
+
+                func(table.m_pairs[slot].get_value());
+
+                return true;
+            }
+
+            /**
+             * Remove a key.
+             *
+             * @param key The key.
+             *
+             * @return True if the key was present, false if not.
+             */
+            bool remove(key_type const &key) {
+                hash::hash_t const hash = compute_hash(key);
+                Segment &segment = get_segment(hash);
+                WriteGuard guard{segment};
+                Table &table = *segment.m_table.load(std::memory_order_relaxed);
+                size_t const slot = find_slot(table, key, hash);
+
+                if(slot == NOT_FOUND) {
+                    return false;
+                }
+
+                table.m_pairs[slot].~pair_type();
+                table.m_states[slot] = SLOT_DELETED;
+                --segment.m_length;
+                ++segment.m_n_deleted;
+
+                return true;
+            }
+
+            /**
+             * Remove all the pairs.
+             */
+            void clear() {
+                for(size_t i = 0, n = get_stripe_count(); i < n; ++i) {
+                    Segment &segment = *m_segments[i];
+                    WriteGuard guard{segment};
+                    Table &table = *segment.m_table.load(std::memory_order_relaxed);
+
+                    for(size_t j = 0; j < table.m_capacity; ++j) {
+                        if(table.m_states[j] == SLOT_FULL) {
+                            table.m_pairs[j].~pair_type();
+                        }
+
+                        table.m_states[j] = SLOT_EMPTY;
+                    }
+
+                    segment.m_length = 0;
+                    segment.m_n_deleted = 0;
+                }
+            }
+
+            /**
+             * Call a function on each pair.
+             *
+             * @param func The function to call, with signature `void(K const &key, T const &value)`.
+             * It's called with the pair's stripe locked and must not access the map.
+             *
+             * @remarks Each stripe is visited atomically, but changes to other stripes can happen while
+             * the iteration is in progress.
+             */
+            template<typename F>
+            void for_each(F &&func) const {
+                for(size_t i = 0, n = get_stripe_count(); i < n; ++i) {
+                    Segment &segment = *m_segments[i];
+                    threading::LockGuard<threading::Lock> lock{segment.m_lock};
+                    Table const &table = *segment.m_table.load(std::memory_order_relaxed);
+
+                    for(size_t j = 0; j < table.m_capacity; ++j) {
+                        if(table.m_states[j] == SLOT_FULL) {
+                            func(table.m_pairs[j].get_key(), table.m_pairs[j].get_value());
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Free the tables retired by resizes that no reader is probing anymore.
+             *
+             * @remarks Retired tables are also freed by the changes to their stripe, so this is only
+             * needed to release them early, e.g. once readers are done after a burst of writes.
+             */
+            void reclaim() {
+                for(size_t i = 0, n = get_stripe_count(); i < n; ++i) {
+                    Segment &segment = *m_segments[i];
+                    threading::LockGuard<threading::Lock> lock{segment.m_lock};
+
+                    free_retired_tables(segment);
+                }
+            }
+
+            /**
+             * Return the number of pairs.
+             *
+             * @remarks The result is only a snapshot when other threads are modifying the map.
+             */
+            JLT_NODISCARD size_t get_length() const {
+                size_t result = 0;
+
+                for(size_t i = 0, n = get_stripe_count(); i < n; ++i) {
+                    Segment &segment = *m_segments[i];
+                    threading::LockGuard<threading::Lock> lock{segment.m_lock};
+
+                    result += segment.m_length;
+                }
+
+                return result;
+            }
+
+            JLT_NODISCARD size_t get_stripe_count() const { return static_cast<size_t>(1) << m_stripe_bits; }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_CONCURRENTHASHMAP_HPP */
@@ -0,0 +1,436 @@
+#ifndef JLT_COLLECTIONS_DEQUE_HPP
+#define JLT_COLLECTIONS_DEQUE_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Iterator implementation for the double-ended queue.
+         *
+         * @tparam D The deque type, possibly const-qualified.
+         */
+        template<typename D>
+        struct DequeIterator {
+            using value_type = typename std::conditional<
+              std::is_const<D>::value,
+              const typename std::remove_const<D>::type::value_type,
+              typename std::remove_const<D>::type::value_type>::type;
+
+          private:
+            template<typename A>
+            friend struct DequeIterator;
+
+            D *m_deque;     //< The deque being iterated.
+            size_t m_index; //< Index of the current item.
+
+          public:
+            DequeIterator(D *const deque, size_t const index) : m_deque{deque}, m_index{index} {}
+
+            template<typename A>
+            DequeIterator(const DequeIterator<A> &other) : m_deque{other.m_deque}, m_index{other.m_index} {}
+
+            DequeIterator &operator++() {
+                ++m_index;
+
+                return *this;
+            }
+
+            DequeIterator operator++(int) {
+                DequeIterator other = *this;
+
+                ++m_index;
+
+                return other;
+            }
+
+            DequeIterator &operator--() {
+                --m_index;
+
+                return *this;
+            }
+
+            DequeIterator operator--(int) {
+                DequeIterator other = *this;
+
+                --m_index;
+
+                return other;
+            }
+
+            JLT_NODISCARD DequeIterator operator+(size_t const n) const {
+                return DequeIterator{m_deque, m_index + n};
+            }
+
+            JLT_NODISCARD DequeIterator operator-(size_t const n) const {
+                return DequeIterator{m_deque, m_index - n};
+            }
+
+            template<typename It>
+            JLT_NODISCARD constexpr bool operator==(const It &other) const {
+                return m_index == other.m_index;
+            }
+
+            template<typename It>
+            JLT_NODISCARD constexpr bool operator!=(const It &other) const {
+                return m_index != other.m_index;
+            }
+
+            JLT_NODISCARD value_type &operator*() const { return (*m_deque)[m_index]; }
+
+            JLT_NODISCARD size_t get_index() const { return m_index; }
+        };
+
+        /**
+         * A growable double-ended queue.
+         *
+         * The items are stored in a ring buffer whose capacity is always a power of two, allowing
+         * constant time insertion and removal at both ends and constant time indexed access. When
+         * the ring is full, its content is moved into a new one with double the capacity.
+         */
+        template<typename T>
+        class Deque {
+          public:
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+
+            using iterator = DequeIterator<Deque<T>>;
+            using const_iterator = DequeIterator<const Deque<T>>;
+
+            static constexpr size_t DEFAULT_CAPACITY = 16; //< The default capacity.
+
+          private:
+            pointer m_data;                //< Pointer to the ring buffer.
+            size_t m_capacity;             //< Capacity of the ring buffer, a power of two.
+            size_t m_head;                 //< Index of the first item in the ring buffer.
+            size_t m_length;               //< Number of items.
+            memory::flags_t m_alloc_flags; //< Allocation flags.
+
+            /**
+             * Return the position in the ring buffer of the item at a given index.
+             */
+            JLT_NODISCARD size_t get_slot(size_t const i) const { return (m_head + i) & (m_capacity - 1); }
+
+            /**
+             * Allocate a ring buffer with the allocation flags of this deque.
+             */
+            JLT_NODISCARD pointer allocate_storage(size_t const capacity) const {
+                memory::push_force_flags(m_alloc_flags);
+                pointer const data = memory::allocate_array<value_type>(capacity);
+                memory::pop_force_flags();
+
+                return data;
+            }
+
+            /**
+             * Return the capacity to grow to once the ring buffer is full.
+             */
+            JLT_NODISCARD size_t get_grown_capacity() const { return max(m_capacity * 2, DEFAULT_CAPACITY); }
+
+            /**
+             * Move the content into a new ring buffer.
+             *
+             * @param new_capacity The capacity of the new ring buffer. Must be a power of two not lower
+             * than the length.
+             */
+            void relocate(size_t const new_capacity) {
+                relocate(allocate_storage(new_capacity), new_capacity);
+            }
+
+            /**
+             * Move the content into a new ring buffer, starting at its first position.
+             *
+             * @param new_data The new ring buffer.
+             * @param new_capacity The capacity of the new ring buffer. Must be a power of two not lower
+             * than the length.
+             */
+            void relocate(pointer const new_data, size_t const new_capacity) {
+                if(m_length) {
+                    size_t const first_len = min(m_length, m_capacity - m_head);
+
+                    if constexpr(std::is_trivially_copyable<value_type>::value) {
+                        memcpy(new_data, m_data + m_head, first_len * sizeof(value_type));
+                        memcpy(new_data + first_len, m_data, (m_length - first_len) * sizeof(value_type));
+                    } else {
+                        for(size_t i = 0; i < m_length; ++i) {
+                            pointer const item = m_data + get_slot(i);
+
+                            memory::construct(new_data + i, std::move(*item));
+                            item->~value_type();
+                        }
+                    }
+                }
+
+                dispose_storage();
+
+                m_data = new_data;
+                m_capacity = new_capacity;
+                m_head = 0;
+            }
+
+            /**
+             * Free the ring buffer without destroying any item.
+             */
+            void dispose_storage() {
+                if(m_data) {
+                    memory::free_array(m_data, 0);
+
+                    m_data = nullptr;
+                }
+            }
+
+            void copy_from(Deque const &other) {
+                for(size_t i = 0; i < other.m_length; ++i) {
+                    memory::construct(m_data + i, other.m_data[other.get_slot(i)]);
+                }
+
+                m_head = 0;
+                m_length = other.m_length;
+            }
+
+          public:
+            /**
+             * Create a new empty deque.
+             *
+             * @param initial_capacity The number of items the deque will be able to hold before
+             * growing. It will be rounded up to the next power of two.
+             */
+            JLT_NODISCARD explicit Deque(size_t const initial_capacity = DEFAULT_CAPACITY) :
+              m_data{nullptr}, m_capacity{std::bit_ceil(max<size_t>(initial_capacity, 1))}, m_head{0},
+              m_length{0}, m_alloc_flags{memory::get_current_force_flags()} {
+                m_data = memory::allocate_array<value_type>(m_capacity);
+            }
+
+            JLT_NODISCARD Deque(Deque const &other) :
+              m_data{nullptr}, m_capacity{other.m_capacity}, m_head{0}, m_length{0},
+              m_alloc_flags{other.m_alloc_flags} {
+                m_data = allocate_storage(m_capacity);
+
+                copy_from(other);
+            }
+
+            JLT_NODISCARD Deque(Deque &&other) :
+              m_data{other.m_data}, m_capacity{other.m_capacity}, m_head{other.m_head},
+              m_length{other.m_length}, m_alloc_flags{other.m_alloc_flags} {
+                other.m_data = nullptr;
+                other.m_capacity = other.m_head = other.m_length = 0;
+            }
+
+            ~Deque() {
+                clear();
+                dispose_storage();
+            }
+
+            Deque &operator=(Deque const &other) {
+                if(this != &other) {
+                    clear();
+
+                    if(m_capacity < other.m_length) {
+                        dispose_storage();
+
+                        m_data = allocate_storage(other.m_capacity);
+                        m_capacity = other.m_capacity;
+                    }
+
+                    copy_from(other);
+                }
+
+                return *this;
+            }
+
+            Deque &operator=(Deque &&other) {
+                if(this != &other) {
+                    clear();
+                    dispose_storage();
+
+                    m_data = other.m_data;
+                    m_capacity = other.m_capacity;
+                    m_head = other.m_head;
+                    m_length = other.m_length;
+                    m_alloc_flags = other.m_alloc_flags;
+
+                    other.m_data = nullptr;
+                    other.m_capacity = other.m_head = other.m_length = 0;
+                }
+
+                return *this;
+            }
+
+            /**
+             * Add an item at the end of the deque.
+             *
+             * @param item The item to add.
+             */
+            void push_back(const_reference item) { emplace_back(item); }
+            void push_back(value_type &&item) { emplace_back(std::move(item)); }
+
+            /**
+             * Add an item at the beginning of the deque.
+             *
+             * @param item The item to add.
+             */
+            void push_front(const_reference item) { emplace_front(item); }
+            void push_front(value_type &&item) { emplace_front(std::move(item)); }
+
+            /**
+             * Construct an item at the end of the deque.
+             *
+             * @param params The parameters to pass to the item's constructor. They may refer to items
+             * of this deque.
+             *
+             * @return A reference to the new item.
+             */
+            template<typename... Params>
+            reference emplace_back(Params &&...params) {
+                pointer item;
+
+                if(m_length < m_capacity) {
+                    item = memory::construct(m_data + get_slot(m_length), std::forward<Params>(params)...);
+                } else {
+                    // Construct the item before the old ring buffer is freed, as the parameters may
+                    // refer to its content
+                    size_t const new_capacity = get_grown_capacity();
+                    pointer const new_data = allocate_storage(new_capacity);
+
+                    item = memory::construct(new_data + m_length, std::forward<Params>(params)...);
+                    relocate(new_data, new_capacity);
+                }
+
+                ++m_length;
+
+                return *item;
+            }
+
+            /**
+             * Construct an item at the beginning of the deque.
+             *
+             * @param params The parameters to pass to the item's constructor. They may refer to items
+             * of this deque.
+             *
+             * @return A reference to the new item.
+             */
+            template<typename... Params>
+            reference emplace_front(Params &&...params) {
+                pointer item;
+
+                if(m_length < m_capacity) {
+                    size_t const new_head = (m_head - 1) & (m_capacity - 1);
+
+                    item = memory::construct(m_data + new_head, std::forward<Params>(params)...);
+                    m_head = new_head;
+                } else {
+                    // Construct the item before the old ring buffer is freed, as the parameters may
+                    // refer to its content. It goes in the last position, wrapping around to the
+                    // items moved to the beginning.
+                    size_t const new_capacity = get_grown_capacity();
+                    pointer const new_data = allocate_storage(new_capacity);
+
+                    item = memory::construct(new_data + new_capacity - 1, std::forward<Params>(params)...);
+                    relocate(new_data, new_capacity);
+                    m_head = new_capacity - 1;
+                }
+
+                ++m_length;
+
+                return *item;
+            }
+
+            /**
+             * Remove and return the first item.
+             */
+            value_type pop_front() {
+                jltassert2(m_length, "Attempting to pop from an empty deque");
+
+                pointer const item = m_data + m_head;
+                value_type result{std::move(*item)};
+
+                item->~value_type();
+
+                m_head = get_slot(1);
+                --m_length;
+
+                return result;
+            }
+
+            /**
+             * Remove and return the last item.
+             */
+            value_type pop_back() {
+                jltassert2(m_length, "Attempting to pop from an empty deque");
+
+                pointer const item = m_data + get_slot(m_length - 1);
+                value_type result{std::move(*item)};
+
+                item->~value_type();
+
+                --m_length;
+
+                return result;
+            }
+
+            /**
+             * Remove all the items.
+             */
+            void clear() {
+                if constexpr(!std::is_trivially_destructible<value_type>::value) {
+                    for(size_t i = 0; i < m_length; ++i) { m_data[get_slot(i)].~value_type(); }
+                }
+
+                m_head = 0;
+                m_length = 0;
+            }
+
+            /**
+             * Reserve some capacity.
+             *
+             * @param new_capacity The minimum capacity to reserve. It will be rounded up to the next
+             * power of two.
+             */
+            void reserve_capacity(size_t const new_capacity) {
+                if(new_capacity > m_capacity) {
+                    relocate(std::bit_ceil(new_capacity));
+                }
+            }
+
+            JLT_NODISCARD size_t get_length() const { return m_length; }
+            JLT_NODISCARD size_t get_capacity() const { return m_capacity; }
+
+            JLT_NODISCARD reference operator[](size_t const i) {
+                jltassert(i < m_length);
+
+                return m_data[get_slot(i)];
+            }
+
+            JLT_NODISCARD const_reference operator[](size_t const i) const {
+                jltassert(i < m_length);
+
+                return m_data[get_slot(i)];
+            }
+
+            JLT_NODISCARD reference get_first() { return (*this)[0]; }
+            JLT_NODISCARD const_reference get_first() const { return (*this)[0]; }
+            JLT_NODISCARD reference get_last() { return (*this)[m_length - 1]; }
+            JLT_NODISCARD const_reference get_last() const { return (*this)[m_length - 1]; }
+
+            JLT_NODISCARD iterator begin() { return iterator{this, 0}; }
+            JLT_NODISCARD iterator end() { return iterator{this, m_length}; }
+            JLT_NODISCARD const_iterator begin() const { return const_iterator{this, 0}; }
+            JLT_NODISCARD const_iterator end() const { return const_iterator{this, m_length}; }
+            JLT_NODISCARD const_iterator cbegin() const { return const_iterator{this, 0}; }
+            JLT_NODISCARD const_iterator cend() const { return const_iterator{this, m_length}; }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_DEQUE_HPP */
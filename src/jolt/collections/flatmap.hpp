@@ -0,0 +1,283 @@
+#ifndef JLT_COLLECTIONS_FLATMAP_HPP
+#define JLT_COLLECTIONS_FLATMAP_HPP
+
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include "vector.hpp"
+#include "keyvaluepair.hpp"
+#include "comparator.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Ordered map stored as a sorted vector of key/value pairs.
+         *
+         * Look-ups are binary searches over contiguous memory. Insertions and removals shift the
+         * following pairs, so this map is best suited to small or read-mostly tables.
+         *
+         * @tparam K The key type.
+         * @tparam T The value type.
+         * @tparam C The key comparator type.
+         */
+        template<typename K, typename T, typename C = Less>
+        class FlatMap {
+          public:
+            using key_type = K;
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+
+            using pair_type = KeyValuePair<K, T>;
+            using pair_pointer = KeyValuePair<K, T> *;
+            using const_pair_pointer = const KeyValuePair<K, T> *;
+
+            using iterator = typename Vector<pair_type>::iterator;
+            using const_iterator = typename Vector<pair_type>::const_iterator;
+
+            constexpr static size_t DEFAULT_CAPACITY = 16;
+
+          private:
+            Vector<pair_type> m_pairs; //< Pairs, sorted by key.
+
+            /**
+             * Return the index of the first pair whose key is not ordered before `key`.
+             */
+            JLT_NODISCARD size_t lower_bound_index(const key_type &key) const {
+                size_t first = 0, count = m_pairs.get_length();
+
+                while(count) {
+                    size_t const half = count / 2;
+                    size_t const mid = first + half;
+                    bool const go_right = C::compare(m_pairs[mid].get_key(), key);
+
+                    first = choose(mid + 1, first, go_right);
+                    count = choose(count - half - 1, half, go_right);
+                }
+
+                return first;
+            }
+
+            /**
+             * Return the index of the first pair whose key is ordered after `key`.
+             */
+            JLT_NODISCARD size_t upper_bound_index(const key_type &key) const {
+                size_t first = 0, count = m_pairs.get_length();
+
+                while(count) {
+                    size_t const half = count / 2;
+                    size_t const mid = first + half;
+                    bool const go_right = !C::compare(key, m_pairs[mid].get_key());
+
+                    first = choose(mid + 1, first, go_right);
+                    count = choose(count - half - 1, half, go_right);
+                }
+
+                return first;
+            }
+
+            /**
+             * Return the index of the pair with the given key or -1 if not present.
+             */
+            JLT_NODISCARD long long find_index(const key_type &key) const {
+                size_t const i = lower_bound_index(key);
+
+                if(i < m_pairs.get_length() && !C::compare(key, m_pairs[i].get_key())) {
+                    return static_cast<long long>(i);
+                }
+
+                return -1;
+            }
+
+          public:
+            /**
+             * Create a new flat map.
+             *
+             * @param capacity The number of pairs the map will be able to hold before resizing.
+             */
+            JLT_NODISCARD explicit FlatMap(size_t const capacity = DEFAULT_CAPACITY) : m_pairs(capacity) {}
+
+            JLT_NODISCARD FlatMap(const FlatMap &other) = default;
+            JLT_NODISCARD FlatMap(FlatMap &&other) = default;
+
+            FlatMap &operator=(const FlatMap &other) = default;
+            FlatMap &operator=(FlatMap &&other) = default;
+
+            /**
+             * Add a key/value pair.
+             *
+             * @param key The key.
+             * @param value The value.
+             *
+             * @remarks This is an alias to `set_value()`.
+             */
+            void add(const key_type &key, const value_type &value) { set_value(key, value); }
+
+            /**
+             * Set a key/value pair.
+             *
+             * @param key The key.
+             * @param value The value.
+             */
+            void set_value(const key_type &key, const value_type &value) {
+                size_t const i = lower_bound_index(key);
+
+                if(i < m_pairs.get_length() && !C::compare(key, m_pairs[i].get_key())) {
+                    m_pairs[i].set_value(value);
+                    return;
+                }
+
+                // Append and rotate into place, so existing pairs are always moved via assignment.
+                m_pairs.push(pair_type{key, value});
+
+                for(size_t j = m_pairs.get_length() - 1; j > i; --j) { std::swap(m_pairs[j], m_pairs[j - 1]); }
+            }
+
+            /**
+             * Checks whether a key is present.
+             *
+             * @param key The key to check.
+             *
+             * @return True if the key is present in the map, false if not.
+             */
+            JLT_NODISCARD bool contains_key(const key_type &key) const { return find_index(key) >= 0; }
+
+            /**
+             * Return a key/value pair for a given key.
+             *
+             * @param key The key.
+             *
+             * @return The key/value pair for the given key or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD const_pair_pointer get_pair(const key_type &key) const {
+                long long const i = find_index(key);
+
+                return i >= 0 ? &m_pairs[i] : nullptr;
+            }
+
+            /**
+             * Return a key/value pair for a given key.
+             *
+             * @param key The key.
+             *
+             * @return The key/value pair for the given key or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD pair_pointer get_pair(const key_type &key) {
+                const FlatMap *const self = this;
+
+                return const_cast<pair_pointer>(self->get_pair(key));
+            }
+
+            /**
+             * Return a value for the given key.
+             *
+             * @param key The key.
+             *
+             * @return The value for the given key or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD const_pointer get_value(const key_type &key) const {
+                const_pair_pointer const pair = get_pair(key);
+
+                return pair ? &pair->get_value() : nullptr;
+            }
+
+            /**
+             * Return a value for the given key.
+             *
+             * @param key The key.
+             *
+             * @return The value for the given key or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD pointer get_value(const key_type &key) {
+                const FlatMap *const self = this;
+
+                return const_cast<pointer>(self->get_value(key));
+            }
+
+            /**
+             * Return a value for the given key or a default value.
+             *
+             * @param key The key.
+             *
+             * @return The value for the given key or `default_value` if the key is not present.
+             */
+            JLT_NODISCARD const_reference
+            get_value_with_default(const key_type &key, const_reference default_value) const {
+                const_pair_pointer const pair = get_pair(key);
+
+                return pair ? pair->get_value() : default_value;
+            }
+
+            /**
+             * Remove an item.
+             *
+             * @param key The key.
+             */
+            void remove(const key_type &key) {
+                long long const i = find_index(key);
+
+                if(i >= 0) {
+                    size_t const last = m_pairs.get_length() - 1;
+
+                    for(size_t j = static_cast<size_t>(i); j < last; ++j) { std::swap(m_pairs[j], m_pairs[j + 1]); }
+
+                    m_pairs.remove_at(last);
+                }
+            }
+
+            /**
+             * Remove all items.
+             */
+            void clear() { m_pairs.clear(); }
+
+            /**
+             * Reserve some capacity.
+             *
+             * @param new_capacity The minimum number of pairs to reserve space for.
+             */
+            void reserve_capacity(size_t const new_capacity) { m_pairs.reserve_capacity(new_capacity); }
+
+            /**
+             * Return the number of items.
+             */
+            JLT_NODISCARD size_t get_length() const { return m_pairs.get_length(); }
+
+            /**
+             * Return an iterator to the first pair whose key is not ordered before `key`.
+             */
+            JLT_NODISCARD iterator lower_bound(const key_type &key) { return begin() + lower_bound_index(key); }
+
+            /**
+             * Return an iterator to the first pair whose key is not ordered before `key`.
+             */
+            JLT_NODISCARD const_iterator lower_bound(const key_type &key) const {
+                return cbegin() + lower_bound_index(key);
+            }
+
+            /**
+             * Return an iterator to the first pair whose key is ordered after `key`.
+             */
+            JLT_NODISCARD iterator upper_bound(const key_type &key) { return begin() + upper_bound_index(key); }
+
+            /**
+             * Return an iterator to the first pair whose key is ordered after `key`.
+             */
+            JLT_NODISCARD const_iterator upper_bound(const key_type &key) const {
+                return cbegin() + upper_bound_index(key);
+            }
+
+            JLT_NODISCARD iterator begin() { return m_pairs.begin(); }
+            JLT_NODISCARD iterator end() { return m_pairs.end(); }
+
+            JLT_NODISCARD const_iterator begin() const { return m_pairs.begin(); }
+            JLT_NODISCARD const_iterator end() const { return m_pairs.end(); }
+
+            JLT_NODISCARD const_iterator cbegin() const { return m_pairs.cbegin(); }
+            JLT_NODISCARD const_iterator cend() const { return m_pairs.cend(); }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_FLATMAP_HPP */
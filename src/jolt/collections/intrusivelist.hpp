@@ -0,0 +1,266 @@
+#ifndef JLT_COLLECTIONS_INTRUSIVELIST_HPP
+#define JLT_COLLECTIONS_INTRUSIVELIST_HPP
+
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include "iterator.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Links embedded in an item that can be part of an intrusive list.
+         *
+         * An item can be part of as many intrusive lists as the hooks it contains, but each hook can
+         * only link the item into one list at a time.
+         *
+         * @tparam T The type of the item containing the hook.
+         */
+        template<typename T>
+        struct IntrusiveListHook {
+            T *m_next = nullptr; //< Next item in the list.
+            T *m_prev = nullptr; //< Previous item in the list.
+        };
+
+        template<typename T, IntrusiveListHook<T> T::*Hook>
+        struct IntrusiveListIteratorImpl {
+            using item_type = T;
+
+            template<typename Item>
+            static constexpr Item *forward(Item *const cur, size_t const n) {
+                Item *result = cur;
+
+                for(size_t i = 0; i < n; ++i) { result = (result->*Hook).m_next; }
+
+                return result;
+            }
+
+            template<typename Item>
+            static constexpr Item *backward(Item *const cur, size_t const n) {
+                Item *result = cur;
+
+                for(size_t i = 0; i < n; ++i) { result = (result->*Hook).m_prev; }
+
+                return result;
+            }
+
+            template<typename Item>
+            JLT_NODISCARD static constexpr auto &resolve(Item *const item) {
+                return *item;
+            }
+
+            template<typename Item>
+            JLT_NODISCARD static constexpr size_t
+            count_elements(Item const *const from, Item const *const to) {
+                size_t count = 0;
+
+                for(Item const *n = from; n != to && n; n = (n->*Hook).m_next) { ++count; }
+
+                return count;
+            }
+        };
+
+        /**
+         * Doubly linked list whose links live inside the items.
+         *
+         * The list never allocates: adding an item only links it through its hook, and removing an
+         * item only unlinks it, in O(1). The list doesn't own the items, which must outlive their
+         * membership in the list.
+         *
+         * @tparam T The type of item contained in the list.
+         * @tparam Hook Pointer to the `IntrusiveListHook` member of `T` used by this list.
+         */
+        template<typename T, IntrusiveListHook<T> T::*Hook>
+        class IntrusiveList {
+          public:
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+
+            template<typename E>
+            using base_iterator = Iterator<E, IntrusiveListIteratorImpl<T, Hook>>;
+            using iterator = base_iterator<T>;
+            using const_iterator = base_iterator<const T>;
+
+          private:
+            pointer m_first; //< First item in the list.
+            pointer m_last;  //< Last item in the list.
+            size_t m_length; //< List length.
+
+            JLT_NODISCARD static IntrusiveListHook<T> &hook(reference item) { return item.*Hook; }
+            JLT_NODISCARD static IntrusiveListHook<T> const &hook(const_reference item) { return item.*Hook; }
+
+          public:
+            /**
+             * Create a new empty list.
+             */
+            JLT_NODISCARD constexpr IntrusiveList() : m_first{nullptr}, m_last{nullptr}, m_length{0} {}
+
+            IntrusiveList(const IntrusiveList &) = delete;
+            IntrusiveList &operator=(const IntrusiveList &) = delete;
+
+            /**
+             * Create a new list, taking over the items of another.
+             *
+             * @param other The other list.
+             *
+             * @remarks After this constructor returns, the other list will be empty.
+             */
+            JLT_NODISCARD IntrusiveList(IntrusiveList &&other) :
+              m_first{other.m_first}, m_last{other.m_last}, m_length{other.m_length} {
+                other.m_first = other.m_last = nullptr;
+                other.m_length = 0;
+            }
+
+            ~IntrusiveList() { clear(); }
+
+            /**
+             * Add an item at the end of the list.
+             *
+             * @param item The item to add. It must not be part of a list through the same hook.
+             */
+            void push_back(reference item) { add_after(item, m_last); }
+
+            /**
+             * Add an item at the beginning of the list.
+             *
+             * @param item The item to add. It must not be part of a list through the same hook.
+             */
+            void push_front(reference item) { add_after(item, nullptr); }
+
+            /**
+             * Add an item right after another.
+             *
+             * @param item The item to add. It must not be part of a list through the same hook.
+             * @param where The item after which to add the new item. Use `nullptr` to add the item at
+             * the beginning of the list.
+             */
+            void add_after(reference item, pointer const where) {
+                IntrusiveListHook<T> &item_hook = hook(item);
+
+                jltassert2(
+                  !item_hook.m_next && !item_hook.m_prev && m_first != &item,
+                  "Attempting to add an item that is already linked");
+
+                item_hook.m_prev = where;
+
+                if(where) {
+                    IntrusiveListHook<T> &where_hook = hook(*where);
+
+                    item_hook.m_next = where_hook.m_next;
+                    where_hook.m_next = &item;
+                } else {
+                    item_hook.m_next = m_first;
+                    m_first = &item;
+                }
+
+                if(item_hook.m_next) {
+                    hook(*item_hook.m_next).m_prev = &item;
+                } else {
+                    m_last = &item;
+                }
+
+                ++m_length;
+            }
+
+            /**
+             * Remove an item from the list.
+             *
+             * @param item The item to remove. It must be part of this list.
+             */
+            void remove(reference item) {
+                IntrusiveListHook<T> &item_hook = hook(item);
+
+                jltassert2(contains(item), "Attempting to remove an item that is not part of this list");
+
+                if(item_hook.m_prev) {
+                    hook(*item_hook.m_prev).m_next = item_hook.m_next;
+                } else {
+                    m_first = item_hook.m_next;
+                }
+
+                if(item_hook.m_next) {
+                    hook(*item_hook.m_next).m_prev = item_hook.m_prev;
+                } else {
+                    m_last = item_hook.m_prev;
+                }
+
+                item_hook.m_next = item_hook.m_prev = nullptr;
+                --m_length;
+            }
+
+            /**
+             * Remove and return the first item of the list.
+             *
+             * @return The first item or `nullptr` if the list is empty.
+             */
+            pointer pop_front() {
+                pointer const item = m_first;
+
+                if(item) {
+                    remove(*item);
+                }
+
+                return item;
+            }
+
+            /**
+             * Remove and return the last item of the list.
+             *
+             * @return The last item or `nullptr` if the list is empty.
+             */
+            pointer pop_back() {
+                pointer const item = m_last;
+
+                if(item) {
+                    remove(*item);
+                }
+
+                return item;
+            }
+
+            /**
+             * Unlink all the items from the list.
+             */
+            void clear() {
+                while(pop_front()) {}
+            }
+
+            /**
+             * Check whether an item is part of this list.
+             *
+             * @param item The item to check.
+             *
+             * @remarks This runs in constant time and assumes the item is not part of another list
+             * through the same hook.
+             */
+            JLT_NODISCARD bool contains(const_reference item) const {
+                return hook(item).m_prev || m_first == &item;
+            }
+
+            JLT_NODISCARD size_t get_length() const { return m_length; }
+            JLT_NODISCARD pointer get_first() const { return m_first; }
+            JLT_NODISCARD pointer get_last() const { return m_last; }
+
+            /**
+             * Return the item following another in the list, or `nullptr` if it's the last one.
+             */
+            JLT_NODISCARD static pointer get_next(const_reference item) { return hook(item).m_next; }
+
+            /**
+             * Return the item preceding another in the list, or `nullptr` if it's the first one.
+             */
+            JLT_NODISCARD static pointer get_previous(const_reference item) { return hook(item).m_prev; }
+
+            JLT_NODISCARD constexpr iterator begin() { return iterator{m_first}; }
+            JLT_NODISCARD constexpr iterator end() { return iterator{nullptr}; }
+            JLT_NODISCARD constexpr const_iterator begin() const { return const_iterator{m_first}; }
+            JLT_NODISCARD constexpr const_iterator end() const { return const_iterator{nullptr}; }
+            JLT_NODISCARD constexpr const_iterator cbegin() const { return const_iterator{m_first}; }
+            JLT_NODISCARD constexpr const_iterator cend() const { return const_iterator{nullptr}; }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_INTRUSIVELIST_HPP */
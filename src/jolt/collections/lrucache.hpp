@@ -0,0 +1,353 @@
+#ifndef JLT_COLLECTIONS_LRUCACHE_HPP
+#define JLT_COLLECTIONS_LRUCACHE_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/hash.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "intrusivelist.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Size functor that counts each item as one unit, turning the budget of an `LruCache` into a
+         * maximum number of items.
+         */
+        struct LruCacheUnitSize {
+            template<typename K, typename V>
+            JLT_NODISCARD constexpr size_t operator()(K const &, V const &) const {
+                return 1;
+            }
+        };
+
+        /**
+         * Cache that evicts the least recently used items once their total size exceeds a budget.
+         *
+         * Each item lives in its own node, linked into a list in order of use and indexed by an
+         * open-addressing table of node pointers, so that lookups, insertions and evictions all run
+         * in constant time.
+         *
+         * @tparam K The key type.
+         * @tparam V The value type.
+         * @tparam S The size functor type. It's called as `size_t(K const &key, V const &value)` and
+         * returns the size an item accounts for in the budget, e.g. the size in bytes of decoded data.
+         * @tparam H The hash computation class type.
+         */
+        template<typename K, typename V, typename S = LruCacheUnitSize, typename H = jolt::hash::XXHash>
+        class LruCache {
+          public:
+            using key_type = K;
+            using value_type = V;
+            using pointer = V *;
+            using const_pointer = const V *;
+            using reference = V &;
+            using const_reference = const V &;
+
+            /**
+             * Function called when an item is evicted, before it's destroyed.
+             *
+             * @param key The key of the evicted item.
+             * @param value The value of the evicted item.
+             * @param user_data The user data passed to `set_eviction_callback()`.
+             */
+            using eviction_callback = void (*)(key_type const &key, reference value, void *user_data);
+
+            static constexpr size_t DEFAULT_INDEX_CAPACITY = 16; //< Default initial capacity of the index.
+
+          private:
+            struct Node {
+                IntrusiveListHook<Node> m_hook; //< Links in the usage order list.
+                hash::hash_t m_hash;            //< Hash of the key.
+                size_t m_size;                  //< Size of the item, as returned by the size functor.
+                key_type m_key;                 //< Key.
+                value_type m_value;             //< Value.
+
+                template<typename W>
+                Node(hash::hash_t const hash, key_type const &key, W &&value) :
+                  m_hash{hash}, m_size{0}, m_key{key}, m_value{std::forward<W>(value)} {}
+            };
+
+            using node_list = IntrusiveList<Node, &Node::m_hook>;
+
+            node_list m_nodes;             //< Nodes, from the most to the least recently used.
+            Node **m_index;                //< Open-addressing table of nodes.
+            size_t m_index_capacity;       //< Capacity of the index, a power of two.
+            size_t m_budget;               //< Maximum total size of the items.
+            size_t m_used_size;            //< Total size of the items.
+            S m_size_func;                 //< Size functor.
+            eviction_callback m_evict_cb;  //< Eviction callback.
+            void *m_evict_cb_data;         //< Eviction callback user data.
+            memory::flags_t m_alloc_flags; //< Allocation flags.
+
+            JLT_NODISCARD static hash::hash_t compute_hash(key_type const &key) {
+                return H::hash(&key, sizeof(key)) * 0x9E3779B97F4A7C15ull;
+            }
+
+            JLT_NODISCARD size_t get_home_slot(hash::hash_t const hash) const {
+                return static_cast<size_t>(hash >> 32) & (m_index_capacity - 1);
+            }
+
+            /**
+             * Find the index slot of a key.
+             *
+             * @return The slot containing the key's node or the empty slot where it should be stored.
+             */
+            JLT_NODISCARD size_t find_slot(key_type const &key, hash::hash_t const hash) const {
+                size_t const mask = m_index_capacity - 1;
+                size_t slot = get_home_slot(hash);
+
+                for(Node *node; (node = m_index[slot]); slot = (slot + 1) & mask) {
+                    if(node->m_hash == hash && node->m_key == key) {
+                        break;
+                    }
+                }
+
+                return slot;
+            }
+
+            void allocate_index(size_t const capacity) {
+                memory::push_force_flags(m_alloc_flags);
+                m_index = memory::allocate_array<Node *>(capacity);
+                memory::pop_force_flags();
+
+                m_index_capacity = capacity;
+
+                memset(m_index, 0, capacity * sizeof(Node *));
+            }
+
+            /**
+             * Double the capacity of the index if it's more than half full.
+             */
+            void ensure_index_capacity() {
+                if((m_nodes.get_length() + 1) * 2 <= m_index_capacity) {
+                    return;
+                }
+
+                Node **const old_index = m_index;
+                size_t const old_capacity = m_index_capacity;
+
+                allocate_index(old_capacity * 2);
+
+                for(size_t i = 0; i < old_capacity; ++i) {
+                    if(Node *const node = old_index[i]) {
+                        m_index[find_slot(node->m_key, node->m_hash)] = node;
+                    }
+                }
+
+                memory::free_array(old_index);
+            }
+
+            /**
+             * Remove a node from the index, shifting back the following nodes of its probe sequence.
+             */
+            void unindex(size_t slot) {
+                size_t const mask = m_index_capacity - 1;
+
+                m_index[slot] = nullptr;
+
+                for(size_t next = (slot + 1) & mask; m_index[next]; next = (next + 1) & mask) {
+                    size_t const home = get_home_slot(m_index[next]->m_hash);
+
+                    // Move the node back if its home slot is not within (slot, next]
+                    if(((next - home) & mask) >= ((next - slot) & mask)) {
+                        m_index[slot] = m_index[next];
+                        m_index[next] = nullptr;
+                        slot = next;
+                    }
+                }
+            }
+
+            /**
+             * Unlink, unindex and destroy a node.
+             *
+             * @param evicted Whether to call the eviction callback.
+             */
+            void destroy_node(Node &node, bool const evicted) {
+                if(evicted && m_evict_cb) {
+                    m_evict_cb(node.m_key, node.m_value, m_evict_cb_data);
+                }
+
+                unindex(find_slot(node.m_key, node.m_hash));
+                m_nodes.remove(node);
+                m_used_size -= node.m_size;
+
+                memory::free(&node);
+            }
+
+            /**
+             * Evict the least recently used items until the total size fits the budget. The most
+             * recently used item is never evicted.
+             */
+            void evict() {
+                while(m_used_size > m_budget && m_nodes.get_length() > 1) {
+                    destroy_node(*m_nodes.get_last(), true);
+                }
+            }
+
+            template<typename W>
+            reference put_impl(key_type const &key, W &&value) {
+                hash::hash_t const hash = compute_hash(key);
+                Node *node = m_index[find_slot(key, hash)];
+
+                if(node) {
+                    m_used_size -= node->m_size;
+                    node->m_value = std::forward<W>(value);
+
+                    m_nodes.remove(*node);
+                } else {
+                    ensure_index_capacity();
+
+                    memory::push_force_flags(m_alloc_flags);
+                    node = memory::allocate_and_construct<Node>(hash, key, std::forward<W>(value));
+                    memory::pop_force_flags();
+
+                    m_index[find_slot(key, hash)] = node;
+                }
+
+                node->m_size = m_size_func(node->m_key, node->m_value);
+                m_used_size += node->m_size;
+
+                m_nodes.push_front(*node);
+                evict();
+
+                return node->m_value;
+            }
+
+          public:
+            /**
+             * Create a new cache.
+             *
+             * @param budget The maximum total size of the items, as measured by the size functor.
+             * @param size_func The size functor.
+             * @param index_capacity The initial capacity of the index.
+             */
+            JLT_NODISCARD explicit LruCache(
+              size_t const budget, S size_func = S{}, size_t const index_capacity = DEFAULT_INDEX_CAPACITY) :
+              m_index{nullptr}, m_index_capacity{0}, m_budget{budget}, m_used_size{0},
+              m_size_func{std::move(size_func)}, m_evict_cb{nullptr}, m_evict_cb_data{nullptr},
+              m_alloc_flags{memory::get_current_force_flags()} {
+                allocate_index(std::bit_ceil(max<size_t>(index_capacity, 2)));
+            }
+
+            LruCache(LruCache const &) = delete;
+            LruCache &operator=(LruCache const &) = delete;
+
+            ~LruCache() {
+                clear();
+                memory::free_array(m_index);
+            }
+
+            /**
+             * Set the function to call when an item is evicted.
+             *
+             * @param callback The callback or `nullptr` to disable it.
+             * @param user_data The value to pass to the callback.
+             *
+             * @remarks The callback is not called when items are removed with `remove()` or `clear()`.
+             */
+            void set_eviction_callback(eviction_callback const callback, void *const user_data = nullptr) {
+                m_evict_cb = callback;
+                m_evict_cb_data = user_data;
+            }
+
+            /**
+             * Look up an item and mark it as the most recently used.
+             *
+             * @param key The key.
+             *
+             * @return A pointer to the value or `nullptr` if the key is not present. The pointer is
+             * valid until the item is removed or evicted.
+             */
+            JLT_NODISCARD pointer get(key_type const &key) {
+                Node *const node = m_index[find_slot(key, compute_hash(key))];
+
+                if(!node) {
+                    return nullptr;
+                }
+
+                if(node != m_nodes.get_first()) {
+                    m_nodes.remove(*node);
+                    m_nodes.push_front(*node);
+                }
+
+                return &node->m_value;
+            }
+
+            /**
+             * Look up an item without changing the usage order.
+             *
+             * @param key The key.
+             *
+             * @return A pointer to the value or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD const_pointer peek(key_type const &key) const {
+                Node const *const node = m_index[find_slot(key, compute_hash(key))];
+
+                return node ? &node->m_value : nullptr;
+            }
+
+            JLT_NODISCARD bool contains(key_type const &key) const { return peek(key); }
+
+            /**
+             * Add or replace an item, mark it as the most recently used and evict the least recently
+             * used items that don't fit the budget anymore.
+             *
+             * @param key The key.
+             * @param value The value.
+             *
+             * @return A reference to the stored value.
+             */
+            reference put(key_type const &key, const_reference value) { return put_impl(key, value); }
+            reference put(key_type const &key, value_type &&value) { return put_impl(key, std::move(value)); }
+
+            /**
+             * Remove an item.
+             *
+             * @param key The key.
+             *
+             * @return True if the item was present, false if not.
+             */
+            bool remove(key_type const &key) {
+                Node *const node = m_index[find_slot(key, compute_hash(key))];
+
+                if(node) {
+                    destroy_node(*node, false);
+                }
+
+                return node;
+            }
+
+            /**
+             * Remove all the items.
+             */
+            void clear() {
+                while(Node *const node = m_nodes.pop_front()) { memory::free(node); }
+
+                memset(m_index, 0, m_index_capacity * sizeof(Node *));
+                m_used_size = 0;
+            }
+
+            /**
+             * Change the budget, evicting items if needed.
+             *
+             * @param budget The new budget.
+             */
+            void set_budget(size_t const budget) {
+                m_budget = budget;
+
+                evict();
+            }
+
+            JLT_NODISCARD size_t get_budget() const { return m_budget; }
+            JLT_NODISCARD size_t get_used_size() const { return m_used_size; }
+            JLT_NODISCARD size_t get_length() const { return m_nodes.get_length(); }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_LRUCACHE_HPP */
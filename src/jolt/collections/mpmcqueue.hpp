@@ -0,0 +1,206 @@
+#ifndef JLT_COLLECTIONS_MPMCQUEUE_HPP
+#define JLT_COLLECTIONS_MPMCQUEUE_HPP
+
+#include <atomic>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/memory/allocator.hpp>
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Bounded, lock-free, multi-producer/multi-consumer queue.
+         *
+         * Each cell carries a sequence number that tells producers and consumers whether the cell is
+         * ready to be written or read for the current lap around the ring (D. Vyukov's bounded MPMC
+         * queue). Producers and consumers only contend on their own index, with a single CAS per
+         * operation.
+         *
+         * @tparam T The type of item contained in the queue.
+         */
+        template<typename T>
+        class MPMCQueue {
+          public:
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+
+          private:
+            using index_type = size_t;
+
+            struct Cell {
+                std::atomic<index_type> m_sequence;                   //< Cell sequence number.
+                alignas(value_type) uint8_t m_storage[sizeof(value_type)]; //< Item storage.
+
+                JLT_NODISCARD pointer get_item() { return reinterpret_cast<pointer>(m_storage); }
+            };
+
+            alignas(memory::CACHE_LINE_SIZE) Cell *const m_cells; //< Ring cells.
+            index_type const m_mask;                              //< Capacity - 1.
+
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<index_type> m_tail; //< Next cell to push.
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<index_type> m_head; //< Next cell to pop.
+
+            /**
+             * Round a capacity up to the next power of two.
+             */
+            JLT_NODISCARD static constexpr index_type round_capacity(index_type const capacity) {
+                index_type result = 1;
+
+                while(result < capacity) { result <<= 1; }
+
+                return result;
+            }
+
+            template<typename V>
+            bool push_impl(V &&item) {
+                index_type pos = m_tail.load(std::memory_order_relaxed);
+                Cell *cell;
+
+                while(true) {
+                    cell = &m_cells[pos & m_mask];
+
+                    index_type const seq = cell->m_sequence.load(std::memory_order_acquire);
+                    auto const diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+                    if(diff == 0) {
+                        if(m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            break;
+                        }
+                    } else if(diff < 0) {
+                        return false; // Full
+                    } else {
+                        pos = m_tail.load(std::memory_order_relaxed);
+                    }
+                }
+
+                memory::construct(cell->get_item(), std::forward<V>(item));
+                cell->m_sequence.store(pos + 1, std::memory_order_release);
+
+                return true;
+            }
+
+          public:
+            static constexpr size_t DEFAULT_CAPACITY = 1024; //< The default capacity.
+
+            /**
+             * Create a new queue.
+             *
+             * @param capacity The maximum number of items the queue can hold. It will be rounded up
+             * to the next power of two.
+             */
+            JLT_NODISCARD explicit MPMCQueue(size_t const capacity = DEFAULT_CAPACITY) :
+              m_cells{memory::allocate_array<Cell>(round_capacity(capacity))},
+              m_mask{round_capacity(capacity) - 1}, m_tail{0}, m_head{0} {
+                jltassert(capacity);
+
+                for(index_type i = 0; i <= m_mask; ++i) {
+                    new(&m_cells[i].m_sequence) std::atomic<index_type>{i};
+                }
+            }
+
+            MPMCQueue(const MPMCQueue &) = delete;
+            MPMCQueue &operator=(const MPMCQueue &) = delete;
+
+            ~MPMCQueue() {
+                if constexpr(!std::is_trivial<value_type>::value) {
+                    index_type const tail = m_tail.load(std::memory_order_acquire);
+
+                    for(index_type i = m_head.load(std::memory_order_acquire); i != tail; ++i) {
+                        m_cells[i & m_mask].get_item()->~value_type();
+                    }
+                }
+
+                memory::free_array(m_cells, 0);
+            }
+
+            /**
+             * Add an item at the end of the queue.
+             *
+             * @param item The item to add.
+             *
+             * @return True if the item has been added, false if the queue is full.
+             */
+            JLT_NODISCARD bool push(const_reference item) { return push_impl(item); }
+
+            /**
+             * Add an item at the end of the queue by moving it.
+             *
+             * @param item The item to add.
+             *
+             * @return True if the item has been added, false if the queue is full.
+             */
+            JLT_NODISCARD bool push(value_type &&item) { return push_impl(std::move(item)); }
+
+            /**
+             * Remove an item from the beginning of the queue.
+             *
+             * @param out_item The destination the item will be moved to.
+             *
+             * @return True if an item has been removed, false if the queue is empty.
+             */
+            JLT_NODISCARD bool pop(reference out_item) {
+                index_type pos = m_head.load(std::memory_order_relaxed);
+                Cell *cell;
+
+                while(true) {
+                    cell = &m_cells[pos & m_mask];
+
+                    index_type const seq = cell->m_sequence.load(std::memory_order_acquire);
+                    auto const diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+                    if(diff == 0) {
+                        if(m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            break;
+                        }
+                    } else if(diff < 0) {
+                        return false; // Empty
+                    } else {
+                        pos = m_head.load(std::memory_order_relaxed);
+                    }
+                }
+
+                pointer const item = cell->get_item();
+
+                out_item = std::move(*item);
+
+                if constexpr(!std::is_trivial<value_type>::value) {
+                    item->~value_type();
+                }
+
+                cell->m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            /**
+             * Return the capacity of the queue.
+             */
+            JLT_NODISCARD size_t get_capacity() const { return m_mask + 1; }
+
+            /**
+             * Return the number of items in the queue.
+             *
+             * @remarks The value is approximate when read while other threads are pushing or popping.
+             */
+            JLT_NODISCARD size_t get_length() const {
+                index_type const head = m_head.load(std::memory_order_acquire);
+                index_type const tail = m_tail.load(std::memory_order_acquire);
+
+                return choose<size_t>(tail - head, 0, tail > head);
+            }
+
+            /**
+             * Return a value stating whether the queue is empty.
+             *
+             * @remarks The value is approximate when read while other threads are pushing or popping.
+             */
+            JLT_NODISCARD bool is_empty() const { return get_length() == 0; }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_MPMCQUEUE_HPP */
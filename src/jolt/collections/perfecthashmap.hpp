@@ -0,0 +1,258 @@
+#ifndef JLT_COLLECTIONS_PERFECTHASHMAP_HPP
+#define JLT_COLLECTIONS_PERFECTHASHMAP_HPP
+
+#include <bit>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <jolt/api.hpp>
+#include <jolt/util.hpp>
+#include <jolt/hash.hpp>
+#include "keyvaluepair.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Hash computation class usable in constant expressions. Keys convertible to
+         * `std::string_view` are hashed with FNV-1a, integral and enumeration keys are used as they are.
+         */
+        struct ConstexprHash {
+            template<typename K>
+            JLT_NODISCARD static constexpr hash::hash_t hash(K const &key) {
+                if constexpr(std::is_convertible<K const &, std::string_view>::value) {
+                    std::string_view const str = key;
+                    hash::hash_t h = 0xcbf29ce484222325ull;
+
+                    for(char const c : str) {
+                        h ^= static_cast<uint8_t>(c);
+                        h *= 0x100000001b3ull;
+                    }
+
+                    return h;
+                } else {
+                    static_assert(
+                      std::is_integral<K>::value || std::is_enum<K>::value,
+                      "Key type not supported by ConstexprHash");
+
+                    return static_cast<hash::hash_t>(key);
+                }
+            }
+        };
+
+        /**
+         * Called when building a perfect hash map with duplicate keys. Not defined, so that the failure
+         * surfaces as a compile-time error.
+         */
+        void perfect_hash_map_duplicate_key();
+
+        /**
+         * Called when no displacement seed can be found for a bucket. Not defined, so that the failure
+         * surfaces as a compile-time error.
+         */
+        void perfect_hash_map_build_failed();
+
+        /**
+         * Immutable map with a collision-free hash table built at compile time.
+         *
+         * The table is built with the hash and displace method: keys are distributed into buckets and
+         * each bucket gets a seed that moves all of its keys into free slots of the table. A lookup
+         * hashes the key once, mixes the hash with its bucket's seed to find the only slot where the key
+         * can be and compares the key stored there.
+         *
+         * @tparam K The key type. It must be default-constructible and usable in constant expressions.
+         * @tparam V The value type. It must be default-constructible and usable in constant expressions.
+         * @tparam N The number of items.
+         * @tparam H The hash computation class type. It must provide a `constexpr` static `hash()`
+         * function taking a key.
+         */
+        template<typename K, typename V, size_t N, typename H = ConstexprHash>
+        class PerfectHashMap {
+          public:
+            using key_type = K;
+            using value_type = V;
+            using item_type = KeyValuePair<K, V>;
+
+            static constexpr size_t CAPACITY = std::bit_ceil(N + N / 2 + 1); //< Number of table slots.
+            static constexpr size_t N_BUCKETS = max<size_t>(N / 2, 1);       //< Number of buckets.
+            static constexpr uint32_t MAX_SEED = 1u << 20; //< Maximum seed tried for each bucket.
+
+          private:
+            key_type m_keys[CAPACITY];     //< Keys, by slot.
+            value_type m_values[CAPACITY]; //< Values, by slot.
+            uint32_t m_seeds[N_BUCKETS];   //< Displacement seed of each bucket.
+
+            JLT_NODISCARD static constexpr uint64_t mix(uint64_t x) {
+                x ^= x >> 30;
+                x *= 0xbf58476d1ce4e5b9ull;
+                x ^= x >> 27;
+                x *= 0x94d049bb133111ebull;
+                x ^= x >> 31;
+
+                return x;
+            }
+
+            JLT_NODISCARD static constexpr size_t get_bucket(hash::hash_t const hash) {
+                return static_cast<size_t>(mix(hash) % N_BUCKETS);
+            }
+
+            JLT_NODISCARD static constexpr size_t get_slot(hash::hash_t const hash, uint32_t const seed) {
+                return static_cast<size_t>(mix(hash ^ (seed * 0x9E3779B97F4A7C15ull)) & (CAPACITY - 1));
+            }
+
+            JLT_NODISCARD constexpr size_t find_slot(key_type const &key) const {
+                hash::hash_t const hash = H::hash(key);
+
+                return get_slot(hash, m_seeds[get_bucket(hash)]);
+            }
+
+          public:
+            /**
+             * Create an empty map.
+             */
+            JLT_NODISCARD consteval PerfectHashMap() requires(N == 0) : m_keys{}, m_values{}, m_seeds{} {}
+
+            /**
+             * Build a map. This can only run at compile time.
+             *
+             * @param items The items of the map, e.g. `{{"a", 1}, {"b", 2}}`. Keys must be unique:
+             * duplicate keys result in a compile-time error.
+             */
+            template<size_t M>
+            JLT_NODISCARD consteval explicit PerfectHashMap(item_type const (&items)[M]) requires(M == N) :
+              m_keys{}, m_values{}, m_seeds{} {
+                hash::hash_t hashes[N]{};
+                size_t buckets[N]{};
+                size_t bucket_lengths[N_BUCKETS]{};
+                size_t bucket_order[N_BUCKETS]{};
+                bool used[CAPACITY]{};
+
+                for(size_t i = 0; i < N; ++i) {
+                    for(size_t j = 0; j < i; ++j) {
+                        if(items[i].m_key == items[j].m_key) {
+                            perfect_hash_map_duplicate_key();
+                        }
+                    }
+
+                    hashes[i] = H::hash(items[i].m_key);
+                    buckets[i] = get_bucket(hashes[i]);
+                    ++bucket_lengths[buckets[i]];
+                }
+
+                // Place the largest buckets first, while the table is emptier
+                for(size_t i = 0; i < N_BUCKETS; ++i) {
+                    size_t j = i;
+
+                    for(; j > 0 && bucket_lengths[bucket_order[j - 1]] < bucket_lengths[i]; --j) {
+                        bucket_order[j] = bucket_order[j - 1];
+                    }
+
+                    bucket_order[j] = i;
+                }
+
+                for(size_t const bucket : bucket_order) {
+                    if(!bucket_lengths[bucket]) {
+                        break;
+                    }
+
+                    uint32_t seed = 0;
+
+                    for(; seed < MAX_SEED; ++seed) {
+                        size_t slots[N]{};
+                        size_t n_slots = 0;
+                        bool fits = true;
+
+                        for(size_t i = 0; i < N && fits; ++i) {
+                            if(buckets[i] != bucket) {
+                                continue;
+                            }
+
+                            size_t const slot = get_slot(hashes[i], seed);
+
+                            fits = !used[slot];
+
+                            for(size_t j = 0; j < n_slots && fits; ++j) { fits = slots[j] != slot; }
+
+                            slots[n_slots++] = slot;
+                        }
+
+                        if(fits) {
+                            for(size_t j = 0; j < n_slots; ++j) { used[slots[j]] = true; }
+
+                            break;
+                        }
+                    }
+
+                    if(seed == MAX_SEED) {
+                        perfect_hash_map_build_failed();
+                    }
+
+                    m_seeds[bucket] = seed;
+                }
+
+                for(size_t i = 0; i < N; ++i) {
+                    size_t const slot = get_slot(hashes[i], m_seeds[buckets[i]]);
+
+                    m_keys[slot] = items[i].m_key;
+                    m_values[slot] = items[i].m_value;
+                }
+
+                // Fill the free slots with a key that belongs to a different slot, so that a lookup
+                // landing on a free slot fails the key comparison without checking for emptiness.
+                for(size_t slot = 0; slot < CAPACITY; ++slot) {
+                    if(!used[slot]) {
+                        m_keys[slot] = items[0].m_key;
+                        m_values[slot] = items[0].m_value;
+                    }
+                }
+            }
+
+            /**
+             * Look up a value.
+             *
+             * @param key The key.
+             *
+             * @return A pointer to the value or `nullptr` if the key is not present.
+             */
+            JLT_NODISCARD constexpr value_type const *get_value(key_type const &key) const {
+                if constexpr(N == 0) {
+                    return nullptr;
+                } else {
+                    size_t const slot = find_slot(key);
+
+                    return m_keys[slot] == key ? &m_values[slot] : nullptr;
+                }
+            }
+
+            /**
+             * Look up a value.
+             *
+             * @param key The key.
+             * @param default_value The value to return if the key is not present.
+             */
+            JLT_NODISCARD constexpr value_type
+            get_value_with_default(key_type const &key, value_type const &default_value) const {
+                value_type const *const value = get_value(key);
+
+                return value ? *value : default_value;
+            }
+
+            JLT_NODISCARD constexpr bool contains_key(key_type const &key) const { return get_value(key); }
+
+            JLT_NODISCARD static constexpr size_t get_length() { return N; }
+            JLT_NODISCARD static constexpr size_t get_capacity() { return CAPACITY; }
+        };
+
+        /**
+         * Build a perfect hash map at compile time, deducing its length.
+         *
+         * @param items The items of the map, e.g. `{{"a", 1}, {"b", 2}}`. Keys must be unique.
+         */
+        template<typename K, typename V, size_t N, typename H = ConstexprHash>
+        JLT_NODISCARD consteval PerfectHashMap<K, V, N, H>
+        make_perfect_hash_map(KeyValuePair<K, V> const (&items)[N]) {
+            return PerfectHashMap<K, V, N, H>{items};
+        }
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_PERFECTHASHMAP_HPP */
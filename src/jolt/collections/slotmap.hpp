@@ -0,0 +1,267 @@
+#ifndef JLT_COLLECTIONS_SLOTMAP_HPP
+#define JLT_COLLECTIONS_SLOTMAP_HPP
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include "vector.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Handle to an item stored in a slot map.
+         *
+         * A handle stays valid until the item it refers to is erased, regardless of how the items
+         * are moved around in memory. Once erased, the generation stored in the slot changes and any
+         * outstanding handle to the old item will no longer resolve.
+         *
+         * Generation 0 is never used, so a zero-initialized handle never refers to any item.
+         */
+        struct SlotMapHandle {
+            uint32_t m_index;      //< Slot index.
+            uint32_t m_generation; //< Slot generation at the time the handle was created.
+
+            JLT_NODISCARD constexpr bool operator==(const SlotMapHandle &other) const {
+                return m_index == other.m_index && m_generation == other.m_generation;
+            }
+
+            JLT_NODISCARD constexpr bool operator!=(const SlotMapHandle &other) const {
+                return !(*this == other);
+            }
+        };
+
+        /**
+         * A handle value that never refers to any item.
+         */
+        constexpr SlotMapHandle INVALID_SLOT_MAP_HANDLE{
+          std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max()};
+
+        /**
+         * A collection of items addressed by generational handles.
+         *
+         * The items are stored densely in a vector so iteration is a linear scan. A slot table maps
+         * each handle to the current position of its item in the dense array. Insertion, look-up
+         * and removal are all O(1): removal moves the last item into the hole left by the removed
+         * one and patches its slot.
+         *
+         * @tparam T The type of item contained in the map.
+         */
+        template<typename T>
+        class SlotMap {
+          public:
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+            using handle_type = SlotMapHandle;
+            using iterator = typename Vector<T>::iterator;
+            using const_iterator = typename Vector<T>::const_iterator;
+
+          private:
+            using index_type = uint32_t;
+
+            static constexpr index_type FREE_LIST_END = std::numeric_limits<index_type>::max();
+            static constexpr index_type NULL_GENERATION = 0; //< Generation never given to a slot.
+
+            struct Slot {
+                index_type m_index;      //< Dense index when in use, next free slot when free.
+                index_type m_generation; //< Incremented every time the slot is freed, skipping 0.
+            };
+
+            Vector<value_type> m_data;  //< Dense item storage.
+            Vector<index_type> m_erase; //< Slot index for each item in `m_data`.
+            Vector<Slot> m_slots;       //< Slot table.
+            index_type m_free_head;     //< First free slot.
+
+            /**
+             * Return the slot for a handle, or `nullptr` if the handle is stale or out of range.
+             */
+            JLT_NODISCARD const Slot *resolve_slot(handle_type const handle) const {
+                if(handle.m_index >= m_slots.get_length()) {
+                    return nullptr;
+                }
+
+                const Slot &slot = m_slots[handle.m_index];
+
+                return slot.m_generation == handle.m_generation ? &slot : nullptr;
+            }
+
+            /**
+             * Take a slot from the free list or append a new one, and point it to `dense_index`.
+             */
+            handle_type acquire_slot(index_type const dense_index) {
+                index_type slot_index;
+
+                if(m_free_head != FREE_LIST_END) {
+                    slot_index = m_free_head;
+                    m_free_head = m_slots[slot_index].m_index;
+                } else {
+                    jltassert(m_slots.get_length() < FREE_LIST_END);
+
+                    slot_index = static_cast<index_type>(m_slots.get_length());
+                    m_slots.push(Slot{0, NULL_GENERATION + 1});
+                }
+
+                Slot &slot = m_slots[slot_index];
+                slot.m_index = dense_index;
+
+                m_erase.push(slot_index);
+
+                return handle_type{slot_index, slot.m_generation};
+            }
+
+            /**
+             * Invalidate the handles to a slot and put it in the free list.
+             */
+            void release_slot(index_type const slot_index) {
+                Slot &slot = m_slots[slot_index];
+
+                if(++slot.m_generation == NULL_GENERATION) {
+                    ++slot.m_generation;
+                }
+
+                slot.m_index = m_free_head;
+                m_free_head = slot_index;
+            }
+
+          public:
+            /**
+             * Create a new empty slot map.
+             *
+             * @param initial_capacity The number of items the map will be able to hold before
+             * resizing its internal arrays.
+             */
+            JLT_NODISCARD explicit SlotMap(size_t const initial_capacity = Vector<value_type>::DEFAULT_CAPACITY) :
+              m_data(initial_capacity), m_erase(initial_capacity), m_slots(initial_capacity),
+              m_free_head{FREE_LIST_END} {}
+
+            SlotMap(const SlotMap &other) = default;
+            SlotMap(SlotMap &&other) = default;
+
+            /**
+             * Add an item.
+             *
+             * @param value The item to add.
+             *
+             * @return The handle to the new item.
+             */
+            handle_type insert(const_reference value) {
+                handle_type const handle = acquire_slot(static_cast<index_type>(m_data.get_length()));
+
+                m_data.push(value);
+
+                return handle;
+            }
+
+            /**
+             * Remove an item.
+             *
+             * @param handle The handle to the item to remove.
+             *
+             * @return True if the item was removed, false if the handle didn't refer to any item.
+             */
+            bool erase(handle_type const handle) {
+                const Slot *const slot = resolve_slot(handle);
+
+                if(!slot) {
+                    return false;
+                }
+
+                index_type const dense_index = slot->m_index;
+                index_type const last_index = static_cast<index_type>(m_data.get_length() - 1);
+
+                if(dense_index != last_index) {
+                    index_type const moved_slot = m_erase[last_index];
+
+                    m_data[dense_index] = std::move(m_data[last_index]);
+                    m_erase[dense_index] = moved_slot;
+                    m_slots[moved_slot].m_index = dense_index;
+                }
+
+                m_data.remove_at(last_index);
+                m_erase.remove_at(last_index);
+
+                release_slot(handle.m_index);
+
+                return true;
+            }
+
+            /**
+             * Return the item referred to by a handle.
+             *
+             * @param handle The handle.
+             *
+             * @return A pointer to the item or `nullptr` if the handle doesn't refer to any item.
+             *
+             * @remarks The returned pointer is only valid until the next insertion or removal.
+             */
+            JLT_NODISCARD const_pointer get(handle_type const handle) const {
+                const Slot *const slot = resolve_slot(handle);
+
+                return slot ? &m_data[slot->m_index] : nullptr;
+            }
+
+            /**
+             * Return the item referred to by a handle.
+             *
+             * @param handle The handle.
+             *
+             * @return A pointer to the item or `nullptr` if the handle doesn't refer to any item.
+             *
+             * @remarks The returned pointer is only valid until the next insertion or removal.
+             */
+            JLT_NODISCARD pointer get(handle_type const handle) {
+                const SlotMap *const self = this;
+
+                return const_cast<pointer>(self->get(handle));
+            }
+
+            /**
+             * Check whether a handle refers to an item in the map.
+             *
+             * @param handle The handle.
+             */
+            JLT_NODISCARD bool contains(handle_type const handle) const { return resolve_slot(handle); }
+
+            /**
+             * Return the handle of the item at a given position in the dense storage.
+             *
+             * @param i The index of the item, in iteration order.
+             */
+            JLT_NODISCARD handle_type get_handle_at(size_t const i) const {
+                index_type const slot_index = m_erase[i];
+
+                return handle_type{slot_index, m_slots[slot_index].m_generation};
+            }
+
+            /**
+             * Remove all the items. Outstanding handles are invalidated.
+             */
+            void clear() {
+                for(index_type const slot_index : m_erase) { release_slot(slot_index); }
+
+                m_data.clear();
+                m_erase.clear();
+            }
+
+            /**
+             * Return the number of items.
+             */
+            JLT_NODISCARD size_t get_length() const { return m_data.get_length(); }
+
+            JLT_NODISCARD iterator begin() { return m_data.begin(); }
+            JLT_NODISCARD iterator end() { return m_data.end(); }
+
+            JLT_NODISCARD const_iterator begin() const { return m_data.begin(); }
+            JLT_NODISCARD const_iterator end() const { return m_data.end(); }
+
+            JLT_NODISCARD const_iterator cbegin() const { return m_data.cbegin(); }
+            JLT_NODISCARD const_iterator cend() const { return m_data.cend(); }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_SLOTMAP_HPP */
@@ -0,0 +1,433 @@
+#ifndef JLT_COLLECTIONS_SOAVECTOR_HPP
+#define JLT_COLLECTIONS_SOAVECTOR_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "span.hpp"
+
+namespace jolt {
+    namespace collections {
+        template<typename... Fields>
+        class SoAVector;
+
+        /**
+         * Proxy reference to an item of a structure-of-arrays vector.
+         *
+         * The reference is invalidated by any operation that reallocates or shifts the vector's
+         * content.
+         *
+         * @tparam V The vector type, possibly const-qualified.
+         */
+        template<typename V>
+        class SoAVectorReference {
+            V *m_vector;    //< The vector the item belongs to.
+            size_t m_index; //< The index of the item.
+
+          public:
+            JLT_NODISCARD constexpr SoAVectorReference(V &vector, size_t const index) :
+              m_vector{&vector}, m_index{index} {}
+
+            /**
+             * Return a reference to a field of the item.
+             *
+             * @tparam I The index of the field.
+             */
+            template<size_t I>
+            JLT_NODISCARD auto &get() const {
+                return m_vector->template get_field<I>()[m_index];
+            }
+
+            /**
+             * Return the index of the item.
+             */
+            JLT_NODISCARD constexpr size_t get_index() const { return m_index; }
+
+            /**
+             * Overwrite all the fields of the item.
+             *
+             * @param values The new value of each field.
+             */
+            template<typename... Values>
+            void set(Values const &...values) const {
+                m_vector->set(m_index, values...);
+            }
+        };
+
+        /**
+         * A resizable collection of items where each field is stored in its own array.
+         *
+         * All the field arrays live in a single allocation, each one aligned to `FIELD_ALIGNMENT`.
+         * The capacity is always a multiple of `SIMD_BLOCK_LENGTH` items, so that every field array
+         * can be processed in whole SIMD registers, including the last block which may be only
+         * partially used.
+         *
+         * @tparam Fields The type of each field. All fields must be trivially copyable and
+         * trivially destructible.
+         */
+        template<typename... Fields>
+        class SoAVector {
+          public:
+            using reference = SoAVectorReference<SoAVector<Fields...>>;
+            using const_reference = SoAVectorReference<const SoAVector<Fields...>>;
+
+            template<size_t I>
+            using field_type = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+            static constexpr size_t N_FIELDS = sizeof...(Fields); //< The number of fields.
+            static constexpr size_t FIELD_ALIGNMENT = 64;         //< Alignment of each field array.
+            static constexpr size_t SIMD_WIDTH = 32;              //< Width of a SIMD register, in bytes.
+
+            /**
+             * Number of items in a SIMD block. A block of any field starts on a SIMD register
+             * boundary and spans a whole number of registers.
+             */
+            static constexpr size_t SIMD_BLOCK_LENGTH = SIMD_WIDTH;
+
+            static constexpr size_t DEFAULT_CAPACITY = SIMD_BLOCK_LENGTH; //< The default capacity.
+
+            static_assert(N_FIELDS > 0, "A SoAVector needs at least one field.");
+            static_assert(
+              (std::is_trivially_copyable<Fields>::value && ...),
+              "SoAVector fields must be trivially copyable.");
+            static_assert(
+              (std::is_trivially_destructible<Fields>::value && ...),
+              "SoAVector fields must be trivially destructible.");
+
+          private:
+            static constexpr size_t FIELD_SIZES[N_FIELDS] = {sizeof(Fields)...};
+
+            uint8_t *m_block;              //< The allocation holding all the field arrays.
+            void *m_fields[N_FIELDS];      //< Pointer to each field array.
+            size_t m_length;               //< Number of items.
+            size_t m_capacity;             //< Number of items each field array can hold.
+            memory::flags_t m_alloc_flags; //< Allocation flags.
+
+            JLT_NODISCARD static constexpr size_t round_up(size_t const n, size_t const m) {
+                return (n + m - 1) / m * m;
+            }
+
+            JLT_NODISCARD static constexpr size_t
+            get_field_array_size(size_t const field, size_t const capacity) {
+                return round_up(FIELD_SIZES[field] * capacity, FIELD_ALIGNMENT);
+            }
+
+            /**
+             * Allocate a new block of field arrays, pointing `fields` to each array.
+             *
+             * @return The allocated block.
+             */
+            JLT_NODISCARD static uint8_t *allocate_block(size_t const capacity, void **const fields) {
+                size_t total_size = FIELD_ALIGNMENT - 1;
+
+                for(size_t i = 0; i < N_FIELDS; ++i) { total_size += get_field_array_size(i, capacity); }
+
+                uint8_t *const block = memory::allocate_array<uint8_t>(total_size);
+                auto field_ptr = reinterpret_cast<uint8_t *>(align_raw_ptr(block, FIELD_ALIGNMENT));
+
+                for(size_t i = 0; i < N_FIELDS; ++i) {
+                    fields[i] = field_ptr;
+                    field_ptr += get_field_array_size(i, capacity);
+                }
+
+                return block;
+            }
+
+            /**
+             * Replace the field arrays with new ones of the given capacity, preserving the content.
+             */
+            void reallocate(size_t const new_capacity) {
+                void *new_fields[N_FIELDS];
+
+                memory::push_force_flags(m_alloc_flags);
+                uint8_t *const new_block = allocate_block(new_capacity, new_fields);
+                memory::pop_force_flags();
+
+                for(size_t i = 0; i < N_FIELDS; ++i) {
+                    memcpy(new_fields[i], m_fields[i], FIELD_SIZES[i] * m_length);
+                    m_fields[i] = new_fields[i];
+                }
+
+                dispose();
+
+                m_block = new_block;
+                m_capacity = new_capacity;
+            }
+
+            /**
+             * Ensure the vector has the capacity to hold additional `n` items.
+             */
+            void ensure_capacity(size_t const n) {
+                if(m_capacity < m_length + n) {
+                    reserve_capacity((m_capacity + n) * 1.3 + DEFAULT_CAPACITY);
+                }
+            }
+
+            void dispose() {
+                if(m_block) {
+                    memory::free_array(m_block);
+
+                    m_block = nullptr;
+                }
+            }
+
+            template<size_t... I>
+            void set_impl(size_t const index, std::index_sequence<I...>, Fields const &...values) {
+                ((get_field<I>()[index] = values), ...);
+            }
+
+          public:
+            /**
+             * Create a new empty instance of this class.
+             *
+             * @param initial_capacity The number of items the vector will be able to hold before
+             * resizing its arrays. This is rounded up to a multiple of `SIMD_BLOCK_LENGTH`.
+             */
+            JLT_NODISCARD explicit SoAVector(size_t const initial_capacity = DEFAULT_CAPACITY) :
+              m_length{0},
+              m_capacity{round_up(max(initial_capacity, static_cast<size_t>(1)), SIMD_BLOCK_LENGTH)},
+              m_alloc_flags{memory::get_current_force_flags()} {
+                m_block = allocate_block(m_capacity, m_fields);
+            }
+
+            JLT_NODISCARD SoAVector(const SoAVector &other) :
+              m_length{other.m_length}, m_capacity{other.m_capacity}, m_alloc_flags{other.m_alloc_flags} {
+                memory::push_force_flags(m_alloc_flags);
+                m_block = allocate_block(m_capacity, m_fields);
+                memory::pop_force_flags();
+
+                for(size_t i = 0; i < N_FIELDS; ++i) {
+                    memcpy(m_fields[i], other.m_fields[i], FIELD_SIZES[i] * m_length);
+                }
+            }
+
+            JLT_NODISCARD SoAVector(SoAVector &&other) :
+              m_block{other.m_block}, m_length{other.m_length}, m_capacity{other.m_capacity},
+              m_alloc_flags{other.m_alloc_flags} {
+                memcpy(m_fields, other.m_fields, sizeof(m_fields));
+
+                other.m_block = nullptr;
+                other.m_length = 0;
+                other.m_capacity = 0;
+            }
+
+            ~SoAVector() { dispose(); }
+
+            SoAVector &operator=(const SoAVector &other) {
+                if(this != &other) {
+                    m_length = 0;
+
+                    if(m_capacity < other.m_length) {
+                        reallocate(other.m_capacity);
+                    }
+
+                    for(size_t i = 0; i < N_FIELDS; ++i) {
+                        memcpy(m_fields[i], other.m_fields[i], FIELD_SIZES[i] * other.m_length);
+                    }
+
+                    m_length = other.m_length;
+                }
+
+                return *this;
+            }
+
+            SoAVector &operator=(SoAVector &&other) {
+                if(this != &other) {
+                    dispose();
+
+                    m_block = other.m_block;
+                    m_length = other.m_length;
+                    m_capacity = other.m_capacity;
+                    m_alloc_flags = other.m_alloc_flags;
+                    memcpy(m_fields, other.m_fields, sizeof(m_fields));
+
+                    other.m_block = nullptr;
+                    other.m_length = 0;
+                    other.m_capacity = 0;
+                }
+
+                return *this;
+            }
+
+            /**
+             * Return the number of items in the vector.
+             */
+            JLT_NODISCARD size_t get_length() const { return m_length; }
+
+            /**
+             * Return the number of items the vector can hold before resizing its arrays.
+             */
+            JLT_NODISCARD size_t get_capacity() const { return m_capacity; }
+
+            /**
+             * Return the length of the vector rounded up to a multiple of `SIMD_BLOCK_LENGTH`. All
+             * the items up to this length can be read and written, but the ones past `get_length()`
+             * have unspecified values.
+             */
+            JLT_NODISCARD size_t get_padded_length() const { return round_up(m_length, SIMD_BLOCK_LENGTH); }
+
+            /**
+             * Return the array of a field, spanning `get_length()` items. The array is aligned to
+             * `FIELD_ALIGNMENT`: SIMD code can access it through `get_data()` up to
+             * `get_padded_length()`.
+             *
+             * @tparam I The index of the field.
+             */
+            template<size_t I>
+            JLT_NODISCARD Span<field_type<I>> get_field() {
+                return Span<field_type<I>>{reinterpret_cast<field_type<I> *>(m_fields[I]), m_length};
+            }
+
+            template<size_t I>
+            JLT_NODISCARD Span<field_type<I> const> get_field() const {
+                return Span<field_type<I> const>{
+                  reinterpret_cast<field_type<I> const *>(m_fields[I]), m_length};
+            }
+
+            JLT_NODISCARD reference operator[](size_t const i) {
+                jltassert(i < m_length);
+
+                return reference{*this, i};
+            }
+
+            JLT_NODISCARD const_reference operator[](size_t const i) const {
+                jltassert(i < m_length);
+
+                return const_reference{*this, i};
+            }
+
+            /**
+             * Reserve some capacity.
+             *
+             * @param new_capacity The minimum capacity to reserve.
+             */
+            void reserve_capacity(size_t const new_capacity) {
+                if(new_capacity > m_capacity) {
+                    reallocate(round_up(new_capacity, SIMD_BLOCK_LENGTH));
+                }
+            }
+
+            /**
+             * Set the length of the vector. Any new item is zero-initialized.
+             *
+             * @param length The new length.
+             */
+            void set_length(size_t const length) {
+                reserve_capacity(length);
+
+                if(length > m_length) {
+                    for(size_t i = 0; i < N_FIELDS; ++i) {
+                        memset(
+                          reinterpret_cast<uint8_t *>(m_fields[i]) + FIELD_SIZES[i] * m_length,
+                          0,
+                          FIELD_SIZES[i] * (length - m_length));
+                    }
+                }
+
+                m_length = length;
+            }
+
+            /**
+             * Overwrite all the fields of an item.
+             *
+             * @param index The index of the item.
+             * @param values The new value of each field.
+             */
+            void set(size_t const index, Fields const &...values) {
+                jltassert(index < m_length);
+
+                set_impl(index, std::index_sequence_for<Fields...>{}, values...);
+            }
+
+            /**
+             * Add an item at the end of the vector.
+             *
+             * @param values The value of each field of the new item.
+             */
+            void push(Fields const &...values) {
+                ensure_capacity(1);
+
+                set_impl(m_length++, std::index_sequence_for<Fields...>{}, values...);
+            }
+
+            /**
+             * Remove the last item of the vector.
+             */
+            void pop() {
+                jltassert(m_length);
+
+                --m_length;
+            }
+
+            /**
+             * Remove an item from the vector given its position, preserving the order of the
+             * remaining items.
+             *
+             * @param i The index of the item to remove.
+             */
+            void remove_at(size_t const i) {
+                jltassert(i < m_length);
+
+                for(size_t f = 0; f < N_FIELDS; ++f) {
+                    auto const field = reinterpret_cast<uint8_t *>(m_fields[f]);
+                    size_t const sz = FIELD_SIZES[f];
+
+                    memmove(field + i * sz, field + (i + 1) * sz, (m_length - i - 1) * sz);
+                }
+
+                --m_length;
+            }
+
+            /**
+             * Remove an item from the vector given its position, by moving the last item in its
+             * place.
+             *
+             * @param i The index of the item to remove.
+             */
+            void swap_remove_at(size_t const i) {
+                jltassert(i < m_length);
+
+                size_t const last = --m_length;
+
+                if(i == last) {
+                    return;
+                }
+
+                for(size_t f = 0; f < N_FIELDS; ++f) {
+                    auto const field = reinterpret_cast<uint8_t *>(m_fields[f]);
+                    size_t const sz = FIELD_SIZES[f];
+
+                    memcpy(field + i * sz, field + last * sz, sz);
+                }
+            }
+
+            /**
+             * Remove all the items from the vector.
+             */
+            void clear() { m_length = 0; }
+
+            /**
+             * Call a function on consecutive blocks of `SIMD_BLOCK_LENGTH` items. Every block begins
+             * on a SIMD register boundary for all the fields.
+             *
+             * @param func A function accepting the beginning and end indices of a block. The end of
+             * the last block may be smaller than the beginning of the next SIMD block, but reading
+             * and writing up to `get_padded_length()` is allowed.
+             */
+            template<typename F>
+            void for_each_simd_block(F &&func) const {
+                for(size_t begin = 0; begin < m_length; begin += SIMD_BLOCK_LENGTH) {
+                    func(begin, min(begin + SIMD_BLOCK_LENGTH, m_length));
+                }
+            }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_SOAVECTOR_HPP */
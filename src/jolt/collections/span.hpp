@@ -0,0 +1,125 @@
+#ifndef JLT_COLLECTIONS_SPAN_HPP
+#define JLT_COLLECTIONS_SPAN_HPP
+
+#include <type_traits>
+#include <initializer_list>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include "iterator.hpp"
+#include "array.hpp"
+#include "vector.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Non-owning view over a contiguous sequence of items.
+         *
+         * A span is just a pointer and a length, so it's cheap to pass by value and lets functions
+         * accept items from a `Vector`, an `Array`, a `StaticArray`, an initializer list or a C array
+         * without copying them into a temporary container first.
+         *
+         * @tparam T The type of item. Use `const T` for read-only views.
+         *
+         * @remarks A span doesn't extend the lifetime of the items it views: it's invalidated when the
+         * underlying storage is freed or reallocated.
+         */
+        template<typename T>
+        class Span {
+          public:
+            using element_type = T;
+            using value_type = std::remove_cv_t<T>;
+            using pointer = T *;
+            using reference = T &;
+
+            template<typename E>
+            using base_iterator = Iterator<E, ArrayIteratorImpl<E>>;
+            using iterator = base_iterator<T>;
+            using const_iterator = base_iterator<const T>;
+
+          private:
+            pointer m_data;  //< Pointer to the first item.
+            size_t m_length; //< Number of items.
+
+          public:
+            JLT_NODISCARD constexpr Span() : m_data{nullptr}, m_length{0} {}
+
+            /**
+             * Create a new span.
+             *
+             * @param data Pointer to the first item.
+             * @param length The number of items.
+             */
+            JLT_NODISCARD constexpr Span(pointer const data, size_t const length) :
+              m_data{data}, m_length{length} {}
+
+            template<size_t N>
+            JLT_NODISCARD constexpr Span(T (&data)[N]) : m_data{data}, m_length{N} {}
+
+            JLT_NODISCARD Span(Vector<value_type> &vector) :
+              m_data{vector.get_data()}, m_length{vector.get_length()} {}
+
+            JLT_NODISCARD Span(Vector<value_type> const &vector) requires std::is_const_v<T> :
+              m_data{vector.get_data()}, m_length{vector.get_length()} {}
+
+            JLT_NODISCARD Span(Array<value_type> &array) : m_data{array}, m_length{array.get_length()} {}
+
+            JLT_NODISCARD Span(Array<value_type> const &array) requires std::is_const_v<T> :
+              m_data{array}, m_length{array.get_length()} {}
+
+            template<size_t N>
+            JLT_NODISCARD constexpr Span(StaticArray<value_type, N> &array) : m_data{array}, m_length{N} {}
+
+            template<size_t N>
+            JLT_NODISCARD constexpr Span(StaticArray<value_type, N> const &array)
+              requires std::is_const_v<T> : m_data{array}, m_length{N} {}
+
+            /**
+             * Create a new span over the items of an initializer list.
+             *
+             * @remarks The items of the list only live until the end of the full expression the list
+             * appears in, so this is only meant for passing literal lists as function arguments.
+             */
+            JLT_NODISCARD constexpr Span(std::initializer_list<value_type> lst) requires std::is_const_v<T> :
+              m_data{lst.begin()}, m_length{lst.size()} {}
+
+            template<typename U>
+            JLT_NODISCARD constexpr Span(Span<U> const &other)
+              requires std::is_convertible_v<U (*)[], T (*)[]> :
+              m_data{other.get_data()}, m_length{other.get_length()} {}
+
+            JLT_NODISCARD constexpr reference operator[](size_t const i) const {
+                jltassert(i < m_length);
+
+                return m_data[i];
+            }
+
+            /**
+             * Return a pointer to the first item, or `nullptr` if the span is empty and was not created
+             * from a non-null pointer.
+             */
+            JLT_NODISCARD constexpr pointer get_data() const { return m_data; }
+            JLT_NODISCARD constexpr size_t get_length() const { return m_length; }
+            JLT_NODISCARD constexpr bool is_empty() const { return m_length == 0; }
+
+            /**
+             * Return a view over a range of items within this span.
+             *
+             * @param offset The index of the first item of the range.
+             * @param length The number of items in the range. Defaults to all the items after `offset`.
+             */
+            JLT_NODISCARD constexpr Span subspan(size_t const offset, size_t const length = SIZE_MAX) const {
+                jltassert(offset <= m_length);
+
+                return Span{m_data + offset, min(length, m_length - offset)};
+            }
+
+            JLT_NODISCARD constexpr iterator begin() const { return iterator{m_data}; }
+            JLT_NODISCARD constexpr iterator end() const { return iterator{m_data + m_length}; }
+
+            JLT_NODISCARD constexpr const_iterator cbegin() const { return const_iterator{m_data}; }
+            JLT_NODISCARD constexpr const_iterator cend() const { return const_iterator{m_data + m_length}; }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_SPAN_HPP */
@@ -0,0 +1,324 @@
+#ifndef JLT_COLLECTIONS_SPARSESET_HPP
+#define JLT_COLLECTIONS_SPARSESET_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "vector.hpp"
+
+namespace jolt {
+    namespace collections {
+        /**
+         * A collection of items addressed by integer IDs, such as entity components.
+         *
+         * The items are stored densely in a vector, so iteration is a linear scan over contiguous
+         * memory. A sparse table maps each ID to the position of its item in the dense array. The
+         * sparse table is split into pages allocated on first use, so that large or scattered IDs
+         * don't require a table covering the whole ID range. Insertion, look-up and removal are all
+         * O(1): removal moves the last item into the hole left by the removed one.
+         *
+         * @tparam T The type of item contained in the set.
+         */
+        template<typename T>
+        class SparseSet {
+          public:
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+            using id_type = uint32_t;
+            using iterator = typename Vector<T>::iterator;
+            using const_iterator = typename Vector<T>::const_iterator;
+
+            static constexpr size_t PAGE_LENGTH = 1024; //< Number of IDs mapped by each sparse page.
+
+          private:
+            using index_type = uint32_t;
+
+            static constexpr index_type INVALID_INDEX = std::numeric_limits<index_type>::max();
+
+            index_type **m_pages;      //< Sparse page table. Unused pages are `nullptr`.
+            size_t m_n_pages;          //< Length of the page table.
+            Vector<value_type> m_data; //< Dense item storage.
+            Vector<id_type> m_ids;     //< ID of each item in `m_data`.
+
+            JLT_NODISCARD static constexpr size_t get_page_index(id_type const id) {
+                return id / PAGE_LENGTH;
+            }
+
+            JLT_NODISCARD static constexpr size_t get_page_offset(id_type const id) {
+                return id % PAGE_LENGTH;
+            }
+
+            /**
+             * Return the dense index of an ID or `INVALID_INDEX` if not present.
+             */
+            JLT_NODISCARD index_type get_dense_index(id_type const id) const {
+                size_t const page = get_page_index(id);
+
+                return page < m_n_pages && m_pages[page] ? m_pages[page][get_page_offset(id)] : INVALID_INDEX;
+            }
+
+            /**
+             * Return the sparse table entry of an ID, allocating its page if needed.
+             */
+            index_type &get_sparse_entry(id_type const id) {
+                size_t const page = get_page_index(id);
+
+                if(page >= m_n_pages) {
+                    size_t const new_n_pages = max(page + 1, m_n_pages * 2);
+                    index_type **const new_pages = memory::allocate_array<index_type *>(new_n_pages);
+
+                    if(m_pages) {
+                        memcpy(new_pages, m_pages, m_n_pages * sizeof(index_type *));
+                        memory::free_array(m_pages);
+                    }
+
+                    memset(new_pages + m_n_pages, 0, (new_n_pages - m_n_pages) * sizeof(index_type *));
+
+                    m_pages = new_pages;
+                    m_n_pages = new_n_pages;
+                }
+
+                if(!m_pages[page]) {
+                    m_pages[page] = memory::allocate_array<index_type>(PAGE_LENGTH);
+
+                    memset(m_pages[page], 0xff, PAGE_LENGTH * sizeof(index_type)); // INVALID_INDEX
+                }
+
+                return m_pages[page][get_page_offset(id)];
+            }
+
+            void dispose_pages() {
+                for(size_t i = 0; i < m_n_pages; ++i) {
+                    if(m_pages[i]) {
+                        memory::free_array(m_pages[i]);
+                    }
+                }
+
+                if(m_pages) {
+                    memory::free_array(m_pages);
+                }
+
+                m_pages = nullptr;
+                m_n_pages = 0;
+            }
+
+          public:
+            /**
+             * Create a new empty sparse set.
+             *
+             * @param initial_capacity The number of items the set will be able to hold before
+             * resizing its dense arrays.
+             */
+            JLT_NODISCARD explicit SparseSet(
+              size_t const initial_capacity = Vector<value_type>::DEFAULT_CAPACITY) :
+              m_pages{nullptr}, m_n_pages{0}, m_data(initial_capacity), m_ids(initial_capacity) {}
+
+            JLT_NODISCARD SparseSet(SparseSet const &other) :
+              m_pages{nullptr}, m_n_pages{0}, m_data(other.m_data), m_ids(other.m_ids) {
+                for(size_t i = 0; i < m_ids.get_length(); ++i) {
+                    get_sparse_entry(m_ids[i]) = static_cast<index_type>(i);
+                }
+            }
+
+            JLT_NODISCARD SparseSet(SparseSet &&other) :
+              m_pages{other.m_pages}, m_n_pages{other.m_n_pages}, m_data(std::move(other.m_data)),
+              m_ids(std::move(other.m_ids)) {
+                other.m_pages = nullptr;
+                other.m_n_pages = 0;
+            }
+
+            SparseSet &operator=(SparseSet const &) = delete;
+
+            ~SparseSet() { dispose_pages(); }
+
+            /**
+             * Add an item.
+             *
+             * @param id The ID of the item. It must not be present in the set.
+             * @param value The item to add.
+             *
+             * @return A reference to the new item.
+             *
+             * @remarks The returned reference is only valid until the next insertion or removal.
+             */
+            reference add(id_type const id, const_reference value) {
+                index_type &entry = get_sparse_entry(id);
+
+                jltassert2(entry == INVALID_INDEX, "Attempting to add an ID that is already present");
+                jltassert(m_data.get_length() < INVALID_INDEX);
+
+                entry = static_cast<index_type>(m_data.get_length());
+
+                m_data.push(value);
+                m_ids.push(id);
+
+                return m_data[entry];
+            }
+
+            /**
+             * Remove an item.
+             *
+             * @param id The ID of the item to remove.
+             *
+             * @return True if the item was removed, false if the ID wasn't present.
+             */
+            bool remove(id_type const id) {
+                index_type const dense_index = get_dense_index(id);
+
+                if(dense_index == INVALID_INDEX) {
+                    return false;
+                }
+
+                index_type const last_index = static_cast<index_type>(m_data.get_length() - 1);
+
+                if(dense_index != last_index) {
+                    id_type const moved_id = m_ids[last_index];
+
+                    m_data[dense_index] = std::move(m_data[last_index]);
+                    m_ids[dense_index] = moved_id;
+                    m_pages[get_page_index(moved_id)][get_page_offset(moved_id)] = dense_index;
+                }
+
+                m_data.remove_at(last_index);
+                m_ids.remove_at(last_index);
+                m_pages[get_page_index(id)][get_page_offset(id)] = INVALID_INDEX;
+
+                return true;
+            }
+
+            /**
+             * Return the item for an ID.
+             *
+             * @param id The ID.
+             *
+             * @return A pointer to the item or `nullptr` if the ID isn't present.
+             *
+             * @remarks The returned pointer is only valid until the next insertion or removal.
+             */
+            JLT_NODISCARD const_pointer get(id_type const id) const {
+                index_type const dense_index = get_dense_index(id);
+
+                return dense_index != INVALID_INDEX ? &m_data[dense_index] : nullptr;
+            }
+
+            /**
+             * Return the item for an ID.
+             *
+             * @param id The ID.
+             *
+             * @return A pointer to the item or `nullptr` if the ID isn't present.
+             *
+             * @remarks The returned pointer is only valid until the next insertion or removal.
+             */
+            JLT_NODISCARD pointer get(id_type const id) {
+                const SparseSet *const self = this;
+
+                return const_cast<pointer>(self->get(id));
+            }
+
+            /**
+             * Check whether an ID is present.
+             *
+             * @param id The ID.
+             */
+            JLT_NODISCARD bool contains(id_type const id) const {
+                return get_dense_index(id) != INVALID_INDEX;
+            }
+
+            /**
+             * Return the ID of the item at a given position in the dense storage.
+             *
+             * @param i The index of the item, in iteration order.
+             */
+            JLT_NODISCARD id_type get_id_at(size_t const i) const { return m_ids[i]; }
+
+            /**
+             * Return the IDs of the items in dense order, or `nullptr` if the set is empty.
+             */
+            JLT_NODISCARD id_type const *get_ids() const { return m_ids.get_length() ? &m_ids[0] : nullptr; }
+
+            /**
+             * Return the item at a given position in the dense storage.
+             *
+             * @param i The index of the item, in iteration order.
+             */
+            JLT_NODISCARD reference get_at(size_t const i) { return m_data[i]; }
+            JLT_NODISCARD const_reference get_at(size_t const i) const { return m_data[i]; }
+
+            /**
+             * Remove all the items.
+             *
+             * @remarks The sparse pages are kept allocated, to be reused by the next insertions.
+             */
+            void clear() {
+                for(id_type const id : m_ids) {
+                    m_pages[get_page_index(id)][get_page_offset(id)] = INVALID_INDEX;
+                }
+
+                m_data.clear();
+                m_ids.clear();
+            }
+
+            /**
+             * Return the number of items.
+             */
+            JLT_NODISCARD size_t get_length() const { return m_data.get_length(); }
+
+            JLT_NODISCARD iterator begin() { return m_data.begin(); }
+            JLT_NODISCARD iterator end() { return m_data.end(); }
+
+            JLT_NODISCARD const_iterator begin() const { return m_data.begin(); }
+            JLT_NODISCARD const_iterator end() const { return m_data.end(); }
+
+            JLT_NODISCARD const_iterator cbegin() const { return m_data.cbegin(); }
+            JLT_NODISCARD const_iterator cend() const { return m_data.cend(); }
+        };
+
+        /**
+         * Call a function for each ID present in all of the given sparse sets.
+         *
+         * The smallest set is walked in dense order and the others are probed for each of its IDs,
+         * so the cost is proportional to the length of the smallest set.
+         *
+         * @param func The function to call, with signature `void(id_type id, T1 &item1, T2 &item2, ...)`,
+         * receiving the items of the ID in the same order as the sets. It must not add items to or
+         * remove items from the sets.
+         * @param sets The sets to join.
+         */
+        template<typename F, typename... Sets>
+        void sparse_set_join(F &&func, Sets &...sets) {
+            static_assert(sizeof...(Sets) > 0, "At least one set is required");
+
+            size_t const lengths[] = {sets.get_length()...};
+            size_t smallest = 0;
+
+            for(size_t i = 1; i < sizeof...(Sets); ++i) {
+                smallest = choose(i, smallest, lengths[i] < lengths[smallest]);
+            }
+
+            size_t const length = lengths[smallest];
+            typename std::tuple_element<0, std::tuple<Sets...>>::type::id_type const *const ids[] = {
+              sets.get_ids()...};
+
+            for(size_t i = 0; i < length; ++i) {
+                auto const id = ids[smallest][i];
+                auto const items = std::make_tuple(sets.get(id)...);
+
+                if(std::apply([](auto const... ptrs) { return (... && ptrs); }, items)) {
+                    std::apply([&func, id](auto const... ptrs) { func(id, *ptrs...); }, items);
+                }
+            }
+        }
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_SPARSESET_HPP */
@@ -0,0 +1,176 @@
+#ifndef JLT_COLLECTIONS_SPSCQUEUE_HPP
+#define JLT_COLLECTIONS_SPSCQUEUE_HPP
+
+#include <atomic>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/memory/allocator.hpp>
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Bounded, lock-free, single-producer/single-consumer ring buffer queue.
+         *
+         * Only one thread may push and only one thread may pop at any given time. The producer and
+         * consumer indices live on separate cache lines, and each side keeps a cached copy of the
+         * other side's index so that the shared line is only touched when the cached value says the
+         * queue is full (producer) or empty (consumer).
+         *
+         * @tparam T The type of item contained in the queue.
+         */
+        template<typename T>
+        class SPSCQueue {
+          public:
+            using value_type = T;
+            using pointer = T *;
+            using const_pointer = const T *;
+            using reference = T &;
+            using const_reference = const T &;
+
+          private:
+            using index_type = size_t;
+
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<index_type> m_head; //< Next slot to pop.
+            index_type m_cached_tail; //< Consumer-side copy of `m_tail`.
+
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<index_type> m_tail; //< Next slot to push.
+            index_type m_cached_head; //< Producer-side copy of `m_head`.
+
+            alignas(memory::CACHE_LINE_SIZE) pointer const m_data; //< Item storage.
+            index_type const m_mask;                                //< Capacity - 1.
+
+            /**
+             * Round a capacity up to the next power of two.
+             */
+            JLT_NODISCARD static constexpr index_type round_capacity(index_type const capacity) {
+                index_type result = 1;
+
+                while(result < capacity) { result <<= 1; }
+
+                return result;
+            }
+
+            template<typename V>
+            bool push_impl(V &&item) {
+                index_type const tail = m_tail.load(std::memory_order_relaxed);
+
+                if(tail - m_cached_head > m_mask) {
+                    m_cached_head = m_head.load(std::memory_order_acquire);
+
+                    if(tail - m_cached_head > m_mask) {
+                        return false;
+                    }
+                }
+
+                memory::construct(m_data + (tail & m_mask), std::forward<V>(item));
+                m_tail.store(tail + 1, std::memory_order_release);
+
+                return true;
+            }
+
+          public:
+            static constexpr size_t DEFAULT_CAPACITY = 1024; //< The default capacity.
+
+            /**
+             * Create a new queue.
+             *
+             * @param capacity The maximum number of items the queue can hold. It will be rounded up
+             * to the next power of two.
+             */
+            JLT_NODISCARD explicit SPSCQueue(size_t const capacity = DEFAULT_CAPACITY) :
+              m_head{0}, m_cached_tail{0}, m_tail{0}, m_cached_head{0},
+              m_data{memory::allocate_array<value_type>(round_capacity(capacity))},
+              m_mask{round_capacity(capacity) - 1} {
+                jltassert(capacity);
+            }
+
+            SPSCQueue(const SPSCQueue &) = delete;
+            SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+            ~SPSCQueue() {
+                if constexpr(!std::is_trivial<value_type>::value) {
+                    index_type const tail = m_tail.load(std::memory_order_acquire);
+
+                    for(index_type i = m_head.load(std::memory_order_acquire); i != tail; ++i) {
+                        m_data[i & m_mask].~value_type();
+                    }
+                }
+
+                memory::free_array(m_data, 0);
+            }
+
+            /**
+             * Add an item at the end of the queue. Must only be called by the producer thread.
+             *
+             * @param item The item to add.
+             *
+             * @return True if the item has been added, false if the queue is full.
+             */
+            JLT_NODISCARD bool push(const_reference item) { return push_impl(item); }
+
+            /**
+             * Add an item at the end of the queue by moving it. Must only be called by the producer thread.
+             *
+             * @param item The item to add.
+             *
+             * @return True if the item has been added, false if the queue is full.
+             */
+            JLT_NODISCARD bool push(value_type &&item) { return push_impl(std::move(item)); }
+
+            /**
+             * Remove an item from the beginning of the queue. Must only be called by the consumer thread.
+             *
+             * @param out_item The destination the item will be moved to.
+             *
+             * @return True if an item has been removed, false if the queue is empty.
+             */
+            JLT_NODISCARD bool pop(reference out_item) {
+                index_type const head = m_head.load(std::memory_order_relaxed);
+
+                if(head == m_cached_tail) {
+                    m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+                    if(head == m_cached_tail) {
+                        return false;
+                    }
+                }
+
+                pointer const item = m_data + (head & m_mask);
+
+                out_item = std::move(*item);
+
+                if constexpr(!std::is_trivial<value_type>::value) {
+                    item->~value_type();
+                }
+
+                m_head.store(head + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            /**
+             * Return the capacity of the queue.
+             */
+            JLT_NODISCARD size_t get_capacity() const { return m_mask + 1; }
+
+            /**
+             * Return the number of items in the queue.
+             *
+             * @remarks The value is approximate when read while the other side is pushing or popping.
+             */
+            JLT_NODISCARD size_t get_length() const {
+                return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+            }
+
+            /**
+             * Return a value stating whether the queue is empty.
+             *
+             * @remarks The value is approximate when read while the other side is pushing or popping.
+             */
+            JLT_NODISCARD bool is_empty() const { return get_length() == 0; }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_SPSCQUEUE_HPP */
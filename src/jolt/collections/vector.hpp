@@ -129,19 +129,27 @@ namespace jolt {
              */
             JLT_NODISCARD size_t get_length() const { return m_length; }
 
-            void set_length(size_t length) {
-                ensure_capacity(length);
+            /**
+             * Set the length of the vector. New items are default-constructed, removed items are
+             * destroyed.
+             *
+             * @param length The new length.
+             */
+            void set_length(size_t const length) {
+                if(length <= m_length) {
+                    truncate(length);
+                    return;
+                }
 
-                if constexpr(!std::is_trivial<value_type>::value) {
-                    if(length < m_length) {
-                        const_iterator end = cend();
+                ensure_capacity(length - m_length);
 
-                        for(iterator it = begin() + m_length; it != end; ++it) { (*it).~value_type(); }
-                    }
+                if constexpr(!std::is_trivial<value_type>::value) {
+                    for(size_t i = m_length; i < length; ++i) { memory::construct(m_data + i); }
                 }
 
                 m_length = length;
             }
+
             /**
              * Return the capacity of the vector.
              */
@@ -201,6 +209,13 @@ namespace jolt {
                 return m_data[i];
             }
 
+            /**
+             * Return a pointer to the storage of the items. The pointer is invalidated when the vector
+             * grows.
+             */
+            JLT_NODISCARD pointer get_data() { return m_data; }
+            JLT_NODISCARD const_pointer get_data() const { return m_data; }
+
             JLT_NODISCARD Vector<value_type> operator+(const Vector<value_type> &other) const {
                 memory::push_force_flags(m_alloc_flags);
 
@@ -315,7 +330,8 @@ namespace jolt {
                         --i) {
                         pointer const cur = m_data + i;
 
-                        memory::construct(cur + length, value_type(std::move(*cur)));
+                        memory::construct(cur + length, std::move(*cur));
+                        cur->~value_type();
                     }
 
                     pointer const base_pos = m_data + position;
@@ -349,7 +365,15 @@ namespace jolt {
              */
             value_type pop() {
                 jltassert(m_length);
-                return std::move(*(m_data + (--m_length)));
+
+                pointer const last = m_data + (--m_length);
+                value_type item{std::move(*last)};
+
+                if constexpr(!std::is_trivial<value_type>::value) {
+                    last->~value_type();
+                }
+
+                return item;
             }
 
             /**
@@ -387,31 +411,112 @@ namespace jolt {
              *
              * @param i The index of the item to remove.
              */
-            void remove_at(size_t i) {
+            void remove_at(size_t const i) { remove_range(i, 1); }
+
+            /**
+             * Remove an item from the vector given its position, replacing it with the last item.
+             * This is O(1) but doesn't preserve the order of the items.
+             *
+             * @param i The index of the item to remove.
+             */
+            void swap_remove_at(size_t const i) {
                 jltassert(i < m_length);
 
-                if constexpr(!std::is_trivial<value_type>::value) {
-                    m_data[i].~value_type();
+                size_t const last = m_length - 1;
+
+                if(i != last) {
+                    if constexpr(std::is_trivially_copyable<value_type>::value) {
+                        memcpy(m_data + i, m_data + last, sizeof(value_type));
+                    } else {
+                        m_data[i] = std::move(m_data[last]);
+                    }
+                }
+
+                truncate(last);
+            }
+
+            /**
+             * Remove a range of consecutive items from the vector, preserving the order of the
+             * remaining ones.
+             *
+             * @param position The index of the first item to remove.
+             * @param length The number of items to remove.
+             */
+            void remove_range(size_t const position, size_t const length) {
+                jltassert(position + length <= m_length);
+
+                size_t const tail_begin = position + length;
+
+                if constexpr(std::is_trivially_copyable<value_type>::value) {
+                    memmove(
+                      m_data + position, m_data + tail_begin, (m_length - tail_begin) * sizeof(value_type));
+                } else {
+                    for(size_t i = tail_begin; i < m_length; ++i) {
+                        m_data[i - length] = std::move(m_data[i]);
+                    }
                 }
 
-                for(; i < m_length - 1; ++i) { m_data[i] = std::move(m_data[i + 1]); }
+                truncate(m_length - length);
+            }
+
+            /**
+             * Remove all the items matching a predicate, preserving the order of the remaining ones.
+             * The items are compacted in a single pass.
+             *
+             * @param pred The predicate, with signature `bool(const_reference item)`.
+             *
+             * @return The number of removed items.
+             */
+            template<typename P>
+            size_t remove_if(P &&pred) {
+                size_t n_kept = 0;
 
-                --m_length;
+                for(size_t i = 0; i < m_length; ++i) {
+                    if(pred(const_cast<const_reference>(m_data[i]))) {
+                        continue;
+                    }
+
+                    if(n_kept != i) {
+                        if constexpr(std::is_trivially_copyable<value_type>::value) {
+                            memcpy(m_data + n_kept, m_data + i, sizeof(value_type));
+                        } else {
+                            m_data[n_kept] = std::move(m_data[i]);
+                        }
+                    }
+
+                    ++n_kept;
+                }
+
+                size_t const n_removed = m_length - n_kept;
+
+                truncate(n_kept);
+
+                return n_removed;
             }
 
             /**
-             * Remove all the items from the vector.
+             * Shorten the vector, destroying the items past the new length. Does nothing if the
+             * vector is already shorter. The capacity is unaffected.
+             *
+             * @param length The new length.
              */
-            void clear() {
-                if constexpr(!std::is_trivial<value_type>::value) {
-                    const_iterator end = cend();
+            void truncate(size_t const length) {
+                if(length >= m_length) {
+                    return;
+                }
 
-                    for(iterator it = begin(); it != end; ++it) { (*it).~value_type(); }
+                if constexpr(!std::is_trivial<value_type>::value) {
+                    for(size_t i = length; i < m_length; ++i) { m_data[i].~value_type(); }
                 }
 
-                m_length = 0;
+                m_length = length;
             }
 
+            /**
+             * Remove all the items from the vector.
+             */
+            void clear() { truncate(0); }
+
             JLT_NODISCARD bool contains(const_reference value) const { return find(value) >= 0; }
 
             JLT_NODISCARD constexpr iterator begin() { return iterator{m_data}; }
@@ -0,0 +1,228 @@
+#ifndef JLT_COLLECTIONS_WORKSTEALINGDEQUE_HPP
+#define JLT_COLLECTIONS_WORKSTEALINGDEQUE_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+
+namespace jolt {
+    namespace collections {
+        /**
+         * Unbounded, lock-free Chase-Lev work-stealing deque.
+         *
+         * The owner thread pushes and pops items at the bottom end, in LIFO order, without any atomic
+         * read-modify-write operation unless the deque holds a single item. Any other thread can steal
+         * items from the top end, in FIFO order. When full, the ring buffer is replaced by one twice
+         * as large; the old buffers are kept until destruction because a thief may still be reading
+         * from them.
+         *
+         * @tparam T The type of item contained in the deque. It must be trivially copyable, e.g. a
+         * pointer to a job.
+         */
+        template<typename T>
+        class WorkStealingDeque {
+          public:
+            using value_type = T;
+            using reference = T &;
+
+            static constexpr size_t DEFAULT_CAPACITY = 256; //< Default initial capacity.
+
+            static_assert(
+              std::is_trivially_copyable<value_type>::value,
+              "WorkStealingDeque items must be trivially copyable.");
+
+          private:
+            using index_type = int64_t;
+
+            struct Buffer {
+                std::atomic<value_type> *m_items; //< Ring of items.
+                index_type m_mask;                //< Capacity - 1.
+                Buffer *m_retired;                //< Previously used buffer, if any.
+
+                JLT_NODISCARD value_type get(index_type const i) const {
+                    return m_items[i & m_mask].load(std::memory_order_relaxed);
+                }
+
+                void put(index_type const i, value_type const item) {
+                    m_items[i & m_mask].store(item, std::memory_order_relaxed);
+                }
+            };
+
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<index_type> m_top;    //< Next item to steal.
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<index_type> m_bottom; //< Next slot to push.
+            std::atomic<Buffer *> m_buffer;                                    //< Current buffer.
+            memory::flags_t m_alloc_flags;                                     //< Allocation flags.
+
+            JLT_NODISCARD Buffer *create_buffer(size_t const capacity, Buffer *const retired) {
+                memory::push_force_flags(m_alloc_flags);
+
+                Buffer *const buffer = memory::allocate<Buffer>();
+
+                buffer->m_items = memory::allocate_array<std::atomic<value_type>>(capacity);
+                buffer->m_mask = static_cast<index_type>(capacity - 1);
+                buffer->m_retired = retired;
+
+                memory::pop_force_flags();
+
+                return buffer;
+            }
+
+            /**
+             * Replace the buffer with one twice as large, containing the same items.
+             */
+            JLT_NODISCARD Buffer *grow(Buffer *const buffer, index_type const top, index_type const bottom) {
+                Buffer *const new_buffer = create_buffer(static_cast<size_t>(buffer->m_mask + 1) * 2, buffer);
+
+                for(index_type i = top; i < bottom; ++i) { new_buffer->put(i, buffer->get(i)); }
+
+                m_buffer.store(new_buffer, std::memory_order_release);
+
+                return new_buffer;
+            }
+
+          public:
+            /**
+             * Create a new empty deque.
+             *
+             * @param initial_capacity The number of items the deque will be able to hold before
+             * growing. Rounded up to a power of two.
+             */
+            JLT_NODISCARD explicit WorkStealingDeque(size_t const initial_capacity = DEFAULT_CAPACITY) :
+              m_top{0}, m_bottom{0}, m_buffer{nullptr}, m_alloc_flags{memory::get_current_force_flags()} {
+                m_buffer.store(
+                  create_buffer(std::bit_ceil(max<size_t>(initial_capacity, 2)), nullptr),
+                  std::memory_order_relaxed);
+            }
+
+            WorkStealingDeque(WorkStealingDeque const &) = delete;
+            WorkStealingDeque &operator=(WorkStealingDeque const &) = delete;
+
+            ~WorkStealingDeque() {
+                for(Buffer *buffer = m_buffer.load(std::memory_order_relaxed); buffer;) {
+                    Buffer *const retired = buffer->m_retired;
+
+                    memory::free_array(buffer->m_items);
+                    memory::free(buffer);
+
+                    buffer = retired;
+                }
+            }
+
+            /**
+             * Push an item at the bottom end. Must only be called by the owner thread.
+             *
+             * @param item The item to push.
+             */
+            void push(value_type const item) {
+                index_type const bottom = m_bottom.load(std::memory_order_relaxed);
+                index_type const top = m_top.load(std::memory_order_acquire);
+                Buffer *buffer = m_buffer.load(std::memory_order_relaxed);
+
+                if(bottom - top > buffer->m_mask) {
+                    buffer = grow(buffer, top, bottom);
+                }
+
+                buffer->put(bottom, item);
+
+                std::atomic_thread_fence(std::memory_order_release);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            /**
+             * Pop the item at the bottom end, i.e. the most recently pushed one. Must only be called by
+             * the owner thread.
+             *
+             * @param out_item The popped item.
+             *
+             * @return True if an item was popped, false if the deque was empty or its last item was
+             * stolen concurrently.
+             */
+            JLT_NODISCARD bool pop(reference out_item) {
+                index_type const bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                Buffer *const buffer = m_buffer.load(std::memory_order_relaxed);
+
+                m_bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                index_type top = m_top.load(std::memory_order_relaxed);
+
+                if(top > bottom) {
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+                    return false;
+                }
+
+                out_item = buffer->get(bottom);
+
+                if(top == bottom) {
+                    // Last item: race against the thieves for it
+                    bool const won = m_top.compare_exchange_strong(
+                      top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+                    return won;
+                }
+
+                return true;
+            }
+
+            /**
+             * Steal the item at the top end, i.e. the least recently pushed one. Can be called by any
+             * thread.
+             *
+             * @param out_item The stolen item.
+             *
+             * @return True if an item was stolen, false if the deque was empty or another thread took
+             * the item first.
+             */
+            JLT_NODISCARD bool steal(reference out_item) {
+                index_type top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                index_type const bottom = m_bottom.load(std::memory_order_acquire);
+
+                if(top >= bottom) {
+                    return false;
+                }
+
+                value_type const item = m_buffer.load(std::memory_order_acquire)->get(top);
+
+                if(!m_top.compare_exchange_strong(
+                     top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    return false;
+                }
+
+                out_item = item;
+
+                return true;
+            }
+
+            /**
+             * Return the number of items. The value is only a snapshot when other threads are using the
+             * deque.
+             */
+            JLT_NODISCARD size_t get_length() const {
+                index_type const bottom = m_bottom.load(std::memory_order_relaxed);
+                index_type const top = m_top.load(std::memory_order_relaxed);
+
+                return static_cast<size_t>(max<index_type>(bottom - top, 0));
+            }
+
+            JLT_NODISCARD bool is_empty() const { return get_length() == 0; }
+
+            /**
+             * Return the capacity of the current buffer.
+             */
+            JLT_NODISCARD size_t get_capacity() const {
+                return static_cast<size_t>(m_buffer.load(std::memory_order_relaxed)->m_mask + 1);
+            }
+        };
+    } // namespace collections
+} // namespace jolt
+
+#endif /* JLT_COLLECTIONS_WORKSTEALINGDEQUE_HPP */
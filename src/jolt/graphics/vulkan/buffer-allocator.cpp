@@ -20,7 +20,7 @@ namespace jolt::graphics::vulkan {
         if(compat && compat->get_size() <= MAX_SIZE_COMPATIBILITY_FACTOR * size) {
             Buffer b = *compat;
 
-            m_unused_buffers.remove(*compat);
+            m_unused_buffers.swap_remove_at(compat - m_unused_buffers.get_data());
 
             return b;
         }
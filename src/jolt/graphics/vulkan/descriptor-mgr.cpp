@@ -4,7 +4,7 @@ namespace jolt {
     namespace graphics {
         namespace vulkan {
             DescriptorManager::DescriptorManager(
-              Renderer &renderer, uint32_t const max_descriptor_sets, pool_size_vector const &pool_sizes) :
+              Renderer &renderer, uint32_t const max_descriptor_sets, pool_size_span const pool_sizes) :
               m_renderer{renderer} {
                 create_descriptor_pool(max_descriptor_sets, pool_sizes);
             }
@@ -12,14 +12,14 @@ namespace jolt {
             DescriptorManager::~DescriptorManager() { destroy_descriptor_pool(); }
 
             void DescriptorManager::create_descriptor_pool(
-              uint32_t const max_descriptor_sets, pool_size_vector const &pool_sizes) {
+              uint32_t const max_descriptor_sets, pool_size_span const pool_sizes) {
                 VkDescriptorPoolCreateInfo pcinfo{
                   VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,     // sType
                   nullptr,                                           // pNext
                   VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, // flags
                   max_descriptor_sets,                               // maxSets
                   static_cast<uint32_t>(pool_sizes.get_length()),    // poolSizeCount
-                  &pool_sizes[0]                                     // pPoolSizes
+                  pool_sizes.get_data()                              // pPoolSizes
                 };
 
                 VkResult result = vkCreateDescriptorPool(
@@ -33,7 +33,7 @@ namespace jolt {
             }
 
             VkDescriptorSetLayout DescriptorManager::create_descriptor_set_layout(
-              descriptor_set_layout_binding_vector const &bindings) {
+              descriptor_set_layout_binding_span const bindings) {
                 VkDescriptorSetLayout layout;
 
                 VkDescriptorSetLayoutCreateInfo cinfo{
@@ -41,7 +41,7 @@ namespace jolt {
                   nullptr,                                             // pNext
                   0,                                                   // flags
                   static_cast<uint32_t>(bindings.get_length()),        // bindingCount
-                  &bindings[0],                                        // pBindings
+                  bindings.get_data(),                                 // pBindings
                 };
 
                 VkResult result = vkCreateDescriptorSetLayout(
@@ -60,15 +60,15 @@ namespace jolt {
             }
 
             VkPipelineLayout DescriptorManager::create_pipeline_layout(
-              descriptor_set_layout_vector const &layouts, push_const_range_vector const &pc_ranges) {
+              descriptor_set_layout_span const layouts, push_const_range_span const pc_ranges) {
                 VkPipelineLayoutCreateInfo cinfo{
                   VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,   // sType
                   nullptr,                                         // pNext
                   0,                                               // flags
                   static_cast<uint32_t>(layouts.get_length()),     // setLayoutCount
-                  layouts.get_length() ? &layouts[0] : nullptr,    // pSetLayouts
+                  layouts.get_data(),                              // pSetLayouts
                   static_cast<uint32_t>(pc_ranges.get_length()),   // pushConstanteRangeCount
-                  pc_ranges.get_length() ? &pc_ranges[0] : nullptr // pPushConstantRanges
+                  pc_ranges.get_data()                             // pPushConstantRanges
                 };
 
                 VkPipelineLayout pipeline_layout;
@@ -81,7 +81,7 @@ namespace jolt {
             }
 
             DescriptorManager::descriptor_set_vector DescriptorManager::allocate_descriptor_sets(
-              descriptor_set_layout_vector const &descriptor_set_layouts) {
+              descriptor_set_layout_span const descriptor_set_layouts) {
                 descriptor_set_vector sets{descriptor_set_layouts.get_length()};
 
                 VkDescriptorSetAllocateInfo ainfo{
@@ -89,7 +89,7 @@ namespace jolt {
                   nullptr,                                                    // pNext
                   m_descriptor_pool,                                          // descriptorPool
                   static_cast<uint32_t>(descriptor_set_layouts.get_length()), // descriptorSetCount
-                  &descriptor_set_layouts[0]                                  // pSetLayouts
+                  descriptor_set_layouts.get_data()                           // pSetLayouts
                 };
 
                 sets.set_length(descriptor_set_layouts.get_length());
@@ -100,13 +100,13 @@ namespace jolt {
                 return sets;
             }
 
-            void DescriptorManager::free_descriptor_sets(descriptor_set_vector const &descriptor_sets) {
+            void DescriptorManager::free_descriptor_sets(descriptor_set_span const descriptor_sets) {
                 if(descriptor_sets.get_length()) {
                     vkFreeDescriptorSets(
                       m_renderer.get_device(),
                       m_descriptor_pool,
                       static_cast<uint32_t>(descriptor_sets.get_length()),
-                      &descriptor_sets[0]);
+                      descriptor_sets.get_data());
                 }
             }
         } // namespace vulkan
@@ -3,6 +3,7 @@
 
 #include <jolt/api.hpp>
 #include <jolt/collections/vector.hpp>
+#include <jolt/collections/span.hpp>
 #include "defs.hpp"
 
 namespace jolt {
@@ -18,13 +19,19 @@ namespace jolt {
                 using descriptor_set_layout_binding_vector =
                   collections::Vector<VkDescriptorSetLayoutBinding>;
                 using pool_size_vector = collections::Vector<VkDescriptorPoolSize>;
+                using descriptor_set_span = collections::Span<const VkDescriptorSet>;
+                using descriptor_set_layout_span = collections::Span<const VkDescriptorSetLayout>;
+                using push_const_range_span = collections::Span<const VkPushConstantRange>;
+                using descriptor_set_layout_binding_span =
+                  collections::Span<const VkDescriptorSetLayoutBinding>;
+                using pool_size_span = collections::Span<const VkDescriptorPoolSize>;
 
               private:
                 Renderer &m_renderer;
                 VkDescriptorPool m_descriptor_pool;
 
-                void create_descriptor_pool(
-                  uint32_t const max_descriptor_sets, pool_size_vector const &pool_sizes);
+                void
+                create_descriptor_pool(uint32_t const max_descriptor_sets, pool_size_span const pool_sizes);
                 void destroy_descriptor_pool();
 
               public:
@@ -37,16 +44,21 @@ namespace jolt {
                  * @param pool_sizes Collection of pool size objects to initialize the descriptor pool.
                  */
                 DescriptorManager(
-                  Renderer &renderer, uint32_t const max_descriptor_sets, pool_size_vector const &pool_sizes);
+                  Renderer &renderer, uint32_t const max_descriptor_sets, pool_size_span const pool_sizes);
                 ~DescriptorManager();
 
                 VkDescriptorPool get_descriptor_pool() const { return m_descriptor_pool; }
                 Renderer const &get_renderer() const { return m_renderer; }
 
+                /**
+                 * Allocate one descriptor set for each of the given layouts.
+                 *
+                 * @param descriptor_set_layouts The layouts of the descriptor sets.
+                 */
                 descriptor_set_vector
-                allocate_descriptor_sets(descriptor_set_layout_vector const &descriptor_set_layouts);
+                allocate_descriptor_sets(descriptor_set_layout_span const descriptor_set_layouts);
 
-                void free_descriptor_sets(descriptor_set_vector const &descriptor_sets);
+                void free_descriptor_sets(descriptor_set_span const descriptor_sets);
 
                 /**
                  * Create a new descriptor set layout.
@@ -54,7 +66,7 @@ namespace jolt {
                  * @param bindings The collection of bindings for the layout.
                  */
                 VkDescriptorSetLayout
-                create_descriptor_set_layout(descriptor_set_layout_binding_vector const &bindings);
+                create_descriptor_set_layout(descriptor_set_layout_binding_span const bindings);
 
                 /**
                  * Destroy a descriptor set layout.
@@ -70,7 +82,7 @@ namespace jolt {
                  * @param pc_ranges The push constant ranges.
                  */
                 VkPipelineLayout create_pipeline_layout(
-                  descriptor_set_layout_vector const &layouts, push_const_range_vector const &pc_ranges);
+                  descriptor_set_layout_span const layouts, push_const_range_span const pc_ranges);
 
                 /**
                  * Destroy a pipeline layout.
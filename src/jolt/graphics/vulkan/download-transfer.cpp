@@ -74,7 +74,7 @@ namespace jolt::graphics::vulkan {
 
         fence.wait(SYNCHRO_WAIT_MAX);
         staging_buffer.download(descriptor.data.download_data, descriptor.size);
-        m_downloaded_image_descriptors.push(descriptor);
+        m_downloaded_image_descriptors.push_back(descriptor);
     }
 
     void DownloadTransfer::transfer_buffer(TransferDescriptor const &descriptor) {
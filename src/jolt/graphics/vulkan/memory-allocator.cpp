@@ -17,30 +17,28 @@ namespace jolt::graphics::vulkan {
     }
 
     void PhysicalMemoryRegion::register_ref(VirtualMemoryRegion *const region) {
-        vmr_refs::Node *prev = nullptr, *cur = m_refs.get_first_node();
+        VirtualMemoryRegion *prev = nullptr, *cur = m_refs.get_first();
         VkDeviceSize const offset = region->get_offset();
 
         while(cur) {
-            if(cur->get_value()->get_offset() > offset) {
+            if(cur->get_offset() > offset) {
                 break;
             }
 
             prev = cur;
-            cur = prev->get_next();
+            cur = vmr_refs::get_next(*prev);
         }
 
-        m_refs.add_after(region, prev);
+        m_refs.add_after(*region, prev);
         m_allocated_size += region->get_size();
     }
 
     void PhysicalMemoryRegion::unregister_ref(VirtualMemoryRegion *const region) {
-        vmr_refs::Node *const node = m_refs.find(region);
+        jltassert2(m_refs.contains(*region), "Attempting to unregister a non-registered reference");
 
         m_allocated_size -= region->get_size();
 
-        jltassert2(node, "Attempting to unregister a non-registered reference");
-
-        m_refs.remove(*node);
+        m_refs.remove(*region);
     }
 
     VkDeviceSize PhysicalMemoryRegion::find_free_region(VkDeviceSize const size, bool const exact) const {
@@ -55,12 +53,11 @@ namespace jolt::graphics::vulkan {
             }
 
             // Inner gaps
-            vmr_refs::Node *prev = m_refs.get_first_node(),
-                           *cur = prev->get_next() /* Safe as we know length > 0 */;
+            VirtualMemoryRegion *prev = first, *cur = vmr_refs::get_next(*first);
 
             while(cur) {
-                VirtualMemoryRegion &prev_region = *prev->get_value();
-                VirtualMemoryRegion &cur_region = *cur->get_value();
+                VirtualMemoryRegion &prev_region = *prev;
+                VirtualMemoryRegion &cur_region = *cur;
                 VkDeviceSize const gap_begin = prev_region.get_offset() + prev_region.get_size();
                 VkDeviceSize const gap_size = cur_region.get_offset() - gap_begin;
 
@@ -70,11 +67,11 @@ namespace jolt::graphics::vulkan {
 
                 // Next gap
                 prev = cur;
-                cur = prev->get_next();
+                cur = vmr_refs::get_next(*prev);
             }
 
             // Gap between last and end - prev now is the last region in the list
-            VirtualMemoryRegion &prev_region = *prev->get_value();
+            VirtualMemoryRegion &prev_region = *prev;
             VkDeviceSize const gap_begin = prev_region.get_offset() + prev_region.get_size();
             VkDeviceSize const gap_size = m_size - gap_begin;
 
@@ -101,9 +98,7 @@ namespace jolt::graphics::vulkan {
 
     MemoryAllocator::~MemoryAllocator() {
         for(PhysicalMemoryRegion *const phy : m_phy_regions) {
-            for(VirtualMemoryRegion *const vmr : phy->get_references()) { jltfree(vmr); }
-
-            phy->get_references().clear();
+            while(VirtualMemoryRegion *const vmr = phy->get_references().pop_front()) { jltfree(vmr); }
             free_phy(phy);
         }
     }
@@ -234,16 +229,15 @@ namespace jolt::graphics::vulkan {
     }
 
     void MemoryAllocator::recycle() {
-        collections::Vector<PhysicalMemoryRegion *> recycled_regions;
-
-        for(PhysicalMemoryRegion *const region : m_phy_regions) {
+        m_phy_regions.remove_if([this](PhysicalMemoryRegion *const region) {
             if(region->get_references().get_length() == 0) {
                 free_phy(region);
-                recycled_regions.push(region);
+
+                return true;
             }
-        }
 
-        for(PhysicalMemoryRegion *const region : recycled_regions) { m_phy_regions.remove(region); }
+            return false;
+        });
     }
 
     VkDeviceSize MemoryAllocator::get_allocated_size(uint32_t memory_type_mask) const {
@@ -299,7 +293,7 @@ namespace jolt::graphics::vulkan {
         }
 
         if(m_regions.get_length()) {
-            quicksort(&m_regions[0], m_regions.get_length(), [](DefragPhysicalMemoryRegion &r) {
+            sort(&m_regions[0], m_regions.get_length(), [](DefragPhysicalMemoryRegion &r) {
                 return r.phy->get_allocated_size();
             });
         }
@@ -381,8 +375,8 @@ namespace jolt::graphics::vulkan {
         PhysicalMemoryRegion &phy = *region.phy;
         bool has_non_relocatable_vmrs = false;
 
-        for(VirtualMemoryRegion *const vmr : region.phy->get_references()) {
-            if(!vmr->is_relocatable()) {
+        for(VirtualMemoryRegion const &vmr : region.phy->get_references()) {
+            if(!vmr.is_relocatable()) {
                 has_non_relocatable_vmrs = true;
                 break;
             }
@@ -421,14 +415,14 @@ namespace jolt::graphics::vulkan {
         VkDeviceSize cur_offset_unaligned = 0;
         collections::Vector<VkBufferMemoryBarrier> barriers;
 
-        for(VirtualMemoryRegion *const vmr : phy.get_references()) {
+        for(VirtualMemoryRegion &vmr : phy.get_references()) {
             VkDeviceSize const new_offset = reinterpret_cast<VkDeviceSize>(
-              jolt::align_raw_ptr(reinterpret_cast<void *>(cur_offset_unaligned), vmr->get_alignment()));
+              jolt::align_raw_ptr(reinterpret_cast<void *>(cur_offset_unaligned), vmr.get_alignment()));
 
             VkBufferCopy copy_region{
-              vmr->get_offset() + vmr->get_padding(), // srcOffset
-              new_offset,                             // dstOffset
-              vmr->get_size() - vmr->get_padding()    // size
+              vmr.get_offset() + vmr.get_padding(), // srcOffset
+              new_offset,                           // dstOffset
+              vmr.get_size() - vmr.get_padding()    // size
             };
 
             vkCmdCopyBuffer(cmd_buffer, region.buffer, region.compact_memory_buffer, 1, &copy_region);
@@ -453,13 +447,13 @@ namespace jolt::graphics::vulkan {
             region.compact_memory = tmp_memory;
 
             // Update vmr metadata
-            VirtualMemoryRegionEditor v_editor{*vmr};
+            VirtualMemoryRegionEditor v_editor{vmr};
 
             v_editor.set_offset(new_offset);
             v_editor.set_padding(new_offset - cur_offset_unaligned);
 
-            m_relocated.push(vmr);
-            cur_offset_unaligned += vmr->get_size();
+            m_relocated.push(&vmr);
+            cur_offset_unaligned += vmr.get_size();
         }
 
         vkCmdPipelineBarrier(
@@ -486,9 +480,9 @@ namespace jolt::graphics::vulkan {
         collections::Vector<VirtualMemoryRegion *> vm_regions;
 
         // Only consider relocatable regions.
-        for(VirtualMemoryRegion *region : e.phy->get_references()) {
-            if(region->is_relocatable()) {
-                vm_regions.push(region);
+        for(VirtualMemoryRegion &region : e.phy->get_references()) {
+            if(region.is_relocatable()) {
+                vm_regions.push(&region);
             }
         }
 
@@ -496,7 +490,7 @@ namespace jolt::graphics::vulkan {
             return;
         }
 
-        quicksort(&vm_regions[0], vm_regions.get_length(), [](VirtualMemoryRegion *r) {
+        sort(&vm_regions[0], vm_regions.get_length(), [](VirtualMemoryRegion *r) {
             return static_cast<long long>(r->get_size()) * -1;
         });
 
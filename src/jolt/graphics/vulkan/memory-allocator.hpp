@@ -2,12 +2,13 @@
 #define JLT_GRAPHICS_VULKAN_ALLOCATOR_HPP
 
 #include <jolt/collections/vector.hpp>
-#include <jolt/collections/linkedlist.hpp>
+#include <jolt/collections/span.hpp>
+#include <jolt/collections/intrusivelist.hpp>
 #include <jolt/graphics/vulkan/defs.hpp>
 
 namespace jolt::graphics::vulkan {
     class Renderer;
-    class VirtualMemoryRegion;
+    class PhysicalMemoryRegion;
 
     using GPUAllocationFlagsBits = uint32_t;
 
@@ -19,6 +20,72 @@ namespace jolt::graphics::vulkan {
     /// Default physical memory region allocation size.
     static constexpr VkDeviceSize DEFAULT_PHY_REGION_ALLOC_SZ = 10 * 1024 * 1024; // 10 MiB
 
+    /**
+     * A virtual memory region allocated from a physical memory region.
+     *
+     * @remarks Virtual meomry regions are much cheaper to allocate and free in comparison to physical memory
+     * regions because they require no driver intervention.
+     */
+    class VirtualMemoryRegion {
+        friend class VirtualMemoryRegionEditor;
+        friend class PhysicalMemoryRegion;
+
+        PhysicalMemoryRegion *m_phy_region = nullptr;
+        VkDeviceSize m_phy_offset = 0; //< Offset from the beginning of the physical memory region.
+        VkDeviceSize m_size = 0;
+        VkDeviceSize m_alignment = 0; //< Alignment requirement.
+        VkDeviceSize m_padding = 0;   //< Amount of bytes used as padding to ensure alignment.
+        GPUAllocationFlags m_flags = GPU_ALLOC_NONE;
+        collections::IntrusiveListHook<VirtualMemoryRegion> m_refs_hook; //< Link in the physical region refs.
+
+      public:
+        VirtualMemoryRegion() = default;
+        VirtualMemoryRegion(VirtualMemoryRegion const &) = delete;
+        VirtualMemoryRegion(VirtualMemoryRegion &&other) = delete;
+
+        VirtualMemoryRegion(
+          PhysicalMemoryRegion &phy_region,
+          VkDeviceSize const phy_offset,
+          VkDeviceSize const size,
+          VkDeviceSize const alignment,
+          VkDeviceSize const padding,
+          GPUAllocationFlags const flags) :
+          m_phy_region{&phy_region},
+          m_phy_offset{phy_offset}, m_size{size}, m_alignment{alignment}, m_padding{padding}, m_flags{flags} {
+        }
+
+        /**
+         * Check if this region is valid (i.e. its parent physical memory region is not NULL).
+         */
+        bool is_valid() const { return m_phy_region; }
+        PhysicalMemoryRegion *get_physical_region() const { return m_phy_region; }
+        VkDeviceSize get_offset() const { return m_phy_offset; }
+        VkDeviceSize get_size() const { return m_size; }
+        VkDeviceSize get_alignment() const { return m_alignment; }
+        VkDeviceSize get_padding() const { return m_padding; }
+        inline VkDeviceMemory get_memory() const;
+
+        /**
+         * @return A boolean value stating whether the this region can be relocated during defragmentation.
+         */
+        bool is_relocatable() const { return !(m_flags & GPU_ALLOC_NON_RELOCATABLE); }
+        GPUAllocationFlags get_flags() const { return m_flags; }
+
+        void set_flags(GPUAllocationFlags const value) { m_flags = value; }
+
+        /// @{
+        /**
+         * Compares two virtual memory regions for equality. Two virtual memory regions are equal if their
+         * physical memory regions and offsets are the same.
+         */
+        bool operator==(VirtualMemoryRegion &other) const {
+            return m_phy_region == other.m_phy_region && m_phy_offset == other.m_phy_offset;
+        }
+
+        bool operator!=(VirtualMemoryRegion &other) const { return !(*this == other); }
+        ///@}
+    };
+
     /**
      * A memory region directly allocated from the GPU.
      */
@@ -26,9 +93,10 @@ namespace jolt::graphics::vulkan {
         friend class PhysicalMemoryRegionEditor;
 
       public:
-        using vmr_refs =
-          collections::LinkedList<VirtualMemoryRegion *>; /*< Collection of virtual memory regions allocated
-                                                             from the same physical region. */
+        using vmr_refs = collections::IntrusiveList<
+          VirtualMemoryRegion,
+          &VirtualMemoryRegion::m_refs_hook>; /*< Collection of virtual memory regions allocated from the same
+                                                 physical region, sorted by offset. */
 
       private:
         uint32_t m_memory_type_index;
@@ -121,69 +189,9 @@ namespace jolt::graphics::vulkan {
         void set_memory(VkDeviceMemory const value) { m_region.m_memory = value; }
     };
 
-    /**
-     * A virtual memory region allocated from a physical memory region.
-     *
-     * @remarks Virtual meomry regions are much cheaper to allocate and free in comparison to physical memory
-     * regions because they require no driver intervention.
-     */
-    class VirtualMemoryRegion {
-        friend class VirtualMemoryRegionEditor;
-
-        PhysicalMemoryRegion *m_phy_region = nullptr;
-        VkDeviceSize m_phy_offset = 0; //< Offset from the beginning of the physical memory region.
-        VkDeviceSize m_size = 0;
-        VkDeviceSize m_alignment = 0; //< Alignment requirement.
-        VkDeviceSize m_padding = 0;   //< Amount of bytes used as padding to ensure alignment.
-        GPUAllocationFlags m_flags = GPU_ALLOC_NONE;
-
-      public:
-        VirtualMemoryRegion() = default;
-        VirtualMemoryRegion(VirtualMemoryRegion const &) = delete;
-        VirtualMemoryRegion(VirtualMemoryRegion &&other) = delete;
-
-        VirtualMemoryRegion(
-          PhysicalMemoryRegion &phy_region,
-          VkDeviceSize const phy_offset,
-          VkDeviceSize const size,
-          VkDeviceSize const alignment,
-          VkDeviceSize const padding,
-          GPUAllocationFlags const flags) :
-          m_phy_region{&phy_region},
-          m_phy_offset{phy_offset}, m_size{size}, m_alignment{alignment}, m_padding{padding}, m_flags{flags} {
-        }
-
-        /**
-         * Check if this region is valid (i.e. its parent physical memory region is not NULL).
-         */
-        bool is_valid() const { return m_phy_region; }
-        PhysicalMemoryRegion *get_physical_region() const { return m_phy_region; }
-        VkDeviceSize get_offset() const { return m_phy_offset; }
-        VkDeviceSize get_size() const { return m_size; }
-        VkDeviceSize get_alignment() const { return m_alignment; }
-        VkDeviceSize get_padding() const { return m_padding; }
-        VkDeviceMemory get_memory() const { return m_phy_region ? m_phy_region->get_memory() : nullptr; }
-
-        /**
-         * @return A boolean value stating whether the this region can be relocated during defragmentation.
-         */
-        bool is_relocatable() const { return !(m_flags & GPU_ALLOC_NON_RELOCATABLE); }
-        GPUAllocationFlags get_flags() const { return m_flags; }
-
-        void set_flags(GPUAllocationFlags const value) { m_flags = value; }
-
-        /// @{
-        /**
-         * Compares two virtual memory regions for equality. Two virtual memory regions are equal if their
-         * physical memory regions and offsets are the same.
-         */
-        bool operator==(VirtualMemoryRegion &other) const {
-            return m_phy_region == other.m_phy_region && m_phy_offset == other.m_phy_offset;
-        }
-
-        bool operator!=(VirtualMemoryRegion &other) const { return !(*this == other); }
-        ///@}
-    };
+    VkDeviceMemory VirtualMemoryRegion::get_memory() const {
+        return m_phy_region ? m_phy_region->get_memory() : nullptr;
+    }
 
     class VirtualMemoryRegionEditor {
         VirtualMemoryRegion &m_region;
@@ -203,6 +211,7 @@ namespace jolt::graphics::vulkan {
     class JLTAPI MemoryAllocator {
       public:
         using phy_regions = collections::Vector<PhysicalMemoryRegion *>;
+        using phy_region_span = collections::Span<PhysicalMemoryRegion *const>;
 
       private:
         struct find_region_by_memory_type_result {
@@ -291,8 +300,11 @@ namespace jolt::graphics::vulkan {
          */
         void recycle();
 
-        phy_regions get_physical_regions() { return m_phy_regions; }
-        phy_regions const get_physical_regions() const { return m_phy_regions; }
+        /**
+         * Return the physical memory regions currently allocated. The returned view is invalidated by
+         * any allocation or recycling.
+         */
+        phy_region_span get_physical_regions() const { return m_phy_regions; }
 
         /**
          * Return the virtually allocated amount of memory for one specific memory type. This is the amount of
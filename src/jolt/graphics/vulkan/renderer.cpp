@@ -7,6 +7,7 @@
 #include <jolt/text/stringbuilder.hpp>
 #include <jolt/graphics/vulkan.hpp>
 #include <jolt/collections/hashmap.hpp>
+#include <jolt/collections/perfecthashmap.hpp>
 
 #ifdef _WIN32
     #define OS_SPECIFIC_SURFACE_EXTENSION VK_KHR_WIN32_SURFACE_EXTENSION_NAME
@@ -106,18 +107,64 @@ static void log_phy_devs(It const &begin, It const &end) {
     }
 }
 
+/**
+ * A required layer or extension name, paired with its index in the list of required names.
+ */
+using required_name = jolt::collections::KeyValuePair<std::string_view, size_t>;
+
+static const char *get_props_name(VkLayerProperties const &props) { return props.layerName; }
+static const char *get_props_name(VkExtensionProperties const &props) { return props.extensionName; }
+
+/**
+ * Select the required layers or extensions among the available ones, aborting if any is missing.
+ *
+ * @param required The required names.
+ * @param required_map Perfect hash map built from `required`.
+ * @param available The properties of the available layers or extensions.
+ * @param kind What is being selected, for logging.
+ *
+ * @return The required names, in the same order as `required`.
+ */
+template<size_t N, typename M, typename P>
+static jolt::collections::Vector<const char *> select_required_names(
+  required_name const (&required)[N],
+  M const &required_map,
+  jolt::collections::Array<P> const &available,
+  const char *const kind) {
+    jolt::collections::Vector<const char *> selected;
+    bool found[N]{};
+
+    for(P const &props : available) {
+        if(size_t const *const index = required_map.get_value(get_props_name(props))) {
+            found[*index] = true;
+        }
+    }
+
+    for(size_t i = 0; i < N; ++i) {
+        const char *const name = required[i].m_key.data();
+
+        if(found[i]) {
+            jolt::console.debug("Found required " + s(kind) + " " + s(name));
+
+            selected.push(name);
+        } else {
+            jolt::console.err("Required " + s(kind) + " " + s(name) + " not found");
+            abort();
+        }
+    }
+
+    return selected;
+}
+
 namespace jolt {
     namespace graphics {
         namespace vulkan {
             Renderer::layer_vector Renderer::select_required_layers() {
-                layer_vector layers; // Layers that will be returned
-                uint32_t n_available_layers;
-                const char *required_layers[] = {
 #ifdef _DEBUG
-                  "VK_LAYER_KHRONOS_validation"
-#endif // _DEBUG
-                };
-                const size_t required_layers_length = sizeof(required_layers) / sizeof(const char *);
+                static constexpr required_name required_layers[] = {{"VK_LAYER_KHRONOS_validation", 0}};
+                static constexpr auto required_layers_map =
+                  collections::make_perfect_hash_map(required_layers);
+                uint32_t n_available_layers;
 
                 vkEnumerateInstanceLayerProperties(&n_available_layers, nullptr);
 
@@ -125,99 +172,40 @@ namespace jolt {
 
                 vkEnumerateInstanceLayerProperties(&n_available_layers, layer_props);
 
-                for(size_t i = 0; i < required_layers_length; ++i) {
-                    bool found = false;
-
-                    for(auto it = layer_props.begin(), end = layer_props.end(); it != end; ++it) {
-                        if(strcmp(required_layers[i], (*it).layerName) == 0) {
-                            found = true;
-
-                            layers.push(required_layers[i]);
-                            break;
-                        }
-                    }
-
-                    if(found) {
-                        console.debug("Found required layer " + s(required_layers[i]));
-                    } else {
-                        console.err("Required layer " + s(required_layers[i]) + " not found");
-                        abort();
-                    }
-                }
-
-                return layers;
+                return select_required_names(required_layers, required_layers_map, layer_props, "layer");
+#else
+                return layer_vector{};
+#endif // _DEBUG
             }
 
             Renderer::extension_vector Renderer::select_required_instance_extensions() {
-                extension_vector extensions; // Extensions that will be returned
-                uint32_t n_available_ext;
-                const char *required_ext[] = {
-                  VK_KHR_SURFACE_EXTENSION_NAME,
-                  OS_SPECIFIC_SURFACE_EXTENSION,
+                static constexpr required_name required_ext[] = {
+                  {VK_KHR_SURFACE_EXTENSION_NAME, 0},
+                  {OS_SPECIFIC_SURFACE_EXTENSION, 1},
 #ifdef _DEBUG
-                  VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
+                  {VK_EXT_DEBUG_UTILS_EXTENSION_NAME, 2},
 #endif // _DEBUG
                 };
-                const size_t required_ext_length = sizeof(required_ext) / sizeof(const char *);
+                static constexpr auto required_ext_map = collections::make_perfect_hash_map(required_ext);
+                uint32_t n_available_ext;
 
                 vkEnumerateInstanceExtensionProperties(nullptr, &n_available_ext, nullptr);
                 collections::Array<VkExtensionProperties> ext_props{n_available_ext};
                 vkEnumerateInstanceExtensionProperties(nullptr, &n_available_ext, ext_props);
 
-                for(size_t i = 0; i < required_ext_length; ++i) {
-                    bool found = false;
-
-                    for(auto it = ext_props.begin(), end = ext_props.end(); it != end; ++it) {
-                        if(strcmp(required_ext[i], (*it).extensionName) == 0) {
-                            found = true;
-
-                            extensions.push(required_ext[i]);
-                            break;
-                        }
-                    }
-
-                    if(found) {
-                        console.debug("Found required extension " + s(required_ext[i]));
-                    } else {
-                        console.err("Required extension " + s(required_ext[i]) + " not found");
-                        abort();
-                    }
-                }
-
-                return extensions;
+                return select_required_names(required_ext, required_ext_map, ext_props, "extension");
             }
 
             Renderer::extension_vector Renderer::select_required_device_extensions() {
-                extension_vector extensions; // Device extensions that will be returned
+                static constexpr required_name required_ext[] = {{VK_KHR_SWAPCHAIN_EXTENSION_NAME, 0}};
+                static constexpr auto required_ext_map = collections::make_perfect_hash_map(required_ext);
                 uint32_t n_available_ext;
-                const char *required_ext[] = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
-                const size_t required_ext_length = sizeof(required_ext) / sizeof(const char *);
 
                 vkEnumerateDeviceExtensionProperties(m_phy_device, nullptr, &n_available_ext, nullptr);
                 collections::Array<VkExtensionProperties> ext_props{n_available_ext};
                 vkEnumerateDeviceExtensionProperties(m_phy_device, nullptr, &n_available_ext, ext_props);
 
-                for(size_t i = 0; i < required_ext_length; ++i) {
-                    bool found = false;
-
-                    for(auto it = ext_props.begin(), end = ext_props.end(); it != end; ++it) {
-                        if(strcmp(required_ext[i], (*it).extensionName) == 0) {
-                            found = true;
-
-                            extensions.push(required_ext[i]);
-                            break;
-                        }
-                    }
-
-                    if(found) {
-                        console.debug("Found required device extension " + s(required_ext[i]));
-                    } else {
-                        console.err("Required device extension " + s(required_ext[i]) + " not found");
-                        abort();
-                    }
-                }
-
-                return extensions;
+                return select_required_names(required_ext, required_ext_map, ext_props, "device extension");
             }
 
             void Renderer::initialize_instance(GraphicsEngineInitializationParams const &params) {
@@ -387,7 +375,7 @@ namespace jolt {
 
                 m_queues = jltnew(queue_info_array, n_total_queues);
 
-                for(auto &q : *m_queues) { jltconstruct(&q.lock, 0); }
+                for(auto &q : *m_queues) { jltconstruct(&q.lock, 0, threading::LockSite{"Renderer::queue"}); }
 
                 for(auto &info : q_cinfo) {
                     for(uint32_t i = 0; i < info.queueCount; ++i) {
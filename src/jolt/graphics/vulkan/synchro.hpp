@@ -1,6 +1,8 @@
 #ifndef JLT_GRAPHICS_VULKAN_SYNCHRO_HPP
 #define JLT_GRAPHICS_VULKAN_SYNCHRO_HPP
 
+#include <coroutine>
+#include <jolt/threading/jobsystem.hpp>
 #include "defs.hpp"
 
 namespace jolt {
@@ -199,6 +201,94 @@ namespace jolt {
                 operator VkSemaphore() const { return m_semaphore; }
             };
 
+            /**
+             * Awaiter suspending the awaiting coroutine until a fence is signaled. The fence is
+             * polled by a job system, which resumes the coroutine on a worker.
+             */
+            class FenceAwaiter {
+                threading::JobSystem &m_system;     //< The job system.
+                Fence const &m_fence;               //< The fence.
+                std::coroutine_handle<> m_awaiting; //< The suspended coroutine.
+
+                static bool is_signaled(void *const awaiter_ptr) {
+                    return reinterpret_cast<FenceAwaiter *>(awaiter_ptr)->m_fence.is_signaled();
+                }
+
+                static void resume(void *const awaiter_ptr) {
+                    reinterpret_cast<FenceAwaiter *>(awaiter_ptr)->m_awaiting.resume();
+                }
+
+              public:
+                FenceAwaiter(threading::JobSystem &system, Fence const &fence) :
+                  m_system{system}, m_fence{fence}, m_awaiting{} {}
+
+                bool await_ready() const { return m_fence.is_signaled(); }
+
+                void await_suspend(std::coroutine_handle<> const awaiting) {
+                    m_awaiting = awaiting;
+                    m_system.run_when(&is_signaled, &resume, this);
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            /**
+             * Awaiter suspending the awaiting coroutine until a timeline semaphore reaches a value.
+             * The semaphore is polled by a job system, which resumes the coroutine on a worker.
+             */
+            class SemaphoreAwaiter {
+                threading::JobSystem &m_system;     //< The job system.
+                Semaphore const &m_semaphore;       //< The timeline semaphore.
+                uint64_t const m_value;             //< The value to wait for.
+                std::coroutine_handle<> m_awaiting; //< The suspended coroutine.
+
+                static bool is_reached(void *const awaiter_ptr) {
+                    auto const awaiter = reinterpret_cast<SemaphoreAwaiter *>(awaiter_ptr);
+
+                    return awaiter->m_semaphore.get_counter() >= awaiter->m_value;
+                }
+
+                static void resume(void *const awaiter_ptr) {
+                    reinterpret_cast<SemaphoreAwaiter *>(awaiter_ptr)->m_awaiting.resume();
+                }
+
+              public:
+                SemaphoreAwaiter(
+                  threading::JobSystem &system, Semaphore const &semaphore, uint64_t const value) :
+                  m_system{system}, m_semaphore{semaphore}, m_value{value}, m_awaiting{} {}
+
+                bool await_ready() const { return m_semaphore.get_counter() >= m_value; }
+
+                void await_suspend(std::coroutine_handle<> const awaiting) {
+                    m_awaiting = awaiting;
+                    m_system.run_when(&is_reached, &resume, this);
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            /**
+             * Suspend the awaiting coroutine until a fence is signaled.
+             *
+             * @param system The job system polling the fence.
+             * @param fence The fence.
+             */
+            inline FenceAwaiter wait_async(threading::JobSystem &system, Fence const &fence) {
+                return FenceAwaiter{system, fence};
+            }
+
+            /**
+             * Suspend the awaiting coroutine until a timeline semaphore reaches a value.
+             *
+             * @param system The job system polling the semaphore.
+             * @param semaphore The timeline semaphore.
+             * @param value The value to wait for.
+             */
+            inline SemaphoreAwaiter
+            wait_async(threading::JobSystem &system, Semaphore const &semaphore, uint64_t const value) {
+                return SemaphoreAwaiter{system, semaphore, value};
+            }
+
             struct WaitSemaphoreActionSynchro {
                 uint32_t wait_semaphore_count = 0; //< Number of elements pointed to by `wait_semaphores`.
                 VkSemaphore wait_semaphores[JLT_MAX_SEMAPHORES]; /*< Semaphores to wait before
@@ -47,7 +47,7 @@ namespace jolt::graphics::vulkan {
         }
 
         transfer_descriptors &transfer_descriptors = get_descriptors();
-        TransferDescriptor const descriptor = transfer_descriptors.pop();
+        TransferDescriptor const descriptor = transfer_descriptors.pop_front();
 
         switch(descriptor.resource_type) {
             case TransferResourceType::Buffer:
@@ -1,7 +1,7 @@
 #ifndef JLT_GRAPHICS_VULKAN_TRANSFER_HPP
 #define JLT_GRAPHICS_VULKAN_TRANSFER_HPP
 
-#include <jolt/collections/vector.hpp>
+#include <jolt/collections/deque.hpp>
 #include "defs.hpp"
 #include "transfer-descriptor.hpp"
 #include "cmd.hpp"
@@ -15,7 +15,7 @@ namespace jolt::graphics::vulkan {
         friend class TransferFactory;
 
       public:
-        using transfer_descriptors = collections::Vector<TransferDescriptor>;
+        using transfer_descriptors = collections::Deque<TransferDescriptor>;
 
       private:
         Renderer &m_renderer;
@@ -27,7 +27,7 @@ namespace jolt::graphics::vulkan {
         Fence m_fence;
         CommandBuffer m_cmd_buffer;
 
-        void add_resource(TransferDescriptor const &descriptor) { m_descriptors.push(descriptor); }
+        void add_resource(TransferDescriptor const &descriptor) { m_descriptors.push_back(descriptor); }
 
         void create_staging_buffer();
 
@@ -73,7 +73,7 @@ namespace jolt::graphics::vulkan {
 
         cmd_buffer.submit(get_queue(), synchro);
 
-        m_uploaded_image_descriptors.push(descriptor);
+        m_uploaded_image_descriptors.push_back(descriptor);
         fence.wait(SYNCHRO_WAIT_MAX);
     }
 
@@ -0,0 +1,74 @@
+#ifndef JLT_IO_ASYNC_HPP
+#define JLT_IO_ASYNC_HPP
+
+#include <coroutine>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include <jolt/threading/jobsystem.hpp>
+#include "stream.hpp"
+
+namespace jolt {
+    namespace io {
+        /**
+         * Awaiter reading from a stream on a worker of a job system. The awaiting coroutine is
+         * suspended during the read and resumed on the worker once it's complete.
+         *
+         * @remarks The read itself is a blocking `Stream::read()` call: it's only moved off the awaiting
+         * coroutine's thread, and the worker performing it can't run any other job until it returns.
+         */
+        class StreamReadAwaiter {
+            threading::JobSystem &m_system;     //< The job system.
+            Stream &m_stream;                   //< The stream to read from.
+            uint8_t *const m_buf;               //< The output buffer.
+            size_t const m_buf_sz;              //< Size of the output buffer, in bytes.
+            size_t m_read_sz;                   //< Number of bytes read.
+            std::coroutine_handle<> m_awaiting; //< The suspended coroutine.
+
+            static void read(void *const awaiter_ptr) {
+                auto const awaiter = reinterpret_cast<StreamReadAwaiter *>(awaiter_ptr);
+
+                awaiter->m_read_sz = awaiter->m_stream.read(awaiter->m_buf, awaiter->m_buf_sz);
+                awaiter->m_awaiting.resume();
+            }
+
+          public:
+            JLT_NODISCARD StreamReadAwaiter(
+              threading::JobSystem &system, Stream &stream, uint8_t *const buf, size_t const buf_sz) :
+              m_system{system},
+              m_stream{stream}, m_buf{buf}, m_buf_sz{buf_sz}, m_read_sz{0}, m_awaiting{} {}
+
+            JLT_NODISCARD bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> const awaiting) {
+                m_awaiting = awaiting;
+                m_system.run(&read, this);
+            }
+
+            /**
+             * Return the number of bytes read.
+             */
+            JLT_NODISCARD size_t await_resume() const noexcept { return m_read_sz; }
+        };
+
+        /**
+         * Read from a stream without blocking the awaiting coroutine's thread.
+         *
+         * @remarks This isn't asynchronous I/O: the blocking read runs as a job and occupies a worker
+         * for its whole duration. Only use it for small reads, as each pending read takes a worker
+         * away from the job system and enough of them stall every other job.
+         *
+         * @param system The job system whose workers perform the read.
+         * @param stream The stream to read from.
+         * @param buf The output buffer.
+         * @param buf_sz The size of the output buffer, in bytes.
+         *
+         * @return An awaiter whose result is the number of bytes read.
+         */
+        JLT_NODISCARD inline StreamReadAwaiter
+        read_async(threading::JobSystem &system, Stream &stream, uint8_t *const buf, size_t const buf_sz) {
+            return StreamReadAwaiter{system, stream, buf, buf_sz};
+        }
+    } // namespace io
+} // namespace jolt
+
+#endif /* JLT_IO_ASYNC_HPP */
@@ -22,7 +22,8 @@ namespace jolt {
 
         AllocatorSlot::AllocatorSlot() :
           m_sm_alloc{SMALL_HEAP_MEMORY_SIZE}, m_bg_alloc{BIG_HEAP_MEMORY_SIZE},
-          m_persist{PERSISTENT_MEMORY_SIZE}, m_scratch{SCRATCH_MEMORY_SIZE} {}
+          m_persist{PERSISTENT_MEMORY_SIZE}, m_scratch{SCRATCH_MEMORY_SIZE},
+          m_lock{LockSite{"AllocatorSlot::m_lock"}} {}
 
         void *_allocate(const size_t size, flags_t const flags, size_t const alignment) {
             AllocatorSlot &slot = get_allocator_slot();
@@ -122,8 +123,7 @@ namespace jolt {
             return sz;
         }
 
-        void *_reallocate(void *const ptr, size_t const new_size) {
-            AllocatorSlot &slot = get_slot_for_allocation(ptr);
+        static void *reallocate_in_slot(AllocatorSlot &slot, void *const ptr, size_t const new_size) {
             AllocHeader *const hdr_ptr = get_alloc_header(ptr);
 
             if((hdr_ptr->m_flags & ALLOC_SCRATCH) == ALLOC_SCRATCH) {
@@ -141,8 +141,7 @@ namespace jolt {
             return slot.m_sm_alloc.reallocate(ptr, new_size);
         }
 
-        bool will_relocate(void *const ptr, size_t const new_size) {
-            AllocatorSlot &slot = get_allocator_slot();
+        static bool will_relocate_in_slot(AllocatorSlot &slot, void *const ptr, size_t const new_size) {
             AllocHeader *const hdr_ptr = get_alloc_header(ptr);
 
             if((hdr_ptr->m_flags & ALLOC_SCRATCH) == ALLOC_SCRATCH) {
@@ -160,6 +159,31 @@ namespace jolt {
             return slot.m_sm_alloc.will_relocate(ptr, new_size);
         }
 
+        void *_reallocate(void *const ptr, size_t const new_size) {
+            AllocatorSlot &slot = get_slot_for_allocation(ptr);
+            LockGuard lock{slot.m_lock};
+
+            return reallocate_in_slot(slot, ptr, new_size);
+        }
+
+        void *_reallocate_in_place(void *const ptr, size_t const new_size) {
+            AllocatorSlot &slot = get_slot_for_allocation(ptr);
+            LockGuard lock{slot.m_lock};
+
+            if(will_relocate_in_slot(slot, ptr, new_size)) {
+                return nullptr;
+            }
+
+            return reallocate_in_slot(slot, ptr, new_size);
+        }
+
+        bool will_relocate(void *const ptr, size_t const new_size) {
+            AllocatorSlot &slot = get_slot_for_allocation(ptr);
+            LockGuard lock{slot.m_lock};
+
+            return will_relocate_in_slot(slot, ptr, new_size);
+        }
+
         void force_flags(flags_t const flags) { flags_override = flags; }
 
         void push_force_flags(flags_t const flags) {
@@ -284,6 +284,14 @@ namespace jolt {
 
         JLT_NODISCARD void JLTAPI *_reallocate(void *const ptr, size_t const new_size);
 
+        /**
+         * Reallocate a memory region only if it can be done without moving it.
+         *
+         * @return The memory region or null if it would have to be moved, in which case it's left
+         * untouched.
+         */
+        JLT_NODISCARD void JLTAPI *_reallocate_in_place(void *const ptr, size_t const new_size);
+
         /**
          * Reallocate a previously allocated memory region, shrinking or growing its size.
          *
@@ -303,13 +311,15 @@ namespace jolt {
         template<typename T>
         JLT_NODISCARD T *reallocate(T *const ptr, size_t const new_length, long long const move_n = -1) {
             auto const old_len_ptr = reinterpret_cast<size_t *>(ptr) - 1;
-            AllocatorSlot &slot = get_allocator_slot();
             AllocHeader &hdr = *get_alloc_header(old_len_ptr); // store old length
-            threading::LockGuard lock{slot.m_lock};
             size_t const new_size = new_length * sizeof(T) + sizeof(size_t);
+            size_t *new_len_ptr;
 
+            // The slot lock is taken by each call, as it's not recursive
             if constexpr(!std::is_trivial<T>::value) {
-                if(will_relocate(old_len_ptr, new_size)) {
+                new_len_ptr = reinterpret_cast<size_t *>(_reallocate_in_place(old_len_ptr, new_size));
+
+                if(!new_len_ptr) {
                     size_t const old_length = move_n >= 0 ? move_n : *old_len_ptr;
                     T *const data_new = allocate_array<T>(new_length, hdr.m_flags, hdr.m_alignment);
 
@@ -321,9 +331,13 @@ namespace jolt {
 
                     return data_new;
                 }
+            } else {
+                new_len_ptr = reinterpret_cast<size_t *>(_reallocate(old_len_ptr, new_size));
             }
 
-            return reinterpret_cast<T *>(_reallocate(old_len_ptr, new_size));
+            *new_len_ptr = new_length;
+
+            return reinterpret_cast<T *>(new_len_ptr + 1);
         }
     } // namespace memory
 } // namespace jolt
@@ -143,12 +143,12 @@ namespace jolt {
             auto const committed_mem_end_ptr = reinterpret_cast<uint8_t *>(get_base()) + get_committed_size();
             bool const absorb_entire_node = total_alloc_sz == free_slot->m_size;
 
-            if(alloc_end_ptr > committed_mem_end_ptr) {
-                size_t const base_extend_size = alloc_end_ptr - committed_mem_end_ptr;
-                size_t const total_extend_size =
-                  choose(base_extend_size + sizeof(ArenaFreeListNode), base_extend_size, !absorb_entire_node);
+            // The free list node following a split allocation must be committed too
+            auto const used_end_ptr =
+              alloc_end_ptr + choose(static_cast<size_t>(0), sizeof(ArenaFreeListNode), absorb_entire_node);
 
-                commit(total_extend_size);
+            if(used_end_ptr > committed_mem_end_ptr) {
+                commit(used_end_ptr - committed_mem_end_ptr);
             }
 
             ArenaFreeListNode *cur_slot;
@@ -171,8 +171,10 @@ namespace jolt {
             // actually *moving* `free_slot` to a different address.
             m_free_list = choose(m_free_list, cur_slot, m_free_list != free_slot);
 
+            // Any slack absorbed from the free slot is recorded as part of the allocation, so that
+            // `free()` gives it back.
             new(hdr_ptr) AllocHeader(
-              base_alloc_sz_no_padding - sizeof(AllocHeader) - JLT_MEM_OVERFLOW_CANARY_VALUE_SIZE,
+              total_alloc_sz - padding - sizeof(AllocHeader) - JLT_MEM_OVERFLOW_CANARY_VALUE_SIZE,
               flags,
               padding,
               alignment);
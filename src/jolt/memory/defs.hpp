@@ -8,6 +8,8 @@ namespace jolt {
     namespace memory {
         using flags_t = uint32_t; // The allocation flags type.
 
+        constexpr size_t CACHE_LINE_SIZE = 64; // Size of a CPU cache line.
+
         /**
          * The allocation flags values.
          */
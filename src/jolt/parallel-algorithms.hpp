@@ -0,0 +1,419 @@
+#ifndef JLT_PARALLEL_ALGORITHMS_HPP
+#define JLT_PARALLEL_ALGORITHMS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <emmintrin.h>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/array.hpp>
+#include <jolt/threading/threadpool.hpp>
+#include "algorithms.hpp"
+
+namespace jolt::algorithms {
+    constexpr size_t PARALLEL_DEFAULT_GRAIN = 2048;         //< Default minimum number of items per chunk.
+    constexpr size_t PARALLEL_CHUNKS_PER_THREAD = 4;        //< Chunks per thread, for load balancing.
+    constexpr size_t PARALLEL_SORT_THRESHOLD = 64 * 1024;   //< Arrays shorter than this are sorted serially.
+    constexpr size_t PARALLEL_SORT_MAX_BUCKETS = 256;       //< Maximum number of sample sort buckets.
+    constexpr size_t PARALLEL_SORT_OVERSAMPLING = 32;       //< Samples taken per sample sort bucket.
+
+    namespace detail {
+        /**
+         * State shared by all the tasks of a parallel loop. Chunks are claimed dynamically, so that
+         * threads that finish early keep pulling work.
+         */
+        template<typename F>
+        struct ParallelForState {
+            F *m_func;                      //< Chunk function, called as `func(chunk_index, begin, end)`.
+            size_t m_len;                   //< Number of items.
+            size_t m_chunk_size;            //< Number of items per chunk.
+            size_t m_n_chunks;              //< Number of chunks.
+            std::atomic<size_t> m_next;     //< Next chunk to claim.
+            std::atomic<size_t> m_pending;  //< Tasks still running.
+        };
+
+        template<typename F>
+        void run_chunks(ParallelForState<F> &state) {
+            for(size_t chunk = state.m_next.fetch_add(1, std::memory_order_relaxed); chunk < state.m_n_chunks;
+                chunk = state.m_next.fetch_add(1, std::memory_order_relaxed)) {
+                size_t const begin = chunk * state.m_chunk_size;
+                size_t const end = min(begin + state.m_chunk_size, state.m_len);
+
+                (*state.m_func)(chunk, begin, end);
+            }
+        }
+
+        template<typename F>
+        void parallel_for_task(void *param) {
+            auto &state = *reinterpret_cast<ParallelForState<F> *>(param);
+
+            run_chunks(state);
+
+            // Last access to `state`: the submitting thread may return as soon as this is zero
+            state.m_pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        /**
+         * Split [0, len) into chunks of at least `grain` items and call `func(chunk_index, begin, end)`
+         * on each of them, in parallel.
+         *
+         * @return The number of chunks.
+         */
+        template<typename F>
+        size_t parallel_for_chunks(
+          threading::ThreadPool &pool,
+          size_t const len,
+          size_t const grain,
+          size_t const n_chunks_hint,
+          F &func) {
+            size_t const n_threads = pool.get_thread_count() + 1;
+            size_t const target_chunks =
+              n_chunks_hint ? n_chunks_hint : n_threads * PARALLEL_CHUNKS_PER_THREAD;
+            size_t const chunk_size =
+              max(max(grain, static_cast<size_t>(1)), (len + target_chunks - 1) / target_chunks);
+            size_t const n_chunks = (len + chunk_size - 1) / chunk_size;
+
+            if(n_chunks <= 1 || n_threads == 1) {
+                for(size_t chunk = 0; chunk < n_chunks; ++chunk) {
+                    size_t const begin = chunk * chunk_size;
+
+                    func(chunk, begin, min(begin + chunk_size, len));
+                }
+
+                return n_chunks;
+            }
+
+            size_t const n_tasks = min(n_threads - 1, n_chunks - 1);
+            ParallelForState<F> state{&func, len, chunk_size, n_chunks, {0}, {n_tasks}};
+
+            for(size_t i = 0; i < n_tasks; ++i) { pool.submit(&parallel_for_task<F>, &state); }
+
+            run_chunks(state);
+
+            // Help with other pending work while the stragglers finish
+            while(state.m_pending.load(std::memory_order_acquire)) {
+                if(!pool.run_pending_task()) {
+                    _mm_pause();
+                }
+            }
+
+            return n_chunks;
+        }
+    } // namespace detail
+
+    /**
+     * Call a function on the sub-ranges of [0, `len`), in parallel.
+     *
+     * @param len The number of items.
+     * @param func A function accepting the beginning and end indices of a sub-range.
+     * @param grain The minimum number of items per sub-range.
+     * @param pool The thread pool to run on.
+     */
+    template<typename F>
+    void parallel_for(
+      size_t const len,
+      F &&func,
+      size_t const grain = PARALLEL_DEFAULT_GRAIN,
+      threading::ThreadPool &pool = threading::get_default_thread_pool()) {
+        auto chunk_func = [&func](size_t, size_t const begin, size_t const end) { func(begin, end); };
+
+        detail::parallel_for_chunks(pool, len, grain, 0, chunk_func);
+    }
+
+    /**
+     * Call a function on each item of an array, in parallel.
+     *
+     * @param ptr Pointer to the array.
+     * @param len Length of the array.
+     * @param func A function accepting a reference to an item.
+     * @param grain The minimum number of items per task.
+     * @param pool The thread pool to run on.
+     */
+    template<typename T, typename F>
+    void parallel_for_each(
+      T *const ptr,
+      size_t const len,
+      F &&func,
+      size_t const grain = PARALLEL_DEFAULT_GRAIN,
+      threading::ThreadPool &pool = threading::get_default_thread_pool()) {
+        parallel_for(
+          len,
+          [ptr, &func](size_t const begin, size_t const end) {
+              for(size_t i = begin; i < end; ++i) { func(ptr[i]); }
+          },
+          grain,
+          pool);
+    }
+
+    /**
+     * Store the result of a function called on each item of an array into another array, in
+     * parallel.
+     *
+     * @param in Pointer to the input array.
+     * @param len Length of the input array.
+     * @param out Pointer to the output array, with room for at least `len` items. May be equal to `in`.
+     * @param func A function accepting a reference to an input item and returning an output item.
+     * @param grain The minimum number of items per task.
+     * @param pool The thread pool to run on.
+     */
+    template<typename T, typename U, typename F>
+    void parallel_transform(
+      T *const in,
+      size_t const len,
+      U *const out,
+      F &&func,
+      size_t const grain = PARALLEL_DEFAULT_GRAIN,
+      threading::ThreadPool &pool = threading::get_default_thread_pool()) {
+        parallel_for(
+          len,
+          [in, out, &func](size_t const begin, size_t const end) {
+              for(size_t i = begin; i < end; ++i) { out[i] = func(in[i]); }
+          },
+          grain,
+          pool);
+    }
+
+    /**
+     * Reduce an array to a single value, in parallel.
+     *
+     * Each task folds its own chunk, and the per-chunk results are combined in chunk order on the
+     * calling thread. `combine` must be associative, but need not be commutative.
+     *
+     * @param ptr Pointer to the array.
+     * @param len Length of the array.
+     * @param identity The identity value for `combine`.
+     * @param map A function accepting a reference to an item and returning a value of type `R`.
+     * @param combine A function accepting two values of type `R` and returning their combination.
+     * @param grain The minimum number of items per task.
+     * @param pool The thread pool to run on.
+     *
+     * @return The reduced value, or `identity` if the array is empty.
+     */
+    template<typename T, typename R, typename M, typename C>
+    JLT_NODISCARD R parallel_reduce(
+      T *const ptr,
+      size_t const len,
+      R const &identity,
+      M &&map,
+      C &&combine,
+      size_t const grain = PARALLEL_DEFAULT_GRAIN,
+      threading::ThreadPool &pool = threading::get_default_thread_pool()) {
+        size_t const n_chunks_max = (pool.get_thread_count() + 1) * PARALLEL_CHUNKS_PER_THREAD;
+        R *const partials = memory::allocate_array<R>(n_chunks_max);
+
+        for(size_t i = 0; i < n_chunks_max; ++i) { memory::construct(partials + i, identity); }
+
+        auto chunk_func = [&](size_t const chunk, size_t const begin, size_t const end) {
+            R acc = identity;
+
+            for(size_t i = begin; i < end; ++i) { acc = combine(acc, map(ptr[i])); }
+
+            partials[chunk] = std::move(acc);
+        };
+
+        size_t const n_chunks = detail::parallel_for_chunks(pool, len, grain, n_chunks_max, chunk_func);
+        R result = identity;
+
+        for(size_t i = 0; i < n_chunks; ++i) { result = combine(result, partials[i]); }
+
+        memory::free_array(partials);
+
+        return result;
+    }
+
+    /**
+     * Sort elements in an array in place, in parallel.
+     *
+     * This is a sample sort: splitters are picked from a sorted sample of the keys, every thread
+     * distributes a block of items into the buckets delimited by the splitters, and the buckets are
+     * then sorted with `sort()` independently. Every phase runs in parallel. Arrays shorter than
+     * `PARALLEL_SORT_THRESHOLD` are sorted serially.
+     *
+     * The sort is not stable.
+     *
+     * @param ptr Pointer to the array to sort.
+     * @param len Length of the array to sort.
+     * @param key A function accepting a reference to an item and returning a comparable key, as for `sort()`.
+     * Keys must be copyable.
+     * @param pool The thread pool to run on.
+     *
+     * @remarks This function allocates a scratch buffer of `len` items.
+     */
+    template<typename T>
+    void parallel_sort(
+      T *const ptr,
+      size_t const len,
+      auto key,
+      threading::ThreadPool &pool = threading::get_default_thread_pool()) {
+        using key_type = typename std::remove_cvref<decltype(key(*ptr))>::type;
+
+        size_t const n_threads = pool.get_thread_count() + 1;
+
+        if(len < PARALLEL_SORT_THRESHOLD || n_threads == 1) {
+            sort(ptr, len, key);
+            return;
+        }
+
+        // Pick the splitters from a sorted sample, evenly spaced across the input
+        size_t const n_buckets = min(PARALLEL_SORT_MAX_BUCKETS, n_threads * PARALLEL_CHUNKS_PER_THREAD);
+        size_t const n_samples = n_buckets * PARALLEL_SORT_OVERSAMPLING;
+        key_type *const samples = memory::allocate_array<key_type>(n_samples);
+        key_type *const splitters = memory::allocate_array<key_type>(n_buckets - 1);
+
+        for(size_t i = 0; i < n_samples; ++i) {
+            memory::construct(samples + i, key(ptr[i * (len / n_samples) + (i * 7919) % (len / n_samples)]));
+        }
+
+        sort(samples, n_samples, [](key_type const &k) -> key_type const & { return k; });
+
+        for(size_t i = 1; i < n_buckets; ++i) {
+            memory::construct(splitters + i - 1, samples[i * PARALLEL_SORT_OVERSAMPLING]);
+        }
+
+        memory::free_array(samples);
+
+        // Classify: record each item's bucket and count the items per block and bucket
+        size_t const n_blocks = n_threads * PARALLEL_CHUNKS_PER_THREAD;
+        size_t const block_size = (len + n_blocks - 1) / n_blocks;
+        uint8_t *const bucket_of = memory::allocate_array<uint8_t>(len);
+        size_t *const offsets = memory::allocate_array<size_t>(n_blocks * n_buckets);
+        size_t *const bucket_begin = memory::allocate_array<size_t>(n_buckets + 1);
+
+        memset(offsets, 0, n_blocks * n_buckets * sizeof(size_t));
+
+        auto classify = [&](size_t const block, size_t const begin, size_t const end) {
+            size_t *const counts = offsets + block * n_buckets;
+
+            for(size_t i = begin; i < end; ++i) {
+                auto const &k = key(ptr[i]);
+                size_t lo = 0, count = n_buckets - 1;
+
+                // Upper bound among the splitters
+                while(count) {
+                    size_t const half = count / 2;
+                    bool const go_right = !(k < splitters[lo + half]);
+
+                    lo = choose(lo + half + 1, lo, go_right);
+                    count = choose(count - half - 1, half, go_right);
+                }
+
+                bucket_of[i] = static_cast<uint8_t>(lo);
+                ++counts[lo];
+            }
+        };
+
+        detail::parallel_for_chunks(pool, len, block_size, n_blocks, classify);
+
+        // Turn the counts into scatter offsets, bucket-major so that each bucket is contiguous
+        size_t total = 0;
+
+        for(size_t b = 0; b < n_buckets; ++b) {
+            bucket_begin[b] = total;
+
+            for(size_t block = 0; block < n_blocks; ++block) {
+                size_t &slot = offsets[block * n_buckets + b];
+                size_t const count = slot;
+
+                slot = total;
+                total += count;
+            }
+        }
+
+        bucket_begin[n_buckets] = total;
+
+        // Scatter into the scratch buffer
+        T *const scratch = memory::allocate_array<T>(len);
+
+        auto scatter = [&](size_t const block, size_t const begin, size_t const end) {
+            size_t *const block_offsets = offsets + block * n_buckets;
+
+            for(size_t i = begin; i < end; ++i) {
+                memory::construct(scratch + block_offsets[bucket_of[i]]++, std::move(ptr[i]));
+            }
+        };
+
+        detail::parallel_for_chunks(pool, len, block_size, n_blocks, scatter);
+
+        // Sort each bucket and move it back
+        auto sort_bucket = [&](size_t, size_t const begin, size_t const end) {
+            for(size_t b = begin; b < end; ++b) {
+                size_t const b_begin = bucket_begin[b];
+                size_t const b_len = bucket_begin[b + 1] - b_begin;
+
+                sort(scratch + b_begin, b_len, key);
+
+                for(size_t i = b_begin; i < b_begin + b_len; ++i) {
+                    ptr[i] = std::move(scratch[i]);
+
+                    if constexpr(!std::is_trivially_destructible<T>::value) {
+                        scratch[i].~T();
+                    }
+                }
+            }
+        };
+
+        detail::parallel_for_chunks(pool, n_buckets, 1, n_buckets, sort_bucket);
+
+        memory::free_array(scratch, 0);
+        memory::free_array(bucket_begin);
+        memory::free_array(offsets);
+        memory::free_array(bucket_of);
+        memory::free_array(splitters);
+    }
+
+    template<typename T, typename F>
+    void parallel_for_each(collections::Vector<T> &v, F &&func) {
+        if(v.get_length()) {
+            parallel_for_each(&v[0], v.get_length(), std::forward<F>(func));
+        }
+    }
+
+    template<typename T, typename F>
+    void parallel_for_each(collections::Array<T> &arr, F &&func) {
+        parallel_for_each(static_cast<T *>(arr), arr.get_length(), std::forward<F>(func));
+    }
+
+    template<typename T, typename U, typename F>
+    void parallel_transform(collections::Vector<T> &in, collections::Vector<U> &out, F &&func) {
+        jltassert(out.get_length() >= in.get_length());
+
+        if(in.get_length()) {
+            parallel_transform(&in[0], in.get_length(), &out[0], std::forward<F>(func));
+        }
+    }
+
+    template<typename T, typename U, typename F>
+    void parallel_transform(collections::Array<T> &in, collections::Array<U> &out, F &&func) {
+        jltassert(out.get_length() >= in.get_length());
+
+        parallel_transform(
+          static_cast<T *>(in), in.get_length(), static_cast<U *>(out), std::forward<F>(func));
+    }
+
+    template<typename T, typename R, typename M, typename C>
+    JLT_NODISCARD R parallel_reduce(collections::Vector<T> &v, R const &identity, M &&map, C &&combine) {
+        return v.get_length() ? parallel_reduce(&v[0], v.get_length(), identity, map, combine) : identity;
+    }
+
+    template<typename T, typename R, typename M, typename C>
+    JLT_NODISCARD R parallel_reduce(collections::Array<T> &arr, R const &identity, M &&map, C &&combine) {
+        return parallel_reduce(static_cast<T *>(arr), arr.get_length(), identity, map, combine);
+    }
+
+    template<typename T>
+    void parallel_sort(collections::Vector<T> &v, auto key) {
+        if(v.get_length()) {
+            parallel_sort(&v[0], v.get_length(), key);
+        }
+    }
+
+    template<typename T>
+    void parallel_sort(collections::Array<T> &arr, auto key) {
+        parallel_sort(static_cast<T *>(arr), arr.get_length(), key);
+    }
+} // namespace jolt::algorithms
+
+#endif /* JLT_PARALLEL_ALGORITHMS_HPP */
@@ -89,6 +89,18 @@ namespace jolt {
             return true;
         }
 
+        bool UTF8String::operator<(const UTF8String &other) const {
+            size_t const common_size = min(m_str_size, other.m_str_size);
+
+            for(size_t i = 0; i < common_size; ++i) {
+                if(m_str[i] != other.m_str[i]) {
+                    return static_cast<uint8_t>(m_str[i]) < static_cast<uint8_t>(other.m_str[i]);
+                }
+            }
+
+            return m_str_size < other.m_str_size;
+        }
+
         UTF8String UTF8String::operator+(const UTF8String &other) const {
             size_t const total_size = m_str_size + other.m_str_size;
             utf8c *const new_str = allocate_array<utf8c>(total_size + 1);
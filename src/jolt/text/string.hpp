@@ -256,6 +256,12 @@ namespace jolt {
              */
             bool operator==(const UTF8String &other) const;
 
+            /**
+             * Check whether this string is ordered before another one. Strings are ordered by their
+             * raw bytes, which for UTF-8 is the same as ordering by code point.
+             */
+            bool operator<(const UTF8String &other) const;
+
             /**
              * Concatenate two strings.
              */
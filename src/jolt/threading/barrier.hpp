@@ -0,0 +1,63 @@
+#ifndef JLT_THREADING_BARRIER_HPP
+#define JLT_THREADING_BARRIER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include "wait.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A reusable barrier for a fixed number of threads: each thread waits until all of them have
+         * arrived, then all of them proceed to the next phase.
+         *
+         * Waiting threads spin briefly, then sleep on the address of the phase number.
+         */
+        class Barrier {
+            std::atomic<uint32_t> m_phase;     //< Current phase number.
+            std::atomic<uint32_t> m_n_waiting; //< Threads left to arrive in the current phase.
+            uint32_t const m_n_threads;        //< Number of threads synchronizing on the barrier.
+
+          public:
+            /**
+             * Create a new instance of this class.
+             *
+             * @param n_threads The number of threads synchronizing on the barrier.
+             */
+            JLT_NODISCARD explicit Barrier(uint32_t const n_threads) noexcept :
+              m_phase{0}, m_n_waiting{n_threads}, m_n_threads{n_threads} {
+                jltassert(n_threads > 0);
+            }
+
+            Barrier(Barrier const &) = delete;
+            Barrier &operator=(Barrier const &) = delete;
+
+            /**
+             * Wait until all the threads have arrived at the barrier.
+             *
+             * @return True for exactly one of the threads of each phase, the last one to arrive, false
+             * for the others.
+             */
+            bool arrive_and_wait() noexcept {
+                uint32_t const phase = m_phase.load(std::memory_order_acquire);
+
+                if(m_n_waiting.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    // Threads can't arrive for the next phase before it begins
+                    m_n_waiting.store(m_n_threads, std::memory_order_relaxed);
+                    m_phase.store(phase + 1, std::memory_order_release);
+                    m_phase.notify_all();
+
+                    return true;
+                }
+
+                detail::wait_while_equal(m_phase, phase);
+
+                return false;
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_BARRIER_HPP */
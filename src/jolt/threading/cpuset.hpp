@@ -0,0 +1,165 @@
+#ifndef JLT_THREADING_CPUSET_HPP
+#define JLT_THREADING_CPUSET_HPP
+
+#include <bit>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A set of logical processors, identified by their index.
+         *
+         * Unlike a 64-bit affinity mask, a set can describe machines with up to `MAX_CPUS` logical
+         * processors. On Windows, the index of a processor is its group number times `GROUP_SIZE` plus
+         * its number within the group.
+         */
+        class CpuSet {
+          public:
+            static constexpr unsigned MAX_CPUS = 1024;        //< Maximum number of logical processors.
+            static constexpr unsigned INVALID_CPU = MAX_CPUS; //< Invalid processor index.
+            static constexpr unsigned GROUP_SIZE = 64;        //< Number of processors per affinity mask.
+
+          private:
+            using word_type = uint64_t;
+
+            static constexpr unsigned WORD_BITS = GROUP_SIZE;
+            static constexpr unsigned N_WORDS = MAX_CPUS / WORD_BITS;
+
+            word_type m_words[N_WORDS]; //< One bit per processor.
+
+          public:
+            JLT_NODISCARD constexpr CpuSet() : m_words{} {}
+
+            /**
+             * Create a new set from an affinity mask.
+             *
+             * @param mask The affinity mask.
+             * @param group The index of the group of `GROUP_SIZE` processors the mask refers to.
+             */
+            JLT_NODISCARD static constexpr CpuSet from_mask(uint64_t const mask, unsigned const group = 0) {
+                jltassert(group < N_WORDS);
+
+                CpuSet set;
+
+                set.m_words[group] = mask;
+
+                return set;
+            }
+
+            /**
+             * Return the affinity mask of the processors in the set within a group.
+             *
+             * @param group The index of the group of `GROUP_SIZE` processors.
+             */
+            JLT_NODISCARD constexpr uint64_t to_mask(unsigned const group = 0) const {
+                jltassert(group < N_WORDS);
+
+                return m_words[group];
+            }
+
+            constexpr void add(unsigned const cpu) {
+                jltassert(cpu < MAX_CPUS);
+
+                m_words[cpu / WORD_BITS] |= static_cast<word_type>(1) << (cpu % WORD_BITS);
+            }
+
+            constexpr void remove(unsigned const cpu) {
+                jltassert(cpu < MAX_CPUS);
+
+                m_words[cpu / WORD_BITS] &= ~(static_cast<word_type>(1) << (cpu % WORD_BITS));
+            }
+
+            JLT_NODISCARD constexpr bool contains(unsigned const cpu) const {
+                return cpu < MAX_CPUS && (m_words[cpu / WORD_BITS] >> (cpu % WORD_BITS)) & 1;
+            }
+
+            /**
+             * Return the number of processors in the set.
+             */
+            JLT_NODISCARD constexpr unsigned get_count() const {
+                unsigned count = 0;
+
+                for(word_type const word : m_words) { count += std::popcount(word); }
+
+                return count;
+            }
+
+            JLT_NODISCARD constexpr bool is_empty() const { return get_first() == INVALID_CPU; }
+
+            /**
+             * Return the lowest processor index in the set, or `INVALID_CPU` if the set is empty.
+             */
+            JLT_NODISCARD constexpr unsigned get_first() const { return get_next(0); }
+
+            /**
+             * Return the lowest processor index in the set greater than or equal to `cpu`, or
+             * `INVALID_CPU` if there's none.
+             */
+            JLT_NODISCARD constexpr unsigned get_next(unsigned const cpu) const {
+                for(unsigned i = cpu / WORD_BITS; i < N_WORDS; ++i) {
+                    word_type word = m_words[i];
+
+                    if(i == cpu / WORD_BITS) {
+                        word &= ~static_cast<word_type>(0) << (cpu % WORD_BITS);
+                    }
+
+                    if(word) {
+                        return i * WORD_BITS + std::countr_zero(word);
+                    }
+                }
+
+                return INVALID_CPU;
+            }
+
+            /**
+             * Return a value stating whether this set and another one have processors in common.
+             */
+            JLT_NODISCARD constexpr bool intersects(CpuSet const &other) const {
+                for(unsigned i = 0; i < N_WORDS; ++i) {
+                    if(m_words[i] & other.m_words[i]) {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            constexpr CpuSet &operator|=(CpuSet const &other) {
+                for(unsigned i = 0; i < N_WORDS; ++i) { m_words[i] |= other.m_words[i]; }
+
+                return *this;
+            }
+
+            constexpr CpuSet &operator&=(CpuSet const &other) {
+                for(unsigned i = 0; i < N_WORDS; ++i) { m_words[i] &= other.m_words[i]; }
+
+                return *this;
+            }
+
+            /**
+             * Remove the processors of another set from this one.
+             */
+            constexpr CpuSet &operator-=(CpuSet const &other) {
+                for(unsigned i = 0; i < N_WORDS; ++i) { m_words[i] &= ~other.m_words[i]; }
+
+                return *this;
+            }
+
+            JLT_NODISCARD constexpr bool operator==(CpuSet const &other) const {
+                for(unsigned i = 0; i < N_WORDS; ++i) {
+                    if(m_words[i] != other.m_words[i]) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            JLT_NODISCARD constexpr bool operator!=(CpuSet const &other) const { return !(*this == other); }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_CPUSET_HPP */
@@ -0,0 +1,110 @@
+#ifndef JLT_THREADING_EVENT_HPP
+#define JLT_THREADING_EVENT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include "wait.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * An event threads can wait for until another thread sets it.
+         *
+         * A manual-reset event releases all the waiting threads and stays set until it's reset. An
+         * auto-reset event releases a single waiting thread and is reset as the thread is released;
+         * setting an event that is already set has no effect.
+         *
+         * Waiting threads spin briefly, then sleep on the address of the event state. Setting an
+         * event nobody sleeps on doesn't enter the kernel.
+         */
+        class Event {
+            static constexpr uint32_t UNSET = 0; //< The event is not set.
+            static constexpr uint32_t SET = 1;   //< The event is set.
+
+            std::atomic<uint32_t> m_state;     //< Event state.
+            std::atomic<uint32_t> m_n_waiters; //< Number of threads sleeping or about to sleep.
+            bool const m_auto_reset;           //< True if the event is reset as a waiter is released.
+
+          public:
+            /**
+             * Create a new instance of this class.
+             *
+             * @param auto_reset True for an auto-reset event, false for a manual-reset event.
+             * @param set True if the event is initially set.
+             */
+            JLT_NODISCARD explicit Event(bool const auto_reset = false, bool const set = false) noexcept :
+              m_state{set ? SET : UNSET}, m_n_waiters{0}, m_auto_reset{auto_reset} {}
+
+            Event(Event const &) = delete;
+            Event &operator=(Event const &) = delete;
+
+            /**
+             * Set the event and release the waiting threads, or a single one for an auto-reset event.
+             */
+            void set() noexcept {
+                m_state.store(SET, std::memory_order_seq_cst);
+
+                // Pairs with `wait()`: either the waiter sees the event set or this thread sees it
+                if(m_n_waiters.load(std::memory_order_seq_cst)) {
+                    if(m_auto_reset) {
+                        m_state.notify_one();
+                    } else {
+                        m_state.notify_all();
+                    }
+                }
+            }
+
+            /**
+             * Reset the event.
+             */
+            void reset() noexcept { m_state.store(UNSET, std::memory_order_relaxed); }
+
+            /**
+             * Return a value stating whether the event is set.
+             */
+            JLT_NODISCARD bool is_set() const noexcept {
+                return m_state.load(std::memory_order_acquire) == SET;
+            }
+
+            /**
+             * If the event is set, consume it when auto-reset, without waiting.
+             *
+             * @return True if the event was set, false if it wasn't.
+             */
+            bool try_wait() noexcept {
+                if(!m_auto_reset) {
+                    return m_state.load(std::memory_order_seq_cst) == SET;
+                }
+
+                uint32_t state = SET;
+
+                return m_state.compare_exchange_strong(
+                  state, UNSET, std::memory_order_seq_cst, std::memory_order_seq_cst);
+            }
+
+            /**
+             * Wait until the event is set, consuming it when auto-reset.
+             */
+            void wait() noexcept {
+                while(!detail::spin_until([this] { return try_wait(); })) {
+                    m_n_waiters.fetch_add(1, std::memory_order_seq_cst);
+
+                    bool const released = try_wait();
+
+                    if(!released) {
+                        m_state.wait(UNSET, std::memory_order_relaxed);
+                    }
+
+                    m_n_waiters.fetch_sub(1, std::memory_order_relaxed);
+
+                    if(released) {
+                        return;
+                    }
+                }
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_EVENT_HPP */
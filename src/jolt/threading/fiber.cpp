@@ -0,0 +1,40 @@
+#include <Windows.h>
+#include <jolt/debug.hpp>
+#include "fiber.hpp"
+
+namespace jolt {
+    namespace threading {
+        VOID WINAPI fiber_entry(LPVOID fiber_ptr) {
+            auto const fiber = reinterpret_cast<Fiber *>(fiber_ptr);
+
+            fiber->m_func(fiber->m_param);
+
+            jltassert2(false, "Fiber entry point returned");
+        }
+
+        Fiber::Fiber() : m_handle{::ConvertThreadToFiber(this)}, m_func{nullptr}, m_param{nullptr} {
+            jltassert(m_handle != NULL);
+        }
+
+        Fiber::Fiber(fiber_func const func, void *const param, size_t const stack_size) :
+          m_handle{nullptr}, m_func{func}, m_param{param} {
+            jltassert(func);
+
+            m_handle = ::CreateFiberEx(stack_size, stack_size, 0, &fiber_entry, this);
+
+            jltassert(m_handle != NULL);
+        }
+
+        Fiber::~Fiber() {
+            if(m_func) {
+                ::DeleteFiber(m_handle);
+            } else {
+                BOOL const result = ::ConvertFiberToThread();
+
+                jltassert(result);
+            }
+        }
+
+        void Fiber::switch_to() { ::SwitchToFiber(m_handle); }
+    } // namespace threading
+} // namespace jolt
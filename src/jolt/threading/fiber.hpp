@@ -0,0 +1,70 @@
+#ifndef JLT_THREADING_FIBER_HPP
+#define JLT_THREADING_FIBER_HPP
+
+#include <cstddef>
+
+#ifdef _WIN32
+    #include <Windows.h>
+#endif // _WIN32
+
+#include <jolt/api.hpp>
+
+namespace jolt {
+    namespace threading {
+        /**
+         * Fiber entry point. It must never return: when its work is done, a fiber must switch to
+         * another fiber and wait to be destroyed.
+         */
+        using fiber_func = void (*)(void *param);
+
+        /**
+         * A cooperatively scheduled execution context with its own stack.
+         *
+         * A thread must be converted into a fiber before switching to other fibers. A fiber not
+         * currently running can be resumed by any thread, so a fiber suspended on one thread can
+         * continue on another.
+         *
+         * @remarks Thread-local variables belong to the thread running the fiber. After switching
+         * fibers, a function must not keep using thread-local values read before the switch.
+         */
+        class JLTAPI Fiber {
+            void *m_handle;    //< OS fiber handle.
+            fiber_func m_func; //< Entry point, `nullptr` for converted threads.
+            void *m_param;     //< Parameter passed to the entry point.
+
+#ifdef _WIN32
+            friend VOID WINAPI fiber_entry(LPVOID fiber_ptr);
+#endif // _WIN32
+
+          public:
+            static constexpr size_t DEFAULT_STACK_SIZE = 64 * 1024; //< Default stack size, in bytes.
+
+            /**
+             * Convert the calling thread into a fiber. The instance must be destroyed by the same
+             * thread, which is converted back.
+             */
+            Fiber();
+
+            /**
+             * Create a new fiber. The fiber doesn't run until switched to.
+             *
+             * @param func The fiber entry point.
+             * @param param The parameter to pass to `func`.
+             * @param stack_size The size of the fiber stack, in bytes.
+             */
+            Fiber(fiber_func const func, void *const param, size_t const stack_size = DEFAULT_STACK_SIZE);
+
+            Fiber(Fiber const &) = delete;
+            Fiber &operator=(Fiber const &) = delete;
+
+            ~Fiber();
+
+            /**
+             * Suspend the fiber running on the calling thread and resume this one.
+             */
+            void switch_to();
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_FIBER_HPP */
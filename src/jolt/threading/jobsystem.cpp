@@ -0,0 +1,507 @@
+#include <emmintrin.h>
+#include <jolt/debug.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "lockguard.hpp"
+#include "jobsystem.hpp"
+
+namespace jolt {
+    namespace threading {
+        static const char *const WORKER_THREAD_NAME = "Job worker";
+
+        static thread_local void *t_current_worker = nullptr; //< Worker running on the current thread.
+
+        JobSystem::JobPool::~JobPool() {
+            for(Job *const chunk : m_chunks) { memory::free_array(chunk); }
+        }
+
+        JobSystem::JobSystem(unsigned n_workers, unsigned const shutdown_timeout_ms) :
+          m_workers{nullptr}, m_threads{nullptr},
+          m_n_workers{n_workers ? n_workers : max(get_available_processor_count(), 1u)},
+          m_external_jobs{EXTERNAL_QUEUE_CAPACITY},
+          m_external_pool_lock{LockSite{"JobSystem::m_external_pool_lock"}}, m_n_sleeping{0}, m_stop{false},
+          m_fibers{}, m_free_fibers{}, m_waiting_fibers{}, m_deferred_jobs{},
+          m_wait_lock{LockSite{"JobSystem::m_wait_lock"}}, m_n_waiting_fibers{0},
+          m_n_deferred_jobs{0}, m_shutdown_timeout_ms{shutdown_timeout_ms}, m_wake_sem{0} {
+            m_workers = memory::allocate_array<Worker *>(m_n_workers);
+
+            for(unsigned i = 0; i < m_n_workers; ++i) {
+                m_workers[i] = memory::allocate_and_construct<Worker>(*this, i);
+            }
+
+            t_current_worker = m_workers[0];
+
+            if(m_n_workers > 1) {
+                m_threads = memory::allocate_array<Thread>(m_n_workers - 1);
+
+                for(unsigned i = 1; i < m_n_workers; ++i) {
+                    Thread *const thread = m_threads + i - 1;
+
+                    memory::construct(thread, &worker_main, WORKER_THREAD_NAME);
+                    thread->start(m_workers[i]);
+                }
+            }
+        }
+
+        JobSystem::~JobSystem() {
+            m_stop.store(true, std::memory_order_seq_cst);
+
+            if(m_threads) {
+                m_wake_sem.release(m_n_workers - 1);
+
+                for(unsigned i = 0; i < m_n_workers - 1; ++i) { m_threads[i].join(); }
+
+                memory::free_array(m_threads);
+            }
+
+            // Workers only stop once no fiber is suspended
+            jltassert(!m_n_waiting_fibers.load(std::memory_order_relaxed));
+
+            // Only the calling thread is left: it can drain every deque
+            Worker *const worker = get_current_worker();
+
+            for(unsigned i = 0; i < m_n_workers; ++i) {
+                for(Job *job; m_workers[i]->m_jobs.steal(job);) { execute(job, worker); }
+            }
+
+            // Deferred jobs are polled until they've all been submitted, giving up on those whose
+            // condition isn't met in time rather than waiting forever
+            for(uint32_t waited_ms = 0; waited_ms < m_shutdown_timeout_ms;) {
+                if(run_pending_job()) {
+                    waited_ms = 0;
+
+                    continue;
+                }
+
+                if(!m_n_deferred_jobs.load(std::memory_order_relaxed)) {
+                    break;
+                }
+
+                sleep(FIBER_POLL_SLEEP_MS);
+                waited_ms += FIBER_POLL_SLEEP_MS;
+            }
+
+            if(t_current_worker == m_workers[0]) {
+                t_current_worker = nullptr;
+            }
+
+            for(JobFiber *const fiber : m_fibers) { memory::free(fiber); }
+            for(unsigned i = 0; i < m_n_workers; ++i) { memory::free(m_workers[i]); }
+
+            memory::free_array(m_workers);
+        }
+
+        JobSystem::Worker *JobSystem::get_current_worker() const {
+            auto const worker = reinterpret_cast<Worker *>(t_current_worker);
+
+            return worker && worker->m_system == this ? worker : nullptr;
+        }
+
+        JobSystem::Job *JobSystem::allocate_job(JobPool &pool, unsigned const pool_index) {
+            if(!pool.m_free) {
+                pool.m_free = pool.m_remote_free.exchange(nullptr, std::memory_order_acquire);
+            }
+
+            if(!pool.m_free) {
+                Job *const chunk = memory::allocate_array<Job>(JOB_CHUNK_LENGTH);
+
+                for(size_t i = 0; i < JOB_CHUNK_LENGTH; ++i) {
+                    chunk[i].m_next = i + 1 < JOB_CHUNK_LENGTH ? chunk + i + 1 : nullptr;
+                    chunk[i].m_pool = pool_index;
+                }
+
+                pool.m_chunks.push(chunk);
+                pool.m_free = chunk;
+            }
+
+            Job *const job = pool.m_free;
+
+            pool.m_free = job->m_next;
+
+            return job;
+        }
+
+        void JobSystem::free_job(Job *const job, Worker *const worker) {
+            if(worker && worker->m_index == job->m_pool) {
+                job->m_next = worker->m_pool.m_free;
+                worker->m_pool.m_free = job;
+
+                return;
+            }
+
+            // Only the owner takes from the remote list, and it takes the whole list at once, so
+            // pushing with a CAS is safe from ABA.
+            std::atomic<Job *> &remote_free = get_pool(job->m_pool).m_remote_free;
+            Job *head = remote_free.load(std::memory_order_relaxed);
+
+            do {
+                job->m_next = head;
+            } while(!remote_free.compare_exchange_weak(
+              head, job, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        JobSystem::Job *JobSystem::find_job(Worker *const worker) {
+            Job *job;
+
+            if(worker && worker->m_jobs.pop(job)) {
+                return job;
+            }
+
+            if(m_external_jobs.pop(job)) {
+                return job;
+            }
+
+            uint64_t rng = worker ? worker->m_rng : reinterpret_cast<uintptr_t>(&job);
+
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+
+            if(worker) {
+                worker->m_rng = rng;
+            }
+
+            unsigned const first_victim = static_cast<unsigned>(rng % m_n_workers);
+
+            for(unsigned i = 0; i < m_n_workers; ++i) {
+                Worker *const victim = m_workers[(first_victim + i) % m_n_workers];
+
+                if(victim != worker && victim->m_jobs.steal(job)) {
+                    return job;
+                }
+            }
+
+            return nullptr;
+        }
+
+        void JobSystem::execute(Job *const job, Worker *const worker) {
+            job_func const func = job->m_func;
+            void *const param = job->m_param;
+            JobCounter *const counter = job->m_counter;
+
+            free_job(job, worker);
+            func(param);
+
+            // Workers sleeping while fibers are suspended only wake up periodically: wake one up
+            // as soon as a counter is done.
+            if(counter && counter->done() && m_n_waiting_fibers.load(std::memory_order_relaxed)) {
+                wake_worker();
+            }
+        }
+
+        void JobSystem::wake_worker() {
+            // Pairs with the increment of `m_n_sleeping` in `fiber_main()`: either the sleeping
+            // worker sees the new job or this thread sees the worker going to sleep.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if(m_n_sleeping.load(std::memory_order_relaxed)) {
+                m_wake_sem.release();
+            }
+        }
+
+        JobSystem::JobFiber *JobSystem::acquire_fiber() {
+            LockGuard guard{m_wait_lock};
+
+            if(m_free_fibers.get_length()) {
+                return m_free_fibers.pop();
+            }
+
+            JobFiber *const fiber = memory::allocate_and_construct<JobFiber>();
+
+            m_fibers.push(fiber);
+
+            return fiber;
+        }
+
+        JobSystem::JobFiber *JobSystem::take_ready_fiber() {
+            if(!m_n_waiting_fibers.load(std::memory_order_relaxed)) {
+                return nullptr;
+            }
+
+            LockGuard guard{m_wait_lock};
+
+            for(size_t i = 0; i < m_waiting_fibers.get_length(); ++i) {
+                JobFiber *const fiber = m_waiting_fibers[i];
+
+                if(fiber->m_wait_counter->is_done()) {
+                    m_waiting_fibers.swap_remove_at(i);
+                    m_n_waiting_fibers.fetch_sub(1, std::memory_order_relaxed);
+
+                    return fiber;
+                }
+            }
+
+            return nullptr;
+        }
+
+        bool JobSystem::poll_deferred_jobs() {
+            if(!m_n_deferred_jobs.load(std::memory_order_relaxed) || !m_wait_lock.try_acquire()) {
+                return false;
+            }
+
+            bool submitted = false;
+
+            for(size_t i = 0; i < m_deferred_jobs.get_length();) {
+                DeferredJob const job = m_deferred_jobs[i];
+
+                if(job.m_ready(job.m_param)) {
+                    m_deferred_jobs.swap_remove_at(i);
+                    m_n_deferred_jobs.fetch_sub(1, std::memory_order_relaxed);
+                    submit(job.m_func, job.m_param, job.m_counter);
+
+                    submitted = true;
+                } else {
+                    ++i;
+                }
+            }
+
+            m_wait_lock.release();
+
+            return submitted;
+        }
+
+        void JobSystem::switch_fiber(Worker *const worker, JobFiber *const fiber) {
+            fiber->m_worker = worker;
+            worker->m_current_fiber = fiber;
+
+            fiber->m_fiber.switch_to();
+        }
+
+        void JobSystem::complete_switch(Worker *const worker) {
+            JobFiber *const released = worker->m_released_fiber;
+            JobFiber *const suspended = worker->m_suspended_fiber;
+
+            if(!released && !suspended) {
+                return;
+            }
+
+            worker->m_released_fiber = nullptr;
+            worker->m_suspended_fiber = nullptr;
+
+            LockGuard guard{m_wait_lock};
+
+            if(released) {
+                m_free_fibers.push(released);
+            }
+
+            if(suspended) {
+                m_waiting_fibers.push(suspended);
+            }
+        }
+
+        void JobSystem::suspend(JobFiber &fiber, JobCounter const &counter) {
+            Worker *const worker = fiber.m_worker;
+            JobFiber *next = take_ready_fiber();
+
+            if(!next) {
+                next = acquire_fiber();
+            }
+
+            // The fiber is added to the wait list by the next one, once it's not running anymore
+            fiber.m_wait_counter = &counter;
+            worker->m_suspended_fiber = &fiber;
+            m_n_waiting_fibers.fetch_add(1, std::memory_order_relaxed);
+
+            switch_fiber(worker, next);
+
+            // Resumed, possibly by another worker
+            fiber.m_wait_counter = nullptr;
+            complete_switch(fiber.m_worker);
+        }
+
+        void JobSystem::worker_main(void *param) {
+            auto const worker = reinterpret_cast<Worker *>(param);
+            JobSystem &system = *worker->m_system;
+            Fiber thread_fiber;
+
+            t_current_worker = worker;
+            worker->m_thread_fiber = &thread_fiber;
+
+            system.switch_fiber(worker, system.acquire_fiber());
+
+            // Switched back by the last job fiber when stopping. The fiber is not recycled, as other
+            // workers may still be running.
+            worker->m_released_fiber = nullptr;
+            worker->m_thread_fiber = nullptr;
+        }
+
+        void JobSystem::fiber_main(void *param) {
+            // The worker running the fiber changes when the fiber is resumed after being suspended:
+            // it's always read from the fiber.
+            auto const fiber = reinterpret_cast<JobFiber *>(param);
+            JobSystem &system = *fiber->m_worker->m_system;
+            unsigned n_idle = 0;
+            unsigned n_jobs = 0;
+
+            system.complete_switch(fiber->m_worker);
+
+            while(true) {
+                // Suspended fibers and deferred jobs are polled only now and then, as polling takes a
+                // lock
+                JobFiber *ready = nullptr;
+
+                if(n_jobs >= FIBER_POLL_INTERVAL || n_idle) {
+                    system.poll_deferred_jobs();
+                    ready = system.take_ready_fiber();
+                }
+
+                if(ready) {
+                    fiber->m_worker->m_released_fiber = fiber;
+                    system.switch_fiber(fiber->m_worker, ready);
+
+                    // Taken from the pool again
+                    system.complete_switch(fiber->m_worker);
+                    n_idle = n_jobs = 0;
+
+                    continue;
+                }
+
+                if(Job *const job = system.find_job(fiber->m_worker)) {
+                    system.execute(job, fiber->m_worker);
+                    n_idle = 0;
+                    ++n_jobs;
+
+                    continue;
+                }
+
+                n_jobs = 0;
+
+                // Deferred jobs are left to the destroying thread, so that a condition that is never
+                // met can't keep the workers from being joined
+                if(system.m_stop.load(std::memory_order_acquire)
+                   && !system.m_n_waiting_fibers.load(std::memory_order_seq_cst)) {
+                    break;
+                }
+
+                if(++n_idle < IDLE_SPIN_COUNT) {
+                    _mm_pause();
+
+                    continue;
+                }
+
+                system.m_n_sleeping.fetch_add(1, std::memory_order_seq_cst);
+
+                if(Job *const job = system.find_job(fiber->m_worker)) {
+                    system.m_n_sleeping.fetch_sub(1, std::memory_order_relaxed);
+                    system.execute(job, fiber->m_worker);
+                } else if(!system.m_stop.load(std::memory_order_seq_cst)) {
+                    // Counters of suspended fibers may be completed by threads that aren't running
+                    // jobs and nothing signals deferred jobs becoming ready, so nothing wakes the
+                    // workers up: poll while fibers or deferred jobs are waiting.
+                    if(system.has_waiting_work()) {
+                        system.m_wake_sem.try_acquire_for(FIBER_POLL_SLEEP_MS * 1'000'000ull);
+                    } else {
+                        system.m_wake_sem.acquire();
+                    }
+
+                    system.m_n_sleeping.fetch_sub(1, std::memory_order_relaxed);
+                } else {
+                    system.m_n_sleeping.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                n_idle = 1;
+            }
+
+            Worker *const worker = fiber->m_worker;
+
+            worker->m_released_fiber = fiber;
+            worker->m_current_fiber = nullptr;
+            worker->m_thread_fiber->switch_to();
+
+            jltassert2(false, "Stopped job fiber resumed");
+        }
+
+        void JobSystem::submit(job_func const func, void *const param, JobCounter *const counter) {
+            Worker *const worker = get_current_worker();
+            Job *job;
+
+            if(worker) {
+                job = allocate_job(worker->m_pool, worker->m_index);
+            } else {
+                LockGuard guard{m_external_pool_lock};
+
+                job = allocate_job(m_external_pool, m_n_workers);
+            }
+
+            job->m_func = func;
+            job->m_param = param;
+            job->m_counter = counter;
+
+            if(worker) {
+                worker->m_jobs.push(job);
+            } else if(!m_external_jobs.push(job)) {
+                execute(job, nullptr);
+
+                return;
+            }
+
+            wake_worker();
+        }
+
+        void JobSystem::run(job_func const func, void *const param, JobCounter *const counter) {
+            if(counter) {
+                counter->add();
+            }
+
+            submit(func, param, counter);
+        }
+
+        void JobSystem::run_when(
+          ready_func const ready, job_func const func, void *const param, JobCounter *const counter) {
+            if(counter) {
+                counter->add();
+            }
+
+            if(ready(param)) {
+                submit(func, param, counter);
+
+                return;
+            }
+
+            LockGuard guard{m_wait_lock};
+
+            m_deferred_jobs.push(DeferredJob{ready, func, param, counter});
+            m_n_deferred_jobs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void JobSystem::wait(JobCounter const &counter) {
+            Worker *const worker = get_current_worker();
+
+            if(worker && worker->m_current_fiber) {
+                if(!counter.is_done()) {
+                    suspend(*worker->m_current_fiber, counter);
+                }
+
+                return;
+            }
+
+            while(!counter.is_done()) {
+                if(Job *const job = find_job(worker)) {
+                    execute(job, worker);
+                } else if(!poll_deferred_jobs()) {
+                    _mm_pause();
+                }
+            }
+        }
+
+        bool JobSystem::run_pending_job() {
+            Worker *const worker = get_current_worker();
+            Job *job = find_job(worker);
+
+            if(!job && poll_deferred_jobs()) {
+                job = find_job(worker);
+            }
+
+            if(job) {
+                execute(job, worker);
+            }
+
+            return job;
+        }
+
+        JobSystem &get_default_job_system() {
+            static JobSystem system;
+
+            return system;
+        }
+    } // namespace threading
+} // namespace jolt
@@ -0,0 +1,348 @@
+#ifndef JLT_THREADING_JOBSYSTEM_HPP
+#define JLT_THREADING_JOBSYSTEM_HPP
+
+#include <atomic>
+#include <cstdint>
+
+#include <jolt/api.hpp>
+#include <jolt/memory/defs.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/mpmcqueue.hpp>
+#include <jolt/collections/workstealingdeque.hpp>
+#include "lock.hpp"
+#include "fiber.hpp"
+#include "semaphore.hpp"
+#include "thread.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * Counter of pending jobs, used to wait for a group of jobs to complete.
+         *
+         * Pass the same counter to each `JobSystem::run()` call of the group, then call
+         * `JobSystem::wait()` on it.
+         */
+        class JobCounter {
+            std::atomic<uint32_t> m_value; //< Number of pending jobs.
+
+          public:
+            JLT_NODISCARD JobCounter() : m_value{0} {}
+
+            JobCounter(JobCounter const &) = delete;
+            JobCounter &operator=(JobCounter const &) = delete;
+
+            /**
+             * Add pending jobs to the counter.
+             *
+             * @param n The number of jobs to add.
+             */
+            void add(uint32_t const n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+
+            /**
+             * Mark a pending job as completed.
+             *
+             * @return True if this was the last pending job. In this case, the writes of all the jobs
+             * of the group are visible to the calling thread.
+             */
+            bool done() { return m_value.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+            /**
+             * Return a value stating whether all the jobs have completed.
+             */
+            JLT_NODISCARD bool is_done() const { return m_value.load(std::memory_order_acquire) == 0; }
+
+            JLT_NODISCARD uint32_t get_value() const { return m_value.load(std::memory_order_acquire); }
+        };
+
+        /**
+         * A scheduler running short jobs on one worker per processor.
+         *
+         * Each worker owns a work-stealing deque: jobs submitted by a worker go to its own deque and
+         * are executed in LIFO order, while idle workers steal the oldest jobs of a randomly chosen
+         * victim. Jobs submitted by threads that are not workers go through a shared queue.
+         *
+         * The thread creating the job system is worker 0. It doesn't run jobs on its own, but helps
+         * executing them while waiting in `wait()`, as does any other thread waiting on a counter.
+         *
+         * The other workers run their jobs on fibers. A job waiting on a counter suspends its fiber
+         * and the worker goes on with another fiber, so waiting for I/O or the GPU inside a job
+         * doesn't keep a processor idle. The suspended fiber is resumed by the first worker that
+         * finds the counter done.
+         *
+         * A worker is woken up as soon as the counter of a job it runs reaches zero, or within
+         * `Semaphore::TIMED_WAIT_SLICE_NS` while it's polling. Counters completed by other means,
+         * such as a task or a thread that isn't a worker, and conditions of deferred jobs are polled:
+         * while fibers or deferred jobs are waiting, idle workers wake up every `FIBER_POLL_SLEEP_MS`,
+         * which bounds the latency of resuming them.
+         *
+         * Job descriptors are recycled through per-worker pools, so submitting a job doesn't touch the
+         * global allocator once the pools are warm.
+         */
+        class JLTAPI JobSystem {
+          public:
+            using job_func = void (*)(void *param);
+            using ready_func = bool (*)(void *param);
+
+            static constexpr size_t JOB_CHUNK_LENGTH = 256;         //< Jobs allocated at once by a pool.
+            static constexpr size_t EXTERNAL_QUEUE_CAPACITY = 4096; //< Capacity of the external queue.
+            static constexpr unsigned IDLE_SPIN_COUNT = 256;        //< Failed job searches before sleeping.
+            static constexpr size_t FIBER_STACK_SIZE = 64 * 1024;   //< Stack size of the job fibers.
+            static constexpr unsigned FIBER_POLL_INTERVAL = 32;     //< Jobs run between wait list polls.
+            static constexpr unsigned FIBER_POLL_SLEEP_MS = 1;      //< Sleep length while fibers wait.
+            static constexpr unsigned SHUTDOWN_TIMEOUT_MS = 10000;  //< Default deferred jobs wait on exit.
+
+          private:
+            struct Job {
+                job_func m_func;       //< Job entry point.
+                void *m_param;         //< Parameter passed to the entry point.
+                JobCounter *m_counter; //< Counter to decrement on completion, if any.
+                Job *m_next;           //< Next free job in the pool.
+                unsigned m_pool;       //< Index of the pool the job was allocated from.
+            };
+
+            /**
+             * Pool of job descriptors. Jobs are allocated by the owner of the pool only, but can be freed
+             * by any thread: those freed by other threads are handed back through a lock-free list.
+             */
+            struct JobPool {
+                Job *m_free;                     //< Jobs freed by the owner.
+                std::atomic<Job *> m_remote_free; //< Jobs freed by other threads.
+                collections::Vector<Job *> m_chunks; //< Allocated job arrays.
+
+                JobPool() : m_free{nullptr}, m_remote_free{nullptr}, m_chunks{} {}
+                ~JobPool();
+            };
+
+            /**
+             * Job waiting for a condition before being submitted.
+             */
+            struct DeferredJob {
+                ready_func m_ready;    //< Condition, called with `m_param`.
+                job_func m_func;       //< Job entry point.
+                void *m_param;         //< Parameter passed to the condition and the entry point.
+                JobCounter *m_counter; //< Counter to decrement on completion, if any.
+            };
+
+            struct Worker;
+
+            /**
+             * Fiber running the job loop of a worker. It can be suspended while a job waits and resumed
+             * later by any worker.
+             */
+            struct JobFiber {
+                Fiber m_fiber;                    //< The fiber.
+                Worker *m_worker;                 //< Worker currently running the fiber.
+                JobCounter const *m_wait_counter; //< Counter the fiber is waiting for, if suspended.
+
+                JobFiber() :
+                  m_fiber{&fiber_main, this, FIBER_STACK_SIZE}, m_worker{nullptr}, m_wait_counter{nullptr} {}
+            };
+
+            struct alignas(memory::CACHE_LINE_SIZE) Worker {
+                collections::WorkStealingDeque<Job *> m_jobs; //< Jobs submitted by this worker.
+                JobPool m_pool;                               //< Job descriptor pool.
+                JobSystem *m_system;                          //< The job system.
+                uint64_t m_rng;                               //< Random victim selection state.
+                unsigned m_index;                             //< Index of the worker.
+                Fiber *m_thread_fiber;                        //< The worker thread, as a fiber.
+                JobFiber *m_current_fiber;                    //< Job fiber running on the worker.
+                JobFiber *m_released_fiber;                   //< Fiber to recycle after switching.
+                JobFiber *m_suspended_fiber;                  //< Fiber to suspend after switching.
+
+                Worker(JobSystem &system, unsigned const index) :
+                  m_system{&system}, m_rng{0x9E3779B97F4A7C15ull * (index + 1)}, m_index{index},
+                  m_thread_fiber{nullptr}, m_current_fiber{nullptr}, m_released_fiber{nullptr},
+                  m_suspended_fiber{nullptr} {}
+            };
+
+            Worker **m_workers;                               //< Workers, the first is the creating thread.
+            Thread *m_threads;                                //< Worker threads.
+            unsigned const m_n_workers;                       //< Number of workers.
+            collections::MPMCQueue<Job *> m_external_jobs;    //< Jobs submitted by non-worker threads.
+            JobPool m_external_pool;                          //< Job pool of the non-worker threads.
+            Lock m_external_pool_lock;                        //< Lock protecting `m_external_pool`.
+            std::atomic<unsigned> m_n_sleeping;               //< Number of workers sleeping.
+            std::atomic<bool> m_stop;                         //< Set when the workers must terminate.
+            collections::Vector<JobFiber *> m_fibers;         //< All the job fibers.
+            collections::Vector<JobFiber *> m_free_fibers;    //< Job fibers ready to be reused.
+            collections::Vector<JobFiber *> m_waiting_fibers; //< Job fibers suspended in `wait()`.
+            collections::Vector<DeferredJob> m_deferred_jobs; //< Jobs waiting for their condition.
+            Lock m_wait_lock;                                 //< Lock protecting the wait lists.
+            std::atomic<unsigned> m_n_waiting_fibers;         //< Number of suspended job fibers.
+            std::atomic<unsigned> m_n_deferred_jobs;          //< Number of deferred jobs.
+            unsigned const m_shutdown_timeout_ms;             //< Wait for deferred jobs on destruction.
+            Semaphore m_wake_sem;                             //< Released to wake sleeping workers.
+
+            static void worker_main(void *param);
+            static void fiber_main(void *param);
+
+            /**
+             * Return the worker running on the calling thread or `nullptr` if the thread is not one of
+             * this job system's workers.
+             */
+            JLT_NODISCARD Worker *get_current_worker() const;
+
+            JLT_NODISCARD JobPool &get_pool(unsigned const index) {
+                return index < m_n_workers ? m_workers[index]->m_pool : m_external_pool;
+            }
+
+            JLT_NODISCARD Job *allocate_job(JobPool &pool, unsigned const pool_index);
+            void free_job(Job *const job, Worker *const worker);
+
+            /**
+             * Find a job to run: pop from the worker's own deque, then from the external queue, then
+             * try to steal from the other workers.
+             *
+             * @param worker The worker running on the calling thread, or `nullptr`.
+             */
+            JLT_NODISCARD Job *find_job(Worker *const worker);
+
+            /**
+             * Submit a job without incrementing its counter.
+             */
+            void submit(job_func const func, void *const param, JobCounter *const counter);
+
+            void execute(Job *const job, Worker *const worker);
+            void wake_worker();
+
+            /**
+             * Submit the deferred jobs whose condition is met. Does nothing if another thread is
+             * already polling.
+             *
+             * @return True if at least one job has been submitted.
+             */
+            bool poll_deferred_jobs();
+
+            /**
+             * Return a value stating whether fibers or deferred jobs are waiting.
+             */
+            JLT_NODISCARD bool has_waiting_work() const {
+                return m_n_waiting_fibers.load(std::memory_order_seq_cst)
+                       || m_n_deferred_jobs.load(std::memory_order_seq_cst);
+            }
+
+            /**
+             * Take a fiber from the pool, creating it if the pool is empty.
+             */
+            JLT_NODISCARD JobFiber *acquire_fiber();
+
+            /**
+             * Remove a suspended fiber whose counter is done from the wait list.
+             *
+             * @return The fiber or `nullptr` if no suspended fiber can be resumed.
+             */
+            JLT_NODISCARD JobFiber *take_ready_fiber();
+
+            /**
+             * Switch the calling worker to a job fiber.
+             *
+             * @param worker The worker running on the calling thread.
+             * @param fiber The fiber to switch to.
+             */
+            void switch_fiber(Worker *const worker, JobFiber *const fiber);
+
+            /**
+             * Recycle or suspend the fiber the calling worker just switched away from. Must be called
+             * after each fiber switch, by the fiber that has been switched to.
+             *
+             * @param worker The worker running on the calling thread.
+             */
+            void complete_switch(Worker *const worker);
+
+            /**
+             * Suspend a job fiber until a counter is done, running other fibers on its worker.
+             *
+             * @param fiber The fiber running on the calling thread.
+             * @param counter The counter to wait for.
+             */
+            void suspend(JobFiber &fiber, JobCounter const &counter);
+
+          public:
+            /**
+             * Create a new job system and start its workers.
+             *
+             * @param n_workers The number of workers, including the calling thread. Set to 0 to use
+             * one worker per available processor.
+             * @param shutdown_timeout_ms How long the destructor waits for a deferred job to become
+             * ready before dropping the remaining ones, in ms.
+             */
+            explicit JobSystem(unsigned n_workers = 0, unsigned shutdown_timeout_ms = SHUTDOWN_TIMEOUT_MS);
+
+            JobSystem(JobSystem const &) = delete;
+            JobSystem &operator=(JobSystem const &) = delete;
+
+            /**
+             * Stop and join the workers. Any job still pending is run by the calling thread.
+             *
+             * The workers don't wait for deferred jobs: the calling thread polls them once the workers
+             * are joined. If no job becomes ready for the shutdown timeout, the remaining deferred jobs
+             * are dropped without running and their counters never complete.
+             */
+            ~JobSystem();
+
+            /**
+             * Submit a job.
+             *
+             * @param func The job entry point.
+             * @param param The parameter to pass to `func`.
+             * @param counter The counter to decrement when the job completes, if any. It's incremented
+             * before the job is submitted.
+             */
+            void run(job_func const func, void *const param, JobCounter *const counter = nullptr);
+
+            /**
+             * Submit a job once a condition is met. The condition is polled by the workers between
+             * jobs and while idle, and by threads waiting in `wait()`, so it must be cheap to check.
+             *
+             * @param ready The condition. It's called with `param` and returns true once the job can
+             * run.
+             * @param func The job entry point.
+             * @param param The parameter to pass to `ready` and `func`.
+             * @param counter The counter to decrement when the job completes, if any. It's incremented
+             * immediately.
+             */
+            void run_when(
+              ready_func const ready,
+              job_func const func,
+              void *const param,
+              JobCounter *const counter = nullptr);
+
+            /**
+             * Wait until all the jobs of a counter have completed. Jobs running on a worker fiber
+             * suspend until then, while other threads run pending jobs.
+             *
+             * @param counter The counter to wait for.
+             *
+             * @remarks A suspended job can be resumed on a different thread.
+             */
+            void wait(JobCounter const &counter);
+
+            /**
+             * Run one pending job on the calling thread, if any.
+             *
+             * @return True if a job was run, false if no job was found.
+             */
+            bool run_pending_job();
+
+            /**
+             * Return the number of workers, including the thread that created the job system.
+             */
+            JLT_NODISCARD unsigned get_worker_count() const { return m_n_workers; }
+
+            /**
+             * Return a value stating whether the calling thread is one of the workers. Jobs submitted
+             * by a worker go to its own LIFO deque, those submitted by other threads to the FIFO
+             * external queue.
+             */
+            JLT_NODISCARD bool is_worker_thread() const { return get_current_worker() != nullptr; }
+        };
+
+        /**
+         * Return the default job system, creating it on first use. The first thread to call this
+         * function becomes its worker 0.
+         */
+        JLTAPI JobSystem &get_default_job_system();
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_JOBSYSTEM_HPP */
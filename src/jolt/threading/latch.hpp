@@ -0,0 +1,71 @@
+#ifndef JLT_THREADING_LATCH_HPP
+#define JLT_THREADING_LATCH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include "wait.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A single-use countdown: threads wait until the count reaches zero.
+         *
+         * Waiting threads spin briefly, then sleep on the address of the count.
+         */
+        class Latch {
+            std::atomic<uint32_t> m_count; //< Count left before the waiting threads are released.
+
+          public:
+            /**
+             * Create a new instance of this class.
+             *
+             * @param count The initial count.
+             */
+            JLT_NODISCARD explicit Latch(uint32_t const count) noexcept : m_count{count} {}
+
+            Latch(Latch const &) = delete;
+            Latch &operator=(Latch const &) = delete;
+
+            /**
+             * Decrement the count, releasing the waiting threads when it reaches zero.
+             *
+             * @param n The amount to decrement the count by. Must not exceed the count.
+             */
+            void count_down(uint32_t const n = 1) noexcept {
+                uint32_t const count = m_count.fetch_sub(n, std::memory_order_acq_rel);
+
+                jltassert2(count >= n, "Latch count decremented below zero");
+
+                if(count == n) {
+                    m_count.notify_all();
+                }
+            }
+
+            /**
+             * Return a value stating whether the count has reached zero.
+             */
+            JLT_NODISCARD bool try_wait() const noexcept { return !m_count.load(std::memory_order_acquire); }
+
+            /**
+             * Wait until the count reaches zero.
+             */
+            void wait() noexcept {
+                for(uint32_t count; (count = m_count.load(std::memory_order_acquire));) {
+                    detail::wait_while_equal(m_count, count);
+                }
+            }
+
+            /**
+             * Decrement the count and wait until it reaches zero.
+             */
+            void arrive_and_wait(uint32_t const n = 1) noexcept {
+                count_down(n);
+                wait();
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_LATCH_HPP */
@@ -0,0 +1,46 @@
+#ifndef _WIN32
+    #include <emmintrin.h>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include "lock.hpp"
+
+namespace jolt {
+    namespace threading {
+        void Lock::acquire_contended() noexcept {
+            // Spin for up to twice the recent average, as the lock is likely to be held as long
+            int32_t const average_spins = m_spins.load(std::memory_order_relaxed);
+            uint32_t const max_spins = min(m_max_spins, static_cast<uint32_t>(average_spins) * 2 + 10);
+            uint32_t spins = 0;
+
+            for(; spins < max_spins; ++spins) {
+                uint32_t state = m_state.load(std::memory_order_relaxed);
+
+                if(state == UNLOCKED
+                   && m_state.compare_exchange_weak(
+                     state, LOCKED, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    break;
+                }
+
+                _mm_pause();
+            }
+
+            m_spins.store(
+              average_spins + (static_cast<int32_t>(spins) - average_spins) / 8, std::memory_order_relaxed);
+
+            if(spins < max_spins) {
+                return;
+            }
+
+            // Whoever acquires the lock from here on can't know whether other threads sleep on it
+            while(m_state.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED) {
+                ::syscall(SYS_futex, &m_state, FUTEX_WAIT_PRIVATE, CONTENDED, nullptr, nullptr, 0);
+            }
+        }
+
+        void Lock::wake() noexcept {
+            ::syscall(SYS_futex, &m_state, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+    } // namespace threading
+} // namespace jolt
+#endif // _WIN32
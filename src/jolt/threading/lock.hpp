@@ -2,36 +2,162 @@
 #define JLT_THREADING_LOCK_HPP
 
 #include <limits>
+#include <jolt/api.hpp>
 #include <jolt/util.hpp>
 #include <jolt/debug.hpp>
+#include "thread.hpp"
+#include "lockprofiler.hpp"
 
 #ifdef _WIN32
     #include <Windows.h>
+#elif defined(__linux__)
+    #include <cstdint>
 #else
     #error OS not supported
 #endif // _WIN32
 
+#include <atomic>
+
 namespace jolt {
     namespace threading {
         /**
          * A lock that busy-waits at first and then yields control until the resource is available.
+         *
+         * On Windows this is a critical section. On Linux this is a futex-based mutex: acquiring and
+         * releasing an uncontended lock is a single atomic operation, with no system call. Waiters
+         * spin for a number of times adapted to how long the lock has recently been held before
+         * sleeping on the futex.
+         *
+         * The lock is not recursive: a thread must not acquire a lock it already holds. This is
+         * asserted in debug builds, as on Windows the critical section would allow it.
+         *
+         * When lock profiling is enabled, acquisitions are recorded to the statistics of the lock
+         * site.
          */
-        class Lock {
+        class JLTAPI Lock {
+#ifdef _WIN32
             CRITICAL_SECTION m_lock;
+#else
+            static constexpr uint32_t UNLOCKED = 0;  //< Nobody holds the lock.
+            static constexpr uint32_t LOCKED = 1;    //< The lock is held and nobody sleeps on it.
+            static constexpr uint32_t CONTENDED = 2; //< The lock is held and waiters may sleep on it.
+
+            std::atomic<uint32_t> m_state; //< The lock state and futex word.
+            uint32_t m_max_spins;          //< Maximum number of spins before sleeping.
+            std::atomic<int32_t> m_spins;  //< Moving average of the spins needed to acquire the lock.
+
+            /**
+             * Spin, then sleep until the lock is acquired.
+             */
+            void acquire_contended() noexcept;
+
+            /**
+             * Wake a thread sleeping on the lock.
+             */
+            void wake() noexcept;
+#endif // _WIN32
+
+#ifndef NDEBUG
+            std::atomic<thread_id> m_owner; //< ID of the owner thread when the lock is held.
+#endif // NDEBUG
+
+#ifdef JLT_WITH_LOCK_PROFILING
+            LockProfile m_profile; //< Profiling state.
+#endif // JLT_WITH_LOCK_PROFILING
+
+            /**
+             * Assert the calling thread doesn't hold the lock already.
+             */
+            JLT_INLINE void check_not_owner() const noexcept {
+#ifndef NDEBUG
+                jltassert2(
+                  m_owner.load(std::memory_order_relaxed) != Thread::get_current().get_id(),
+                  "Lock is not recursive");
+#endif // NDEBUG
+            }
+
+            /**
+             * Record the calling thread as the owner of the lock, in debug builds.
+             */
+            JLT_INLINE void set_owner() noexcept {
+#ifndef NDEBUG
+                m_owner.store(Thread::get_current().get_id(), std::memory_order_relaxed);
+#endif // NDEBUG
+            }
+
+            JLT_INLINE bool try_lock() noexcept {
+#ifdef _WIN32
+                return (bool)::TryEnterCriticalSection(&m_lock);
+#else
+                uint32_t state = UNLOCKED;
+
+                return m_state.compare_exchange_strong(
+                  state, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+#endif // _WIN32
+            }
+
+            /**
+             * Wait until the lock is available and then acquire it, once `try_lock()` has failed.
+             */
+            JLT_INLINE void wait_lock() noexcept {
+#ifdef _WIN32
+                ::EnterCriticalSection(&m_lock);
+#else
+                acquire_contended();
+#endif // _WIN32
+            }
 
           public:
+#ifdef _WIN32
+            static constexpr size_t DEFAULT_SPIN_COUNT = 0; //< Default number of spins before yielding.
+#else
+            static constexpr size_t DEFAULT_SPIN_COUNT = 128; //< Default number of spins before yielding.
+#endif // _WIN32
+
             /**
              * Initialize a new instance of this class.
              *
-             * @param spin_count The number of times to spin before yielding control
+             * @param spin_count The number of times to spin before yielding control. On Linux, this
+             * is an upper bound to the adaptive number of spins.
+             * @param site The name the lock is profiled under. Defaults to the location the lock is
+             * created at.
              */
-            explicit Lock(size_t spin_count = 0) noexcept {
+            explicit Lock(
+              size_t spin_count = DEFAULT_SPIN_COUNT, JLT_MAYBE_UNUSED LockSite const site = {}) noexcept
+#ifdef JLT_WITH_LOCK_PROFILING
+              :
+              m_profile{site}
+#endif // JLT_WITH_LOCK_PROFILING
+            {
+#ifndef NDEBUG
+                m_owner.store(INVALID_THREAD_ID, std::memory_order_relaxed);
+#endif // NDEBUG
+
+#ifdef _WIN32
                 jltassert(spin_count <= std::numeric_limits<DWORD>::max());
 
                 ::InitializeCriticalSectionAndSpinCount(&m_lock, (DWORD)spin_count);
+#else
+                jltassert(spin_count <= std::numeric_limits<int32_t>::max());
+
+                m_state.store(UNLOCKED, std::memory_order_relaxed);
+                m_max_spins = static_cast<uint32_t>(spin_count);
+                m_spins.store(0, std::memory_order_relaxed);
+#endif // _WIN32
             }
 
+            /**
+             * Initialize a new instance of this class.
+             *
+             * @param site The name the lock is profiled under.
+             * @param spin_count The number of times to spin before yielding control.
+             */
+            explicit Lock(LockSite const site, size_t spin_count = DEFAULT_SPIN_COUNT) noexcept :
+              Lock{spin_count, site} {}
+
+#ifdef _WIN32
             ~Lock() noexcept { ::DeleteCriticalSection(&m_lock); }
+#endif // _WIN32
 
             Lock(Lock &other) = delete;
             Lock &operator=(Lock &other) = delete;
@@ -43,18 +169,72 @@ namespace jolt {
              * thread alraedy holds it
              */
             JLT_INLINE bool try_acquire() noexcept {
-                return (bool)::TryEnterCriticalSection(&m_lock);
+                check_not_owner();
+
+                if(!try_lock()) {
+                    return false;
+                }
+
+                set_owner();
+
+#ifdef JLT_WITH_LOCK_PROFILING
+                m_profile.on_acquired(false);
+#endif // JLT_WITH_LOCK_PROFILING
+
+                return true;
             }
 
             /**
              * Wait until the lock is available and then acquire it.
              */
-            JLT_INLINE void acquire() noexcept { ::EnterCriticalSection(&m_lock); }
+            JLT_INLINE void acquire() noexcept {
+                check_not_owner();
+
+#ifdef JLT_WITH_LOCK_PROFILING
+                if(try_lock()) {
+                    set_owner();
+                    m_profile.on_acquired(false);
+
+                    return;
+                }
+
+                uint64_t const wait_begin = LockProfile::now();
+
+                wait_lock();
+                set_owner();
+                m_profile.on_acquired(true, wait_begin);
+#else
+                if(!try_lock()) {
+                    wait_lock();
+                }
+
+                set_owner();
+#endif // JLT_WITH_LOCK_PROFILING
+            }
 
             /**
              * Release the lock.
              */
-            JLT_INLINE void release() noexcept { ::LeaveCriticalSection(&m_lock); }
+            JLT_INLINE void release() noexcept {
+#ifdef JLT_WITH_LOCK_PROFILING
+                m_profile.on_released();
+#endif // JLT_WITH_LOCK_PROFILING
+
+#ifndef NDEBUG
+                jltassert2(
+                  m_owner.load(std::memory_order_relaxed) == Thread::get_current().get_id(),
+                  "Lock released by a thread not holding it");
+                m_owner.store(INVALID_THREAD_ID, std::memory_order_relaxed);
+#endif // NDEBUG
+
+#ifdef _WIN32
+                ::LeaveCriticalSection(&m_lock);
+#else
+                if(m_state.exchange(UNLOCKED, std::memory_order_release) == CONTENDED) {
+                    wake();
+                }
+#endif // _WIN32
+            }
         };
     } // namespace threading
 } // namespace jolt
@@ -3,6 +3,7 @@
 
 #include <jolt/util.hpp>
 #include "lock.hpp"
+#include "lockprofiler.hpp"
 
 namespace jolt {
     namespace threading {
@@ -10,6 +11,9 @@ namespace jolt {
          * A lock guard that ensures a lock is immediately acquired upon guard creation
          * and released upon guard destruction.
          *
+         * When lock profiling is enabled, the guard records the acquisition to the statistics of the
+         * site it's created at, so that contention on a shared lock can be traced back to its users.
+         *
          * @tparam T The type of lock.
          */
         template<typename T>
@@ -21,17 +25,36 @@ namespace jolt {
           private:
             lock_reference m_lock; /**< Held lock */
 
+#ifdef JLT_WITH_LOCK_PROFILING
+            LockProfile m_profile; //< Profiling state.
+#endif // JLT_WITH_LOCK_PROFILING
+
           public:
             /**
              * Initialize a new instance of this class.
              *
              * @param lock The lock to guard.
+             * @param site The name the guard is profiled under. Defaults to the location the guard
+             * is created at.
              *
              * @remarks The specified lock is acquired immediately. If the lock is already held by
              * another thread, this guard will wait until the lock is available.
              */
-            explicit JLT_INLINE LockGuard(lock_reference lock) noexcept : m_lock{lock} {
+            explicit JLT_INLINE LockGuard(
+              lock_reference lock, JLT_MAYBE_UNUSED LockSite const site = {}) noexcept :
+              m_lock{lock}
+#ifdef JLT_WITH_LOCK_PROFILING
+              ,
+              m_profile{site}
+#endif // JLT_WITH_LOCK_PROFILING
+            {
+#ifdef JLT_WITH_LOCK_PROFILING
+                LockProfile::clear_last_acquisition();
+                m_lock.acquire();
+                m_profile.on_guard_acquired();
+#else
                 m_lock.acquire();
+#endif // JLT_WITH_LOCK_PROFILING
             }
 
             LockGuard(LockGuard<lock_type> &other) = delete;
@@ -42,7 +65,13 @@ namespace jolt {
              *
              * @remarks The lock is released immediately upon guard destruction.
              */
-            JLT_INLINE ~LockGuard() noexcept { m_lock.release(); }
+            JLT_INLINE ~LockGuard() noexcept {
+#ifdef JLT_WITH_LOCK_PROFILING
+                m_profile.on_released();
+#endif // JLT_WITH_LOCK_PROFILING
+
+                m_lock.release();
+            }
         };
     } // namespace threading
 } // namespace jolt
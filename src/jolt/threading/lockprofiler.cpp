@@ -0,0 +1,141 @@
+#include <cstring>
+#include <jolt/algorithms.hpp>
+#include <jolt/hash.hpp>
+#include "lockprofiler.hpp"
+
+using namespace jolt::threading;
+
+namespace {
+    constexpr uint32_t ENTRY_EMPTY = 0;   //< The entry is free.
+    constexpr uint32_t ENTRY_FILLING = 1; //< A thread is writing the site of the entry.
+    constexpr uint32_t ENTRY_READY = 2;   //< The entry is in use.
+
+    struct Entry {
+        std::atomic<uint32_t> m_state; //< Entry state.
+        LockStats m_stats;             //< Statistics of the site.
+    };
+
+    // Fixed-size open-addressing table, so that the allocator's own locks can be profiled
+    Entry g_entries[MAX_LOCK_SITES];
+    LockStats g_other_stats{LockSite{"<other>"}};
+
+    bool is_same_site(LockSite const &a, LockSite const &b) {
+        return a.m_line == b.m_line && (a.m_name == b.m_name || !strcmp(a.m_name, b.m_name));
+    }
+
+    size_t hash_site(LockSite const &site) {
+        jolt::hash::hash_t const hash = jolt::hash::XXHash::hash(site.m_name, strlen(site.m_name));
+
+        return static_cast<size_t>(hash ^ (site.m_line * 0x9e3779b97f4a7c15ull));
+    }
+
+    void reset(LockStats &stats) {
+        stats.m_n_acquisitions.store(0, std::memory_order_relaxed);
+        stats.m_n_contended.store(0, std::memory_order_relaxed);
+        stats.m_wait_time.store(0, std::memory_order_relaxed);
+        stats.m_max_wait_time.store(0, std::memory_order_relaxed);
+        stats.m_hold_time.store(0, std::memory_order_relaxed);
+        stats.m_max_hold_time.store(0, std::memory_order_relaxed);
+    }
+
+    void print(FILE *const stream, LockStats const &stats) {
+        char name[256];
+
+        if(stats.m_site.m_line) {
+            snprintf(name, sizeof(name), "%s:%u", stats.m_site.m_name, stats.m_site.m_line);
+        } else {
+            snprintf(name, sizeof(name), "%s", stats.m_site.m_name);
+        }
+
+        fprintf(
+          stream,
+          "%-48s %12llu %12llu %12.1f %12.1f %12.1f %12.1f\n",
+          name,
+          static_cast<unsigned long long>(stats.m_n_acquisitions.load(std::memory_order_relaxed)),
+          static_cast<unsigned long long>(stats.m_n_contended.load(std::memory_order_relaxed)),
+          stats.m_wait_time.load(std::memory_order_relaxed) / 1000.0,
+          stats.m_max_wait_time.load(std::memory_order_relaxed) / 1000.0,
+          stats.m_hold_time.load(std::memory_order_relaxed) / 1000.0,
+          stats.m_max_hold_time.load(std::memory_order_relaxed) / 1000.0);
+    }
+} // namespace
+
+namespace jolt {
+    namespace threading {
+        LockProfile::Acquisition &LockProfile::get_last_acquisition() noexcept {
+            static thread_local Acquisition t_last_acquisition{false, 0};
+
+            return t_last_acquisition;
+        }
+
+        LockStats &get_lock_stats(LockSite const &site) {
+            size_t const begin = hash_site(site) % MAX_LOCK_SITES;
+
+            for(size_t i = begin, n_probes = 0; n_probes < MAX_LOCK_SITES;
+                i = (i + 1) % MAX_LOCK_SITES, ++n_probes) {
+                Entry &entry = g_entries[i];
+                uint32_t state = entry.m_state.load(std::memory_order_acquire);
+
+                if(state == ENTRY_EMPTY
+                   && entry.m_state.compare_exchange_strong(
+                     state, ENTRY_FILLING, std::memory_order_acquire, std::memory_order_acquire)) {
+                    entry.m_stats.m_site = site;
+                    entry.m_state.store(ENTRY_READY, std::memory_order_release);
+
+                    return entry.m_stats;
+                }
+
+                // Another thread may be registering a site here: it could be this one
+                while(state == ENTRY_FILLING) { state = entry.m_state.load(std::memory_order_acquire); }
+
+                if(is_same_site(entry.m_stats.m_site, site)) {
+                    return entry.m_stats;
+                }
+            }
+
+            return g_other_stats;
+        }
+
+        void reset_lock_stats() {
+            for(Entry &entry : g_entries) {
+                if(entry.m_state.load(std::memory_order_acquire) == ENTRY_READY) {
+                    reset(entry.m_stats);
+                }
+            }
+
+            reset(g_other_stats);
+        }
+
+        void dump_lock_stats(FILE *const stream) {
+            LockStats *stats[MAX_LOCK_SITES];
+            size_t n_stats = 0;
+
+            for(Entry &entry : g_entries) {
+                if(entry.m_state.load(std::memory_order_acquire) == ENTRY_READY) {
+                    stats[n_stats++] = &entry.m_stats;
+                }
+            }
+
+            algorithms::sort(stats, n_stats, [](LockStats const *const s) {
+                return UINT64_MAX - s->m_wait_time.load(std::memory_order_relaxed);
+            });
+
+            fprintf(
+              stream,
+              "%-48s %12s %12s %12s %12s %12s %12s\n",
+              "Lock site",
+              "Acquired",
+              "Contended",
+              "Wait (us)",
+              "Max wait",
+              "Hold (us)",
+              "Max hold");
+
+            for(size_t i = 0; i < n_stats; ++i) { print(stream, *stats[i]); }
+
+            if(g_other_stats.m_n_acquisitions.load(std::memory_order_relaxed)) {
+                print(stream, g_other_stats);
+            }
+        }
+    } // namespace threading
+} // namespace jolt
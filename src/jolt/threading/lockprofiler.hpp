@@ -0,0 +1,192 @@
+#ifndef JLT_THREADING_LOCKPROFILER_HPP
+#define JLT_THREADING_LOCKPROFILER_HPP
+
+#include <cstdio>
+#include <jolt/features.hpp>
+#include <jolt/api.hpp>
+
+#ifdef JLT_WITH_LOCK_PROFILING
+    #include <atomic>
+    #include <chrono>
+    #include <cstddef>
+    #include <cstdint>
+    #include <source_location>
+#endif // JLT_WITH_LOCK_PROFILING
+
+namespace jolt {
+    namespace threading {
+#ifdef JLT_WITH_LOCK_PROFILING
+        /**
+         * Identifies the statistics a profiled lock or lock guard records to: a name, or by default
+         * the location the lock or the guard is created at. Locks sharing a name share their
+         * statistics.
+         *
+         * @remarks Locks created through `memory::construct()` or other wrappers default to the
+         * location inside the wrapper and should be given a name.
+         */
+        struct LockSite {
+            char const *m_name; //< Lock name or source file name.
+            uint32_t m_line;    //< Source line or 0 for named locks.
+
+            constexpr LockSite(char const *const name) noexcept : m_name{name}, m_line{0} {}
+
+            constexpr LockSite(
+              std::source_location const location = std::source_location::current()) noexcept :
+              m_name{location.file_name()},
+              m_line{location.line()} {}
+        };
+
+        /**
+         * Contention statistics of a lock site. Times are in ns.
+         */
+        struct LockStats {
+            LockSite m_site;                        //< Lock site.
+            std::atomic<uint64_t> m_n_acquisitions; //< Number of acquisitions.
+            std::atomic<uint64_t> m_n_contended;    //< Number of acquisitions that had to wait.
+            std::atomic<uint64_t> m_wait_time;      //< Total time spent waiting to acquire.
+            std::atomic<uint64_t> m_max_wait_time;  //< Longest time spent waiting to acquire.
+            std::atomic<uint64_t> m_hold_time;      //< Total time the lock has been held for.
+            std::atomic<uint64_t> m_max_hold_time;  //< Longest time the lock has been held for.
+        };
+
+        constexpr size_t MAX_LOCK_SITES = 1024; //< Maximum number of lock sites with their own statistics.
+
+        /**
+         * Return the statistics of a lock site, creating them on first use.
+         *
+         * @remarks This function doesn't allocate memory and can be used by the locks of the allocator.
+         * Once `MAX_LOCK_SITES` sites are in use, further sites share a single entry named "<other>".
+         */
+        JLTAPI LockStats &get_lock_stats(LockSite const &site);
+
+        /**
+         * Reset the statistics of all the lock sites.
+         */
+        JLTAPI void reset_lock_stats();
+
+        /**
+         * Print the statistics of all the lock sites, by descending total wait time.
+         *
+         * @param stream The stream to print to.
+         */
+        JLTAPI void dump_lock_stats(FILE *const stream = stderr);
+
+        /**
+         * Profiling state of a single lock or lock guard.
+         */
+        class JLTAPI LockProfile {
+            /**
+             * Outcome of an acquisition.
+             */
+            struct Acquisition {
+                bool m_contended;     //< True if the thread had to wait.
+                uint64_t m_wait_time; //< Time spent waiting.
+            };
+
+            LockSite const m_site;                    //< Lock site.
+            std::atomic<LockStats *> mutable m_stats; //< Site statistics, looked up on first use.
+            uint64_t m_acquired_at;                   //< Time of the last acquisition, for the owner.
+
+            /**
+             * Return the outcome of the last acquisition made by the current thread, for the guards.
+             */
+            static Acquisition &get_last_acquisition() noexcept;
+
+            static void update_max(std::atomic<uint64_t> &max_value, uint64_t const value) noexcept {
+                uint64_t current = max_value.load(std::memory_order_relaxed);
+
+                while(value > current
+                      && !max_value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+            }
+
+            LockStats &get_stats() const noexcept {
+                LockStats *stats = m_stats.load(std::memory_order_acquire);
+
+                if(!stats) {
+                    stats = &get_lock_stats(m_site);
+                    m_stats.store(stats, std::memory_order_release);
+                }
+
+                return *stats;
+            }
+
+            void record_acquisition(uint64_t const acquired_at, Acquisition const acquisition) noexcept {
+                LockStats &stats = get_stats();
+
+                m_acquired_at = acquired_at;
+                stats.m_n_acquisitions.fetch_add(1, std::memory_order_relaxed);
+
+                if(acquisition.m_contended) {
+                    stats.m_n_contended.fetch_add(1, std::memory_order_relaxed);
+                    stats.m_wait_time.fetch_add(acquisition.m_wait_time, std::memory_order_relaxed);
+                    update_max(stats.m_max_wait_time, acquisition.m_wait_time);
+                }
+            }
+
+          public:
+            constexpr explicit LockProfile(LockSite const site) noexcept :
+              m_site{site}, m_stats{nullptr}, m_acquired_at{0} {}
+
+            /**
+             * Return the current time, in ns.
+             */
+            static uint64_t now() noexcept {
+                auto const time = std::chrono::steady_clock::now().time_since_epoch();
+
+                return static_cast<uint64_t>(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+            }
+
+            /**
+             * Record the lock has been acquired. Must be called by the new owner.
+             *
+             * @param contended True if the thread had to wait.
+             * @param wait_begin The time the thread began waiting at, if it had to.
+             */
+            void on_acquired(bool const contended, uint64_t const wait_begin = 0) noexcept {
+                uint64_t const acquired_at = now();
+                Acquisition const acquisition{contended, contended ? acquired_at - wait_begin : 0};
+
+                get_last_acquisition() = acquisition;
+                record_acquisition(acquired_at, acquisition);
+            }
+
+            /**
+             * Forget the outcome of the last acquisition made by the current thread. Lock guards
+             * call this before acquiring a lock, which may not be profiled.
+             */
+            static void clear_last_acquisition() noexcept { get_last_acquisition() = {false, 0}; }
+
+            /**
+             * Record a lock guard has acquired its lock, as the last acquisition made by the current
+             * thread.
+             */
+            void on_guard_acquired() noexcept { record_acquisition(now(), get_last_acquisition()); }
+
+            /**
+             * Record the lock has been released. Must be called by the owner, before releasing.
+             */
+            void on_released() noexcept {
+                LockStats &stats = get_stats();
+                uint64_t const hold_time = now() - m_acquired_at;
+
+                stats.m_hold_time.fetch_add(hold_time, std::memory_order_relaxed);
+                update_max(stats.m_max_hold_time, hold_time);
+            }
+        };
+#else
+        /**
+         * Identifies the statistics a profiled lock records to. Empty unless lock profiling is enabled.
+         */
+        struct LockSite {
+            constexpr LockSite(JLT_MAYBE_UNUSED char const *const name) noexcept {}
+            constexpr LockSite() noexcept {}
+        };
+
+        inline void reset_lock_stats() {}
+        inline void dump_lock_stats(JLT_MAYBE_UNUSED FILE *const stream = stderr) {}
+#endif // JLT_WITH_LOCK_PROFILING
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_LOCKPROFILER_HPP */
@@ -0,0 +1,132 @@
+#ifndef JLT_THREADING_MCSLOCK_HPP
+#define JLT_THREADING_MCSLOCK_HPP
+
+#include <atomic>
+#include <emmintrin.h>
+#include <jolt/api.hpp>
+#include <jolt/memory/defs.hpp>
+#include "thread.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A fair queue-based spin lock (Mellor-Crummey and Scott).
+         *
+         * Waiters form a linked queue of nodes, each spinning on its own node. A release only
+         * touches the cache line of the next waiter, so that the cost of a hand-off doesn't grow with
+         * the number of waiters.
+         *
+         * Each acquisition needs a node, which must stay alive until the lock is released. Use
+         * `MCSLock::Guard` to keep one on the stack.
+         */
+        class MCSLock {
+          public:
+            static constexpr unsigned SPIN_COUNT = 1024; //< Number of spins before yielding.
+
+            struct alignas(memory::CACHE_LINE_SIZE) Node {
+                std::atomic<Node *> m_next; //< Next waiter.
+                std::atomic<bool> m_locked; //< True while the thread owning this node must wait.
+            };
+
+            /**
+             * A guard acquiring the lock with a node of its own upon creation and releasing it upon
+             * destruction.
+             */
+            class Guard {
+                MCSLock &m_lock; /**< Held lock */
+                Node m_node;     /**< Queue node */
+
+              public:
+                explicit JLT_INLINE Guard(MCSLock &lock) noexcept : m_lock{lock} { m_lock.acquire(m_node); }
+
+                Guard(Guard &other) = delete;
+                Guard &operator=(Guard &other) = delete;
+
+                JLT_INLINE ~Guard() noexcept { m_lock.release(m_node); }
+            };
+
+          private:
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<Node *> m_tail; //< Last waiter or owner.
+
+          public:
+            JLT_NODISCARD MCSLock() noexcept : m_tail{nullptr} {}
+
+            MCSLock(MCSLock const &) = delete;
+            MCSLock &operator=(MCSLock const &) = delete;
+
+            /**
+             * Try to acquire the lock and if it's already held, give up immediately.
+             *
+             * @param node The node of this acquisition.
+             *
+             * @return True if the lock has been acquired, false if it hasn't.
+             */
+            JLT_INLINE bool try_acquire(Node &node) noexcept {
+                Node *tail = nullptr;
+
+                node.m_next.store(nullptr, std::memory_order_relaxed);
+
+                return m_tail.compare_exchange_strong(
+                  tail, &node, std::memory_order_acquire, std::memory_order_relaxed);
+            }
+
+            /**
+             * Queue up and wait until all the threads ahead have released the lock and then acquire
+             * it.
+             *
+             * @param node The node of this acquisition.
+             */
+            JLT_INLINE void acquire(Node &node) noexcept {
+                node.m_next.store(nullptr, std::memory_order_relaxed);
+                node.m_locked.store(true, std::memory_order_relaxed);
+
+                Node *const previous = m_tail.exchange(&node, std::memory_order_acq_rel);
+
+                if(previous) {
+                    previous->m_next.store(&node, std::memory_order_release);
+
+                    // Once the owner has been running long enough, let it run, in case it's been preempted
+                    for(unsigned spins = 0; node.m_locked.load(std::memory_order_acquire); ++spins) {
+                        if(spins < SPIN_COUNT) {
+                            _mm_pause();
+                        } else {
+                            yield();
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Release the lock and hand it off to the next waiter, if any.
+             *
+             * @param node The node passed to `acquire()` or `try_acquire()`.
+             */
+            JLT_INLINE void release(Node &node) noexcept {
+                Node *next = node.m_next.load(std::memory_order_acquire);
+
+                if(!next) {
+                    Node *tail = &node;
+
+                    if(m_tail.compare_exchange_strong(
+                         tail, nullptr, std::memory_order_release, std::memory_order_relaxed)) {
+                        return;
+                    }
+
+                    // A waiter has queued up, but hasn't linked itself yet
+                    while(!(next = node.m_next.load(std::memory_order_acquire))) { _mm_pause(); }
+                }
+
+                next->m_locked.store(false, std::memory_order_release);
+            }
+
+            /**
+             * Return a value stating whether this lock has been acquired.
+             */
+            JLT_NODISCARD JLT_INLINE bool is_acquired() const noexcept {
+                return m_tail.load(std::memory_order_relaxed);
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_MCSLOCK_HPP */
@@ -0,0 +1,159 @@
+#include <jolt/debug.hpp>
+#include "rwlock.hpp"
+#include "wait.hpp"
+
+using jolt::threading::detail::wait_while_equal;
+
+namespace {
+    std::atomic<unsigned> g_next_reader_slot{0};
+
+    // Threads are spread over the slots in order of first use, so that readers seldom share one
+    thread_local unsigned t_reader_slot =
+      g_next_reader_slot.fetch_add(1, std::memory_order_relaxed) % jolt::threading::RWLock::N_READER_SLOTS;
+
+#ifndef NDEBUG
+    constexpr unsigned MAX_HELD_READ_LOCKS = 32; //< Read locks a thread can hold at once in debug builds.
+
+    thread_local jolt::threading::RWLock const *t_held_read_locks[MAX_HELD_READ_LOCKS]; //< Held for reading.
+    thread_local unsigned t_n_held_read_locks = 0; //< Number of locks held for reading by the thread.
+
+    bool is_read_held(jolt::threading::RWLock const *const lock) {
+        for(unsigned i = 0; i < t_n_held_read_locks; ++i) {
+            if(t_held_read_locks[i] == lock) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+#endif // NDEBUG
+
+    /**
+     * Assert the calling thread doesn't hold a lock for reading already.
+     */
+    void check_not_read_held(JLT_MAYBE_UNUSED jolt::threading::RWLock const *const lock) {
+#ifndef NDEBUG
+        jltassert2(!is_read_held(lock), "RWLock is not recursive");
+#endif // NDEBUG
+    }
+
+    /**
+     * Record a lock as held for reading by the calling thread, in debug builds.
+     */
+    void on_read_acquired(JLT_MAYBE_UNUSED jolt::threading::RWLock const *const lock) {
+#ifndef NDEBUG
+        jltassert2(t_n_held_read_locks < MAX_HELD_READ_LOCKS, "Too many read locks held");
+
+        t_held_read_locks[t_n_held_read_locks++] = lock;
+#endif // NDEBUG
+    }
+
+    /**
+     * Record a lock as not held for reading by the calling thread anymore, in debug builds.
+     */
+    void on_read_released(JLT_MAYBE_UNUSED jolt::threading::RWLock const *const lock) {
+#ifndef NDEBUG
+        for(unsigned i = 0; i < t_n_held_read_locks; ++i) {
+            if(t_held_read_locks[i] == lock) {
+                t_held_read_locks[i] = t_held_read_locks[--t_n_held_read_locks];
+
+                return;
+            }
+        }
+
+        jltassert2(false, "RWLock released without being held for reading");
+#endif // NDEBUG
+    }
+} // namespace
+
+namespace jolt {
+    namespace threading {
+        RWLock::RWLock() : m_readers{}, m_writer{0} {}
+
+        bool RWLock::try_acquire_read() {
+            std::atomic<uint32_t> &n_readers = m_readers[t_reader_slot].m_n_readers;
+
+            check_not_read_held(this);
+
+            // Pairs with the writer setting its flag, then reading the slots: either the writer sees
+            // this reader or this reader sees the writer.
+            n_readers.fetch_add(1, std::memory_order_seq_cst);
+
+            if(!m_writer.load(std::memory_order_seq_cst)) {
+                on_read_acquired(this);
+
+                return true;
+            }
+
+            // A writer is waiting for this slot to drain
+            if(n_readers.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+                n_readers.notify_all();
+            }
+
+            return false;
+        }
+
+        void RWLock::acquire_read() {
+            while(!try_acquire_read()) { wait_while_equal(m_writer, 1); }
+        }
+
+        void RWLock::release_read() {
+            std::atomic<uint32_t> &n_readers = m_readers[t_reader_slot].m_n_readers;
+
+            on_read_released(this);
+
+            // Only a writer ever waits for a slot to drain
+            if(n_readers.fetch_sub(1, std::memory_order_seq_cst) == 1
+               && m_writer.load(std::memory_order_seq_cst)) {
+                n_readers.notify_all();
+            }
+        }
+
+        void RWLock::wait_readers() {
+            for(ReaderSlot &slot : m_readers) {
+                for(uint32_t n_readers; (n_readers = slot.m_n_readers.load(std::memory_order_seq_cst));) {
+                    wait_while_equal(slot.m_n_readers, n_readers);
+                }
+            }
+        }
+
+        bool RWLock::try_acquire_write() {
+            uint32_t writer = 0;
+
+            check_not_read_held(this);
+
+            if(!m_writer.compare_exchange_strong(
+                 writer, 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            for(ReaderSlot &slot : m_readers) {
+                if(slot.m_n_readers.load(std::memory_order_seq_cst)) {
+                    release_write();
+
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void RWLock::acquire_write() {
+            check_not_read_held(this);
+
+            // Writers queue on the flag, then new readers queue behind the writer
+            for(uint32_t writer = 0; !m_writer.compare_exchange_weak(
+                  writer, 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                writer = 0) {
+                wait_while_equal(m_writer, 1);
+            }
+
+            wait_readers();
+        }
+
+        void RWLock::release_write() {
+            m_writer.store(0, std::memory_order_release);
+            m_writer.notify_all();
+        }
+    } // namespace threading
+} // namespace jolt
@@ -0,0 +1,120 @@
+#ifndef JLT_THREADING_RWLOCK_HPP
+#define JLT_THREADING_RWLOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include <jolt/memory/defs.hpp>
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A writer-preferring reader-writer lock, for read-mostly shared state.
+         *
+         * Readers are counted in per-thread slots, each on its own cache line, so that readers
+         * running on different cores neither serialize nor bounce a cache line between each other.
+         * A writer announces itself, which makes new readers wait, then waits for every slot to
+         * drain. Waiting threads spin briefly, then sleep.
+         *
+         * As with `Lock`, the lock must be released by the thread that acquired it, and it's not
+         * recursive, not even for reading: a thread acquiring it for reading again while a writer
+         * waits deadlocks, as the second acquisition waits for the writer, which waits for the first
+         * one to be released. Debug builds assert against recursive acquisitions.
+         *
+         * @remarks Acquiring the lock for writing scans all the reader slots: this lock is meant for
+         * state that is read much more often than it's written.
+         */
+        class JLTAPI RWLock {
+          public:
+            static constexpr size_t N_READER_SLOTS = 16; //< Number of reader slots.
+
+          private:
+            struct alignas(memory::CACHE_LINE_SIZE) ReaderSlot {
+                std::atomic<uint32_t> m_n_readers; //< Number of readers holding the lock from this slot.
+            };
+
+            ReaderSlot m_readers[N_READER_SLOTS];                            //< Reader slots.
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<uint32_t> m_writer; //< Writer presence flag.
+
+            /**
+             * Wait until no reader holds the lock. Must be called by the writer.
+             */
+            void wait_readers();
+
+          public:
+            JLT_NODISCARD RWLock();
+
+            RWLock(RWLock const &) = delete;
+            RWLock &operator=(RWLock const &) = delete;
+
+            /**
+             * Try to acquire the lock for reading and if a writer holds or awaits it, give up
+             * immediately.
+             *
+             * @return True if the lock has been acquired, false if it hasn't.
+             */
+            bool try_acquire_read();
+
+            /**
+             * Wait until no writer holds or awaits the lock and then acquire it for reading.
+             */
+            void acquire_read();
+
+            /**
+             * Release the lock held for reading.
+             */
+            void release_read();
+
+            /**
+             * Try to acquire the lock for writing and if it's already held, give up immediately.
+             *
+             * @return True if the lock has been acquired, false if it hasn't.
+             */
+            bool try_acquire_write();
+
+            /**
+             * Wait until the lock is available and then acquire it for writing.
+             */
+            void acquire_write();
+
+            /**
+             * Release the lock held for writing.
+             */
+            void release_write();
+        };
+
+        /**
+         * A guard acquiring a reader-writer lock for reading upon creation and releasing it upon
+         * destruction.
+         */
+        class ReadGuard {
+            RWLock &m_lock; /**< Held lock */
+
+          public:
+            explicit JLT_INLINE ReadGuard(RWLock &lock) noexcept : m_lock{lock} { m_lock.acquire_read(); }
+
+            ReadGuard(ReadGuard &other) = delete;
+            ReadGuard &operator=(ReadGuard &other) = delete;
+
+            JLT_INLINE ~ReadGuard() noexcept { m_lock.release_read(); }
+        };
+
+        /**
+         * A guard acquiring a reader-writer lock for writing upon creation and releasing it upon
+         * destruction.
+         */
+        class WriteGuard {
+            RWLock &m_lock; /**< Held lock */
+
+          public:
+            explicit JLT_INLINE WriteGuard(RWLock &lock) noexcept : m_lock{lock} { m_lock.acquire_write(); }
+
+            WriteGuard(WriteGuard &other) = delete;
+            WriteGuard &operator=(WriteGuard &other) = delete;
+
+            JLT_INLINE ~WriteGuard() noexcept { m_lock.release_write(); }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_RWLOCK_HPP */
@@ -0,0 +1,136 @@
+#ifndef JLT_THREADING_SEMAPHORE_HPP
+#define JLT_THREADING_SEMAPHORE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include "thread.hpp"
+#include "wait.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A counting semaphore.
+         *
+         * Acquiring the semaphore decrements its count, waiting while the count is zero. Releasing
+         * it increments the count. Waiting threads spin briefly, then sleep on the address of the
+         * count. Releasing a semaphore nobody sleeps on doesn't enter the kernel.
+         */
+        class Semaphore {
+          public:
+            static constexpr uint64_t TIMED_WAIT_SLICE_NS = 100'000; //< Sleep between timed wait polls.
+
+          private:
+            std::atomic<uint32_t> m_count;     //< Semaphore count.
+            std::atomic<uint32_t> m_n_waiters; //< Number of threads sleeping or about to sleep.
+
+          public:
+            /**
+             * Create a new instance of this class.
+             *
+             * @param count The initial count.
+             */
+            JLT_NODISCARD explicit Semaphore(uint32_t const count = 0) noexcept :
+              m_count{count}, m_n_waiters{0} {}
+
+            Semaphore(Semaphore const &) = delete;
+            Semaphore &operator=(Semaphore const &) = delete;
+
+            /**
+             * Return the current count.
+             */
+            JLT_NODISCARD uint32_t get_count() const noexcept {
+                return m_count.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * Decrement the count if it's greater than zero, without waiting.
+             *
+             * @return True if the count has been decremented, false if it was zero.
+             */
+            bool try_acquire() noexcept {
+                uint32_t count = m_count.load(std::memory_order_seq_cst);
+
+                while(count) {
+                    if(m_count.compare_exchange_weak(
+                         count, count - 1, std::memory_order_seq_cst, std::memory_order_seq_cst)) {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            /**
+             * Wait until the count is greater than zero and decrement it.
+             */
+            void acquire() noexcept {
+                while(!detail::spin_until([this] { return try_acquire(); })) {
+                    m_n_waiters.fetch_add(1, std::memory_order_seq_cst);
+
+                    bool const acquired = try_acquire();
+
+                    if(!acquired) {
+                        m_count.wait(0, std::memory_order_relaxed);
+                    }
+
+                    m_n_waiters.fetch_sub(1, std::memory_order_relaxed);
+
+                    if(acquired) {
+                        return;
+                    }
+                }
+            }
+
+            /**
+             * Wait until the count is greater than zero and decrement it, giving up after a timeout.
+             *
+             * @param timeout_ns The minimum time to wait, in ns.
+             *
+             * @return True if the count has been decremented, false if the wait timed out.
+             *
+             * @remarks Atomic waits can't time out, so the count is polled every
+             * `TIMED_WAIT_SLICE_NS` once spinning fails: a release is noticed within that delay.
+             */
+            bool try_acquire_for(uint64_t const timeout_ns) noexcept {
+                if(detail::spin_until([this] { return try_acquire(); })) {
+                    return true;
+                }
+
+                for(uint64_t waited_ns = 0; waited_ns < timeout_ns; waited_ns += TIMED_WAIT_SLICE_NS) {
+                    sleep_for(min(TIMED_WAIT_SLICE_NS, timeout_ns - waited_ns));
+
+                    if(try_acquire()) {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            /**
+             * Increment the count, releasing up to as many waiting threads.
+             *
+             * @param n The amount to increment the count by.
+             */
+            void release(uint32_t const n = 1) noexcept {
+                jltassert(n > 0);
+
+                m_count.fetch_add(n, std::memory_order_seq_cst);
+
+                // Pairs with `acquire()`: either the waiter sees the new count or this thread sees it
+                if(m_n_waiters.load(std::memory_order_seq_cst)) {
+                    if(n == 1) {
+                        m_count.notify_one();
+                    } else {
+                        m_count.notify_all();
+                    }
+                }
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_SEMAPHORE_HPP */
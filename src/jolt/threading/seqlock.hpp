@@ -0,0 +1,149 @@
+#ifndef JLT_THREADING_SEQLOCK_HPP
+#define JLT_THREADING_SEQLOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <emmintrin.h>
+#include <jolt/api.hpp>
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A sequence lock, protecting a small trivially copyable value read on hot paths.
+         *
+         * Readers never write to shared memory: they copy the value and retry if a writer modified
+         * it in the meantime. Reading costs two loads of the sequence number on top of the copy and
+         * readers never slow each other down, at the cost of retrying when writes are frequent.
+         * Writers are serialized through the sequence number.
+         *
+         * @tparam T The type of the value. Copies of a value being written may be torn and are
+         * discarded, so it must be trivially copyable.
+         */
+        template<typename T>
+        class SeqLock {
+          public:
+            using value_type = T;
+
+          private:
+            using word_type = uint64_t;
+
+            static_assert(std::is_trivially_copyable<T>::value, "SeqLock value must be trivially copyable");
+
+            static constexpr size_t N_WORDS = (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+            // The value is copied word by word with relaxed atomic accesses, so that racing readers
+            // are well-defined.
+            std::atomic<uint32_t> m_sequence;        //< Odd while a writer is modifying the value.
+            std::atomic<word_type> m_words[N_WORDS]; //< The value.
+
+            /**
+             * Wait until no writer is modifying the value and increment the sequence number.
+             *
+             * @return The sequence number before the increment.
+             */
+            uint32_t begin_write() {
+                uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+
+                while((sequence & 1)
+                      || !m_sequence.compare_exchange_weak(
+                        sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    _mm_pause();
+                    sequence = m_sequence.load(std::memory_order_relaxed);
+                }
+
+                // The value mustn't be modified before readers can see the sequence number is odd
+                std::atomic_thread_fence(std::memory_order_release);
+
+                return sequence;
+            }
+
+            void end_write(uint32_t const sequence) {
+                m_sequence.store(sequence + 2, std::memory_order_release);
+            }
+
+            void read_words(value_type &value) const {
+                word_type words[N_WORDS];
+
+                for(size_t i = 0; i < N_WORDS; ++i) { words[i] = m_words[i].load(std::memory_order_relaxed); }
+
+                memcpy(&value, words, sizeof(value_type));
+            }
+
+            void write_words(value_type const &value) {
+                word_type words[N_WORDS]{};
+
+                memcpy(words, &value, sizeof(value_type));
+
+                for(size_t i = 0; i < N_WORDS; ++i) { m_words[i].store(words[i], std::memory_order_relaxed); }
+            }
+
+          public:
+            JLT_NODISCARD explicit SeqLock(value_type const &value = value_type{}) : m_sequence{0} {
+                write_words(value);
+            }
+
+            SeqLock(SeqLock const &) = delete;
+            SeqLock &operator=(SeqLock const &) = delete;
+
+            /**
+             * Read the value.
+             *
+             * @return A consistent copy of the value.
+             */
+            JLT_NODISCARD value_type load() const {
+                value_type value;
+
+                while(true) {
+                    uint32_t const sequence = m_sequence.load(std::memory_order_acquire);
+
+                    if(sequence & 1) {
+                        _mm_pause();
+
+                        continue;
+                    }
+
+                    read_words(value);
+
+                    // The copy mustn't be reordered after the second read of the sequence number
+                    std::atomic_thread_fence(std::memory_order_acquire);
+
+                    if(m_sequence.load(std::memory_order_relaxed) == sequence) {
+                        return value;
+                    }
+                }
+            }
+
+            /**
+             * Replace the value.
+             *
+             * @param value The new value.
+             */
+            void store(value_type const &value) {
+                uint32_t const sequence = begin_write();
+
+                write_words(value);
+                end_write(sequence);
+            }
+
+            /**
+             * Modify the value, with other writers excluded.
+             *
+             * @param func A function accepting a reference to a copy of the value and modifying it.
+             */
+            template<typename F>
+            void update(F &&func) {
+                uint32_t const sequence = begin_write();
+                value_type value;
+
+                read_words(value);
+                func(value);
+                write_words(value);
+                end_write(sequence);
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_SEQLOCK_HPP */
@@ -7,6 +7,7 @@
 #include <jolt/util.hpp>
 #include <jolt/debug.hpp>
 #include "thread.hpp"
+#include "lockprofiler.hpp"
 
 namespace jolt {
     namespace threading {
@@ -14,6 +15,13 @@ namespace jolt {
          * A lock that waits by letting the processor spin - being active while performing no useful
          * work.
          *
+         * Waiters only read the lock state until it's released and back off exponentially after
+         * each failed attempt, so that they don't keep the cache line busy while the owner releases
+         * it. This lock is not fair: see `TicketLock` and `MCSLock` for fair alternatives.
+         *
+         * When lock profiling is enabled, acquisitions are recorded to the statistics of the lock
+         * site.
+         *
          * @remarks Busy-waiting can degrade performance and spin locks should not be used unless
          * the waiting time is assured to be very small.
          */
@@ -24,14 +32,33 @@ namespace jolt {
 
           private:
             volatile std::atomic<lock_state_type> m_lock;
-            volatile thread_id m_owner; /**< ID of owner thread when lock is held */
+            volatile thread_id m_owner; /**< ID of owner thread when lock is held, in debug builds */
+
+#ifdef JLT_WITH_LOCK_PROFILING
+            LockProfile m_profile; //< Profiling state.
+
+            LockProfile &get_profile() volatile noexcept { return const_cast<LockProfile &>(m_profile); }
+#endif // JLT_WITH_LOCK_PROFILING
 
           public:
             static constexpr lock_state_type ACQUIRED = true;
             static constexpr lock_state_type RELEASED = false;
+            static constexpr unsigned MAX_BACKOFF = 1024; //< Maximum number of pauses between attempts.
 
-            constexpr JLT_INLINE SpinLock() noexcept :
-              m_lock{RELEASED}, m_owner{INVALID_THREAD_ID} {}
+            /**
+             * Initialize a new instance of this class.
+             *
+             * @param site The name the lock is profiled under. Defaults to the location the lock is
+             * created at.
+             */
+            constexpr JLT_INLINE SpinLock(JLT_MAYBE_UNUSED LockSite const site = {}) noexcept :
+              m_lock{RELEASED}, m_owner{INVALID_THREAD_ID}
+#ifdef JLT_WITH_LOCK_PROFILING
+              ,
+              m_profile{site}
+#endif // JLT_WITH_LOCK_PROFILING
+            {
+            }
 
             SpinLock(const SpinLock &other) = delete;
             SpinLock(SpinLock &&other) = delete;
@@ -44,21 +71,40 @@ namespace jolt {
              *
              * @return True if the lock has been acquired, false if it hasn't.
              */
-            constexpr bool try_acquire(retry_amt_type max_retries) volatile noexcept {
+            bool try_acquire(retry_amt_type max_retries) volatile noexcept {
                 jltassert(max_retries > 0);
 
-                for(bool lock_state = RELEASED; !m_lock.compare_exchange_weak(
-                      lock_state, ACQUIRED, std::memory_order_release, std::memory_order_acquire);
-                    lock_state = RELEASED) {
-                    _mm_pause();
-                    --max_retries;
+#ifdef JLT_WITH_LOCK_PROFILING
+                uint64_t wait_begin = 0; //< Time of the first failed attempt.
+#endif // JLT_WITH_LOCK_PROFILING
 
-                    if(!max_retries) {
+                for(unsigned backoff = 1;; backoff = min(backoff * 2, MAX_BACKOFF)) {
+                    // Only attempt the exchange once the lock looks free: reading keeps the line shared
+                    if(m_lock.load(std::memory_order_relaxed) == RELEASED
+                       && m_lock.exchange(ACQUIRED, std::memory_order_acquire) == RELEASED) {
+                        break;
+                    }
+
+                    if(!--max_retries) {
                         return false;
                     }
+
+#ifdef JLT_WITH_LOCK_PROFILING
+                    if(!wait_begin) {
+                        wait_begin = LockProfile::now();
+                    }
+#endif // JLT_WITH_LOCK_PROFILING
+
+                    for(unsigned i = 0; i < backoff; ++i) { _mm_pause(); }
                 }
 
+#ifndef NDEBUG
                 m_owner = Thread::get_current().get_id();
+#endif // NDEBUG
+
+#ifdef JLT_WITH_LOCK_PROFILING
+                get_profile().on_acquired(wait_begin != 0, wait_begin);
+#endif // JLT_WITH_LOCK_PROFILING
 
                 return true;
             }
@@ -80,8 +126,15 @@ namespace jolt {
              * Release the lock.
              */
             JLT_INLINE void release() volatile noexcept {
+#ifdef JLT_WITH_LOCK_PROFILING
+                get_profile().on_released();
+#endif // JLT_WITH_LOCK_PROFILING
+
+#ifndef NDEBUG
                 jltassert(m_owner == Thread::get_current().get_id());
                 m_owner = INVALID_THREAD_ID;
+#endif // NDEBUG
+
                 m_lock.store(RELEASED, std::memory_order_release);
             }
 
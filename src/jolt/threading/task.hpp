@@ -0,0 +1,386 @@
+#ifndef JLT_THREADING_TASK_HPP
+#define JLT_THREADING_TASK_HPP
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <jolt/api.hpp>
+#include <jolt/debug.hpp>
+#include <jolt/util.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/collections/span.hpp>
+#include "jobsystem.hpp"
+
+namespace jolt {
+    namespace threading {
+        template<typename T>
+        class Task;
+
+        namespace detail {
+            /**
+             * Job resuming the coroutine whose address is passed as parameter.
+             */
+            inline void resume_coroutine(void *const address) {
+                std::coroutine_handle<>::from_address(address).resume();
+            }
+
+            struct TaskPromiseBase {
+                std::coroutine_handle<> m_continuation; //< Coroutine to resume on completion, if any.
+                JobCounter *m_counter;                  //< Counter to decrement on completion, if any.
+
+                /**
+                 * Awaiter of the final suspension point. When the task completes, it resumes the
+                 * continuation if there's one and the counter, if any, reaches zero.
+                 */
+                struct FinalAwaiter {
+                    JLT_NODISCARD bool await_ready() const noexcept { return false; }
+
+                    template<typename P>
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<P> const handle) noexcept {
+                        TaskPromiseBase &promise = handle.promise();
+
+                        // The frame may be destroyed by another thread as soon as the counter is
+                        // decremented: read the promise first.
+                        std::coroutine_handle<> const continuation = promise.m_continuation;
+                        JobCounter *const counter = promise.m_counter;
+
+                        if((counter && !counter->done()) || !continuation) {
+                            return std::noop_coroutine();
+                        }
+
+                        return continuation;
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+
+                TaskPromiseBase() : m_continuation{}, m_counter{nullptr} {}
+
+                /**
+                 * Allocate a coroutine frame from the jolt allocator.
+                 */
+                JLT_NODISCARD static void *operator new(size_t const size) {
+                    memory::flags_t const flags = memory::get_current_force_flags()
+                                                  | choose<memory::flags_t>(
+                                                    0, memory::ALLOC_BIG, size < memory::BIG_OBJECT_MIN_SIZE);
+
+                    return memory::_allocate(size, flags, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+                }
+
+                static void operator delete(void *const ptr) { memory::free(ptr); }
+
+                JLT_NODISCARD std::suspend_always initial_suspend() const noexcept { return {}; }
+                JLT_NODISCARD FinalAwaiter final_suspend() const noexcept { return {}; }
+
+                void unhandled_exception() { std::terminate(); }
+            };
+
+            template<typename T>
+            struct TaskPromise : public TaskPromiseBase {
+                union {
+                    T m_value; //< The result of the task.
+                };
+
+                bool m_has_value; //< True once `m_value` has been constructed.
+
+                TaskPromise() : m_has_value{false} {}
+
+                ~TaskPromise() {
+                    if(m_has_value) {
+                        m_value.~T();
+                    }
+                }
+
+                JLT_NODISCARD Task<T> get_return_object();
+
+                template<typename U>
+                void return_value(U &&value) {
+                    memory::construct(&m_value, std::forward<U>(value));
+                    m_has_value = true;
+                }
+
+                JLT_NODISCARD T &get_result() {
+                    jltassert2(m_has_value, "Task result requested before completion");
+
+                    return m_value;
+                }
+            };
+
+            template<>
+            struct TaskPromise<void> : public TaskPromiseBase {
+                JLT_NODISCARD Task<void> get_return_object();
+
+                void return_void() {}
+                void get_result() {}
+            };
+        } // namespace detail
+
+        /**
+         * A lazily started coroutine producing a value of type `T`.
+         *
+         * A task starts running when awaited with `co_await`, the awaiting coroutine being resumed
+         * by the task when it completes, or when started on a job system with `start()`. Awaiting
+         * `schedule()` moves the rest of the task onto a worker. Coroutine frames are allocated from
+         * the jolt allocator.
+         *
+         * @tparam T The type of the result of the task.
+         */
+        template<typename T = void>
+        class Task {
+          public:
+            using value_type = T;
+            using promise_type = detail::TaskPromise<T>;
+            using handle_type = std::coroutine_handle<promise_type>;
+
+          private:
+            handle_type m_handle; //< The coroutine.
+
+          public:
+            JLT_NODISCARD explicit Task(handle_type const handle) : m_handle{handle} {}
+            JLT_NODISCARD Task(Task &&other) : m_handle{std::exchange(other.m_handle, nullptr)} {}
+
+            Task(Task const &) = delete;
+
+            ~Task() {
+                if(m_handle) {
+                    m_handle.destroy();
+                }
+            }
+
+            Task &operator=(Task &&other) {
+                if(m_handle) {
+                    m_handle.destroy();
+                }
+
+                m_handle = std::exchange(other.m_handle, nullptr);
+
+                return *this;
+            }
+
+            Task &operator=(Task const &) = delete;
+
+            /**
+             * Start running the task on the calling thread.
+             *
+             * @param counter The counter to decrement when the task completes. It's incremented
+             * immediately.
+             * @param continuation The coroutine to resume once the task has completed and the
+             * counter has reached zero, if any.
+             */
+            void start(JobCounter &counter, std::coroutine_handle<> const continuation = nullptr) {
+                promise_type &promise = m_handle.promise();
+
+                counter.add();
+                promise.m_counter = &counter;
+                promise.m_continuation = continuation;
+
+                m_handle.resume();
+            }
+
+            /**
+             * Start running the task on a job system.
+             *
+             * @param system The job system.
+             * @param counter The counter to decrement when the task completes. It's incremented
+             * immediately.
+             * @param continuation The coroutine to resume once the task has completed and the
+             * counter has reached zero, if any.
+             */
+            void start(
+              JobSystem &system, JobCounter &counter, std::coroutine_handle<> const continuation = nullptr) {
+                promise_type &promise = m_handle.promise();
+
+                // The counter is decremented by the task itself, not by the job starting it
+                counter.add();
+                promise.m_counter = &counter;
+                promise.m_continuation = continuation;
+
+                system.run(&detail::resume_coroutine, m_handle.address());
+            }
+
+            /**
+             * Return a value stating whether the task has completed. Only meaningful once the
+             * counter passed to `start()` has reached zero.
+             */
+            JLT_NODISCARD bool is_done() const { return m_handle.done(); }
+
+            /**
+             * Return the result of the task. The task must have completed.
+             */
+            JLT_NODISCARD decltype(auto) get_result() {
+                jltassert2(m_handle.done(), "Task result requested before completion");
+
+                return m_handle.promise().get_result();
+            }
+
+            JLT_NODISCARD auto operator co_await() &&noexcept {
+                struct Awaiter {
+                    handle_type m_handle;
+
+                    JLT_NODISCARD bool await_ready() const noexcept { return false; }
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<> const awaiting) noexcept {
+                        m_handle.promise().m_continuation = awaiting;
+
+                        return m_handle;
+                    }
+
+                    value_type await_resume() {
+                        if constexpr(!std::is_void<value_type>::value) {
+                            return std::move(m_handle.promise().get_result());
+                        }
+                    }
+                };
+
+                return Awaiter{m_handle};
+            }
+        };
+
+        template<typename T>
+        Task<T> detail::TaskPromise<T>::get_return_object() {
+            return Task<T>{Task<T>::handle_type::from_promise(*this)};
+        }
+
+        inline Task<void> detail::TaskPromise<void>::get_return_object() {
+            return Task<void>{Task<void>::handle_type::from_promise(*this)};
+        }
+
+        /**
+         * Awaiter moving the awaiting coroutine onto a worker of a job system.
+         */
+        class ScheduleAwaiter {
+            JobSystem &m_system; //< The job system.
+
+          public:
+            JLT_NODISCARD explicit ScheduleAwaiter(JobSystem &system) : m_system{system} {}
+
+            JLT_NODISCARD bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> const awaiting) {
+                m_system.run(&detail::resume_coroutine, awaiting.address());
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        /**
+         * Awaiter suspending the awaiting coroutine until a condition is met. The condition is
+         * polled by the job system, which resumes the coroutine on a worker.
+         *
+         * @see JobSystem::run_when().
+         */
+        class ReadyAwaiter {
+            JobSystem &m_system;                //< The job system.
+            JobSystem::ready_func m_ready;      //< The condition.
+            void *m_param;                      //< Parameter passed to the condition.
+            std::coroutine_handle<> m_awaiting; //< The suspended coroutine.
+
+            static bool is_ready(void *const awaiter_ptr) {
+                auto const awaiter = reinterpret_cast<ReadyAwaiter *>(awaiter_ptr);
+
+                return awaiter->m_ready(awaiter->m_param);
+            }
+
+            static void resume(void *const awaiter_ptr) {
+                reinterpret_cast<ReadyAwaiter *>(awaiter_ptr)->m_awaiting.resume();
+            }
+
+          public:
+            JLT_NODISCARD
+            ReadyAwaiter(JobSystem &system, JobSystem::ready_func const ready, void *const param) :
+              m_system{system}, m_ready{ready}, m_param{param}, m_awaiting{} {}
+
+            JLT_NODISCARD bool await_ready() const { return m_ready(m_param); }
+
+            void await_suspend(std::coroutine_handle<> const awaiting) {
+                m_awaiting = awaiting;
+                m_system.run_when(&is_ready, &resume, this);
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        /**
+         * Awaiter running a group of tasks concurrently on a job system and resuming the awaiting
+         * coroutine once all of them have completed.
+         */
+        template<typename T>
+        class WhenAllAwaiter {
+            JobSystem &m_system;                //< The job system.
+            collections::Span<Task<T>> m_tasks; //< The tasks.
+            JobCounter m_counter;               //< Counter of the running tasks.
+
+          public:
+            JLT_NODISCARD WhenAllAwaiter(JobSystem &system, collections::Span<Task<T>> const tasks) :
+              m_system{system}, m_tasks{tasks}, m_counter{} {}
+
+            JLT_NODISCARD bool await_ready() const noexcept { return m_tasks.is_empty(); }
+
+            bool await_suspend(std::coroutine_handle<> const awaiting) {
+                // Hold one more count until all the tasks are started, so that the awaiting coroutine
+                // isn't resumed while this function is still running.
+                m_counter.add();
+
+                for(Task<T> &task : m_tasks) { task.start(m_system, m_counter, awaiting); }
+
+                return !m_counter.done();
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        /**
+         * Move the rest of the awaiting coroutine onto a worker.
+         *
+         * @param system The job system.
+         */
+        JLT_NODISCARD inline ScheduleAwaiter schedule(JobSystem &system) { return ScheduleAwaiter{system}; }
+
+        /**
+         * Suspend the awaiting coroutine until a condition is met.
+         *
+         * @param system The job system polling the condition and resuming the coroutine.
+         * @param ready The condition. It's called with `param` and returns true once met.
+         * @param param The parameter to pass to `ready`.
+         */
+        JLT_NODISCARD inline ReadyAwaiter
+        when_ready(JobSystem &system, JobSystem::ready_func const ready, void *const param) {
+            return ReadyAwaiter{system, ready, param};
+        }
+
+        /**
+         * Run a group of tasks concurrently and wait for all of them to complete. Their results can
+         * be read with `Task::get_result()` afterwards.
+         *
+         * @param system The job system to run the tasks on.
+         * @param tasks The tasks. They must not have been started.
+         */
+        template<typename T>
+        JLT_NODISCARD WhenAllAwaiter<T> when_all(JobSystem &system, collections::Span<Task<T>> const tasks) {
+            return WhenAllAwaiter<T>{system, tasks};
+        }
+
+        /**
+         * Run a task and wait for its completion from a thread that is not running a coroutine.
+         *
+         * @param system The job system. The calling thread runs its jobs while waiting.
+         * @param task The task.
+         *
+         * @return The result of the task.
+         */
+        template<typename T>
+        T sync_wait(JobSystem &system, Task<T> &&task) {
+            JobCounter counter;
+
+            task.start(counter);
+            system.wait(counter);
+
+            if constexpr(!std::is_void<T>::value) {
+                return std::move(task.get_result());
+            }
+        }
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_TASK_HPP */
@@ -0,0 +1,261 @@
+#include <chrono>
+#include <jolt/debug.hpp>
+#include <jolt/algorithms.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "taskgraph.hpp"
+
+namespace jolt {
+    namespace threading {
+        using clock = std::chrono::steady_clock;
+
+        TaskGraph::TaskGraph() :
+          m_nodes{}, m_edges{}, m_accesses{}, m_successors{}, m_roots{}, m_order{}, m_pending{nullptr},
+          m_system{nullptr}, m_counter{nullptr}, m_built{false} {}
+
+        TaskGraph::~TaskGraph() {
+            if(m_pending) {
+                memory::free_array(m_pending);
+            }
+        }
+
+        TaskGraph::node_id
+        TaskGraph::add_node(char const *const name, node_func const func, void *const param) {
+            jltassert(func);
+
+            m_nodes.push(Node{name, func, param, this, 0, 0, 0, 0, 0, 0});
+            m_built = false;
+
+            return static_cast<node_id>(m_nodes.get_length() - 1);
+        }
+
+        void TaskGraph::add_dependency(node_id const before, node_id const after) {
+            jltassert(before < m_nodes.get_length() && after < m_nodes.get_length());
+
+            m_edges.push(Edge{before, after});
+            m_built = false;
+        }
+
+        void TaskGraph::read(node_id const node, resource_id const resource) {
+            jltassert(node < m_nodes.get_length());
+
+            m_accesses.push(Access{node, resource, false});
+            m_built = false;
+        }
+
+        void TaskGraph::write(node_id const node, resource_id const resource) {
+            jltassert(node < m_nodes.get_length());
+
+            m_accesses.push(Access{node, resource, true});
+            m_built = false;
+        }
+
+        void TaskGraph::add_edge(node_id const before, node_id const after) {
+            if(before == after) {
+                return;
+            }
+
+            for(Edge const &edge : m_edges) {
+                if(edge.m_before == before && edge.m_after == after) {
+                    return;
+                }
+            }
+
+            m_edges.push(Edge{before, after});
+        }
+
+        void TaskGraph::add_resource_edges() {
+            // Accesses are considered in node order, whatever the order they were declared in
+            algorithms::sort(m_accesses.get_data(), m_accesses.get_length(), [](Access const &access) {
+                return access.m_node;
+            });
+
+            size_t const n_accesses = m_accesses.get_length();
+
+            for(size_t j = 0; j < n_accesses; ++j) {
+                Access const &access = m_accesses[j];
+
+                // Walk back to the last write: writes depend on the reads since, too
+                for(size_t i = j; i-- > 0;) {
+                    Access const &previous = m_accesses[i];
+
+                    if(previous.m_resource != access.m_resource || previous.m_node == access.m_node) {
+                        continue;
+                    }
+
+                    if(previous.m_write) {
+                        add_edge(previous.m_node, access.m_node);
+
+                        break;
+                    }
+
+                    if(access.m_write) {
+                        add_edge(previous.m_node, access.m_node);
+                    }
+                }
+            }
+        }
+
+        void TaskGraph::build() {
+            size_t const n_nodes = m_nodes.get_length();
+            size_t const n_explicit_edges = m_edges.get_length();
+
+            add_resource_edges();
+
+            // Successor lists, stored contiguously per node
+            for(Node &node : m_nodes) {
+                node.m_n_successors = 0;
+                node.m_n_predecessors = 0;
+            }
+
+            for(Edge const &edge : m_edges) {
+                ++m_nodes[edge.m_before].m_n_successors;
+                ++m_nodes[edge.m_after].m_n_predecessors;
+            }
+
+            uint32_t first_successor = 0;
+
+            for(Node &node : m_nodes) {
+                node.m_first_successor = first_successor;
+                first_successor += node.m_n_successors;
+                node.m_n_successors = 0;
+            }
+
+            m_successors.set_length(m_edges.get_length());
+
+            for(Edge const &edge : m_edges) {
+                Node &node = m_nodes[edge.m_before];
+
+                m_successors[node.m_first_successor + node.m_n_successors++] = edge.m_after;
+            }
+
+            // Drop the edges derived from the resources, so that they're derived again on rebuild
+            m_edges.truncate(n_explicit_edges);
+
+            // Topological order, with Kahn's algorithm
+            m_roots.clear();
+            m_order.clear();
+
+            if(m_pending) {
+                memory::free_array(m_pending);
+            }
+
+            m_pending = memory::allocate_array<std::atomic<uint32_t>>(n_nodes);
+
+            for(size_t i = 0; i < n_nodes; ++i) {
+                memory::construct(m_pending + i, m_nodes[i].m_n_predecessors);
+
+                if(!m_nodes[i].m_n_predecessors) {
+                    m_roots.push(static_cast<node_id>(i));
+                    m_order.push(static_cast<node_id>(i));
+                }
+            }
+
+            for(size_t i = 0; i < m_order.get_length(); ++i) {
+                Node const &node = m_nodes[m_order[i]];
+
+                for(uint32_t j = 0; j < node.m_n_successors; ++j) {
+                    node_id const successor = m_successors[node.m_first_successor + j];
+
+                    if(m_pending[successor].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                        m_order.push(successor);
+                    }
+                }
+            }
+
+            jltassert2(m_order.get_length() == n_nodes, "Task graph contains a cycle");
+
+            update_priorities();
+            m_built = true;
+        }
+
+        void TaskGraph::update_priorities() {
+            for(size_t i = m_order.get_length(); i-- > 0;) {
+                Node &node = m_nodes[m_order[i]];
+                uint64_t longest_successor = 0;
+
+                for(uint32_t j = 0; j < node.m_n_successors; ++j) {
+                    node_id const successor = m_successors[node.m_first_successor + j];
+
+                    longest_successor = max(longest_successor, m_nodes[successor].m_priority);
+                }
+
+                // Nodes not measured yet count as 1ns, so that their priority follows the path length
+                node.m_priority = max<uint64_t>(node.m_estimate, 1) + longest_successor;
+            }
+
+            auto const get_priority = [this](node_id const node) { return m_nodes[node].m_priority; };
+
+            for(Node &node : m_nodes) {
+                node_id *const successors = m_successors.get_data() + node.m_first_successor;
+
+                algorithms::sort(successors, node.m_n_successors, get_priority);
+            }
+
+            algorithms::sort(m_roots.get_data(), m_roots.get_length(), get_priority);
+        }
+
+        void TaskGraph::submit(node_id const *const nodes, uint32_t const n_nodes) {
+            bool const lifo = m_system->is_worker_thread();
+
+            for(uint32_t i = 0; i < n_nodes; ++i) {
+                node_id const node = nodes[lifo ? i : n_nodes - 1 - i];
+
+                if(m_pending[node].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    m_system->run(&run_node, &m_nodes[node], m_counter);
+                }
+            }
+        }
+
+        void TaskGraph::run_node(void *param) {
+            Node &node = *reinterpret_cast<Node *>(param);
+            TaskGraph &graph = *node.m_graph;
+            clock::time_point const begin = clock::now();
+
+            node.m_func(node.m_param);
+
+            node.m_duration = static_cast<uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - begin).count());
+
+            graph.submit(graph.m_successors.get_data() + node.m_first_successor, node.m_n_successors);
+        }
+
+        void TaskGraph::execute(JobSystem &system) {
+            jltassert2(m_built, "Task graph executed before being built");
+
+            JobCounter counter;
+            size_t const n_nodes = m_nodes.get_length();
+
+            m_system = &system;
+            m_counter = &counter;
+
+            // Roots get one more pending count, released by `submit()`
+            for(size_t i = 0; i < n_nodes; ++i) {
+                uint32_t const n_predecessors = m_nodes[i].m_n_predecessors;
+
+                m_pending[i].store(n_predecessors ? n_predecessors : 1, std::memory_order_relaxed);
+            }
+
+            submit(m_roots.get_data(), static_cast<uint32_t>(m_roots.get_length()));
+            system.wait(counter);
+
+            m_system = nullptr;
+            m_counter = nullptr;
+
+            // Exponential moving average, to absorb frame-to-frame noise
+            for(Node &node : m_nodes) {
+                node.m_estimate =
+                  node.m_estimate ? (node.m_estimate * 3 + node.m_duration) / 4 : node.m_duration;
+            }
+
+            update_priorities();
+        }
+
+        uint64_t TaskGraph::get_critical_path_duration() const {
+            uint64_t duration = 0;
+
+            for(node_id const root : m_roots) { duration = max(duration, m_nodes[root].m_priority); }
+
+            return duration;
+        }
+    } // namespace threading
+} // namespace jolt
@@ -0,0 +1,179 @@
+#ifndef JLT_THREADING_TASKGRAPH_HPP
+#define JLT_THREADING_TASKGRAPH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <jolt/api.hpp>
+#include <jolt/collections/vector.hpp>
+#include "jobsystem.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A graph of frame work, built once and executed in parallel on a job system every frame.
+         *
+         * Each node is a function run as a job. Nodes depend on each other either explicitly or
+         * through the resources they declare to read or write: a node reading a resource runs after
+         * the last node writing it, and a node writing a resource runs after the last node writing it
+         * and all the nodes reading it since. "Last" refers to the order nodes have been added in,
+         * so nodes must be added in the order they would run sequentially.
+         *
+         * The duration of every node is measured at each execution. When several nodes are ready,
+         * the one with the longest estimated path to the end of the graph runs first, so that the
+         * critical path is never delayed by work that could run later.
+         */
+        class JLTAPI TaskGraph {
+          public:
+            using node_id = uint32_t;
+            using resource_id = uint64_t;
+            using node_func = JobSystem::job_func;
+
+            static constexpr node_id INVALID_NODE_ID = UINT32_MAX; //< Invalid node ID.
+
+          private:
+            struct Node {
+                char const *m_name;         //< Node name.
+                node_func m_func;           //< Node entry point.
+                void *m_param;              //< Parameter passed to the entry point.
+                TaskGraph *m_graph;         //< The graph.
+                uint32_t m_first_successor; //< Index of the first successor in `m_successors`.
+                uint32_t m_n_successors;    //< Number of successors.
+                uint32_t m_n_predecessors;  //< Number of predecessors.
+                uint64_t m_duration;        //< Duration of the last execution, in ns.
+                uint64_t m_estimate;        //< Estimated duration, in ns.
+                uint64_t m_priority;        //< Estimated duration of the longest path to the end, in ns.
+            };
+
+            struct Edge {
+                node_id m_before; //< Node running first.
+                node_id m_after;  //< Node depending on `m_before`.
+            };
+
+            struct Access {
+                node_id m_node;         //< Node accessing the resource.
+                resource_id m_resource; //< The resource.
+                bool m_write;           //< True for a write access, false for a read access.
+            };
+
+            collections::Vector<Node> m_nodes;         //< Nodes, in declaration order.
+            collections::Vector<Edge> m_edges;         //< Explicit dependencies.
+            collections::Vector<Access> m_accesses;    //< Resource access declarations.
+            collections::Vector<node_id> m_successors; //< Successors of all the nodes, per node.
+            collections::Vector<node_id> m_roots;      //< Nodes without predecessors.
+            collections::Vector<node_id> m_order;      //< Nodes in topological order.
+            std::atomic<uint32_t> *m_pending;          //< Predecessors left to run, per node.
+            JobSystem *m_system;                       //< Job system executing the graph.
+            JobCounter *m_counter;                     //< Counter of the running execution.
+            bool m_built;                              //< True if the graph is ready to be executed.
+
+            static void run_node(void *param);
+
+            /**
+             * Add an edge unless it's already present or it's a loop.
+             */
+            void add_edge(node_id const before, node_id const after);
+
+            /**
+             * Derive the edges implied by the resource accesses.
+             */
+            void add_resource_edges();
+
+            /**
+             * Recompute the node priorities from their estimated durations and sort the successors of
+             * each node and the roots by ascending priority.
+             */
+            void update_priorities();
+
+            /**
+             * Submit the nodes of a list, sorted by ascending priority, so that the highest priority one
+             * runs first: in ascending order from a worker, whose deque is LIFO, and in descending order
+             * from any other thread, whose jobs go to the FIFO external queue.
+             */
+            void submit(node_id const *const nodes, uint32_t const n_nodes);
+
+          public:
+            JLT_NODISCARD TaskGraph();
+
+            TaskGraph(TaskGraph const &) = delete;
+            TaskGraph &operator=(TaskGraph const &) = delete;
+
+            ~TaskGraph();
+
+            /**
+             * Add a node.
+             *
+             * @param name The node name. It must outlive the graph.
+             * @param func The node entry point.
+             * @param param The parameter to pass to `func`.
+             *
+             * @return The ID of the new node.
+             */
+            node_id add_node(char const *const name, node_func const func, void *const param = nullptr);
+
+            /**
+             * Make a node run after another one.
+             *
+             * @param before The node running first.
+             * @param after The node running after `before` has completed.
+             */
+            void add_dependency(node_id const before, node_id const after);
+
+            /**
+             * Declare that a node reads a resource.
+             *
+             * @param node The node.
+             * @param resource An ID identifying the resource, e.g. the hash of its name or its address.
+             */
+            void read(node_id const node, resource_id const resource);
+
+            /**
+             * Declare that a node writes a resource.
+             *
+             * @param node The node.
+             * @param resource An ID identifying the resource, e.g. the hash of its name or its address.
+             */
+            void write(node_id const node, resource_id const resource);
+
+            /**
+             * Compute the dependencies and the execution order of the graph. Must be called after
+             * adding nodes, dependencies or resource accesses, before executing the graph.
+             */
+            void build();
+
+            /**
+             * Execute the graph, returning once all its nodes have completed. The calling thread runs
+             * jobs while waiting.
+             *
+             * @param system The job system to run the nodes on.
+             */
+            void execute(JobSystem &system);
+
+            JLT_NODISCARD size_t get_node_count() const { return m_nodes.get_length(); }
+
+            JLT_NODISCARD char const *get_node_name(node_id const node) const {
+                return m_nodes[node].m_name;
+            }
+
+            /**
+             * Return the duration of the last execution of a node, in nanoseconds.
+             */
+            JLT_NODISCARD uint64_t get_node_duration(node_id const node) const {
+                return m_nodes[node].m_duration;
+            }
+
+            /**
+             * Return the estimated duration of the critical path of the graph, in nanoseconds.
+             */
+            JLT_NODISCARD uint64_t get_critical_path_duration() const;
+
+            /**
+             * Return the nodes in the order of a valid sequential execution.
+             */
+            JLT_NODISCARD collections::Vector<node_id> const &get_execution_order() const {
+                return m_order;
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_TASKGRAPH_HPP */
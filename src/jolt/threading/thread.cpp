@@ -1,26 +1,67 @@
-#include <Windows.h>
+#ifdef _WIN32
+    #include <Windows.h>
+#else
+    #include <cerrno>
+    #include <cstring>
+    #include <ctime>
+    #include <sched.h>
+    #include <unistd.h>
+    #include <sys/syscall.h>
+#endif // _WIN32
+
 #include <jolt/debug.hpp>
 #include "thread.hpp"
 
 namespace {
+#ifdef _WIN32
     extern "C" DWORD WINAPI start_new_thread(LPVOID thread_ptr) {
         jolt::threading::Thread::start_new_thread(*reinterpret_cast<jolt::threading::Thread *>(thread_ptr));
 
         return (DWORD)0;
     }
+
+    jolt::threading::os_thread_id get_current_os_thread_id() { return ::GetCurrentThreadId(); }
+
+    /**
+     * A high-resolution waitable timer, closed upon thread exit. The handle is null on Windows
+     * versions lacking high-resolution timers.
+     */
+    struct SleepTimer {
+        HANDLE m_handle =
+          ::CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+        ~SleepTimer() {
+            if(m_handle) {
+                ::CloseHandle(m_handle);
+            }
+        }
+    };
+
+    thread_local SleepTimer t_sleep_timer;
+#else
+    extern "C" void *start_new_thread(void *thread_ptr) {
+        jolt::threading::Thread::start_new_thread(*reinterpret_cast<jolt::threading::Thread *>(thread_ptr));
+
+        return nullptr;
+    }
+
+    jolt::threading::os_thread_id get_current_os_thread_id() {
+        return static_cast<jolt::threading::os_thread_id>(::syscall(SYS_gettid));
+    }
+#endif // _WIN32
 } // namespace
 
 namespace jolt {
     namespace threading {
         const char *const UNNAMED_THREAD_NAME = "Unnamed thread";
 
-        static Thread g_main_thread(::GetCurrentThreadId(), ThreadState::Running, "Main");
+        static Thread g_main_thread(get_current_os_thread_id(), ThreadState::Running, "Main");
         static thread_local Thread *t_current_thread = &g_main_thread;
         volatile std::atomic<thread_id> Thread::s_next_id = 0;
 
-        Thread::Thread(thread_id os_id, ThreadState const state, const char *const thread_name) :
+        Thread::Thread(os_thread_id os_id, ThreadState const state, const char *const thread_name) :
           m_id{s_next_id++}, m_os_id{os_id}, m_name{thread_name}, m_param{nullptr}, m_state{state},
-          m_handler{nullptr} {}
+          m_handler{nullptr}, m_handle{} {}
 
         Thread &Thread::get_current() { return *t_current_thread; }
 
@@ -30,10 +71,29 @@ namespace jolt {
 
             t_current_thread = &t;
 
+#ifndef _WIN32
+            // Linux thread names are limited to 15 characters
+            char os_name[16]{};
+
+            strncpy(os_name, const_cast<char const *>(t.m_name), sizeof(os_name) - 1);
+            ::pthread_setname_np(::pthread_self(), os_name);
+
+            t.m_os_id.store(get_current_os_thread_id(), std::memory_order_release);
+#endif // _WIN32
+
             t.m_handler(const_cast<void *>(t.m_param));
             t.m_state.store(ThreadState::Terminated, std::memory_order_release);
         }
 
+        void Thread::join() {
+            while(true) {
+                if(try_join(std::numeric_limits<unsigned>::max())) {
+                    break;
+                }
+            }
+        }
+
+#ifdef _WIN32
         void Thread::start(void *param) {
             jltassert(m_state.load(std::memory_order_acquire) == ThreadState::Created);
 
@@ -43,18 +103,10 @@ namespace jolt {
 
             m_os_id.store(GetThreadId(thandle), std::memory_order_release);
 
-            m_win_handle = thandle;
+            m_handle = thandle;
             m_state.store(ThreadState::Running, std::memory_order_release);
         }
 
-        void Thread::join() {
-            while(true) {
-                if(try_join(std::numeric_limits<unsigned>::max())) {
-                    break;
-                }
-            }
-        }
-
         bool Thread::try_join(unsigned const timeout_ms) {
             thread_id tid = m_id.load(std::memory_order_acquire);
 
@@ -69,7 +121,7 @@ namespace jolt {
             jltassert(state == ThreadState::Running);
             jltassert(timeout_ms <= std::numeric_limits<DWORD>::max());
 
-            DWORD result = WaitForSingleObject(m_win_handle, (DWORD)timeout_ms);
+            DWORD result = WaitForSingleObject(m_handle, (DWORD)timeout_ms);
 
             jltassert(result == WAIT_OBJECT_0 || result == WAIT_TIMEOUT);
 
@@ -92,11 +144,67 @@ namespace jolt {
         }
 
         void Thread::set_affinity(uint64_t mask) const {
-            DWORD_PTR old_affinity_mask = SetThreadAffinityMask(m_win_handle, (DWORD_PTR)mask);
+            DWORD_PTR old_affinity_mask = SetThreadAffinityMask(m_handle, (DWORD_PTR)mask);
 
             jltassert(old_affinity_mask);
         }
 
+        CpuSet get_process_affinity() {
+            USHORT groups[CpuSet::MAX_CPUS / CpuSet::GROUP_SIZE];
+            USHORT n_groups = sizeof(groups) / sizeof(groups[0]);
+
+            BOOL result = GetProcessGroupAffinity(GetCurrentProcess(), &n_groups, groups);
+
+            jltassert(result);
+
+            // The affinity mask is only meaningful for processes confined to a single group
+            if(n_groups == 1) {
+                DWORD_PTR proc_affinity, sys_affinity;
+
+                result = GetProcessAffinityMask(GetCurrentProcess(), &proc_affinity, &sys_affinity);
+
+                jltassert(result);
+
+                return CpuSet::from_mask((uint64_t)proc_affinity, groups[0]);
+            }
+
+            CpuSet cpus;
+
+            for(USHORT i = 0; i < n_groups; ++i) {
+                DWORD const n_cpus = GetActiveProcessorCount(groups[i]);
+                uint64_t const mask = n_cpus < CpuSet::GROUP_SIZE ? ((uint64_t)1 << n_cpus) - 1 : UINT64_MAX;
+
+                cpus |= CpuSet::from_mask(mask, groups[i]);
+            }
+
+            return cpus;
+        }
+
+        static void set_thread_affinity(HANDLE const handle, CpuSet const &cpus) {
+            unsigned const first = cpus.get_first();
+
+            jltassert(first != CpuSet::INVALID_CPU);
+
+            GROUP_AFFINITY affinity{};
+
+            affinity.Group = (WORD)(first / CpuSet::GROUP_SIZE);
+            affinity.Mask = (KAFFINITY)cpus.to_mask(affinity.Group);
+
+            jltassert2(
+              CpuSet::from_mask(affinity.Mask, affinity.Group) == cpus,
+              "Thread affinity must be within a single processor group");
+
+            JLT_MAYBE_UNUSED BOOL const result = SetThreadGroupAffinity(handle, &affinity, NULL);
+
+            jltassert(result);
+        }
+
+        void Thread::set_affinity(CpuSet const &cpus) const { set_thread_affinity(m_handle, cpus); }
+
+        void set_current_thread_affinity(CpuSet const &cpus) {
+            set_thread_affinity(::GetCurrentThread(), cpus);
+        }
+
         void initialize() {}
 
         void sleep(size_t duration_ms) {
@@ -104,5 +212,153 @@ namespace jolt {
 
             ::Sleep((os_thread_id)duration_ms);
         }
+
+        void sleep_for(uint64_t const duration_ns) {
+            HANDLE const timer = t_sleep_timer.m_handle;
+
+            if(!timer) {
+                sleep(static_cast<size_t>((duration_ns + 999999) / 1000000));
+
+                return;
+            }
+
+            LARGE_INTEGER due_time;
+
+            // Negative due times are relative, in units of 100 ns
+            due_time.QuadPart = -static_cast<LONGLONG>((duration_ns + 99) / 100);
+
+            JLT_MAYBE_UNUSED BOOL const result = ::SetWaitableTimer(timer, &due_time, 0, NULL, NULL, FALSE);
+            jltassert(result);
+
+            JLT_MAYBE_UNUSED DWORD const wait_result = ::WaitForSingleObject(timer, INFINITE);
+            jltassert(wait_result == WAIT_OBJECT_0);
+        }
+
+        void yield() { ::SwitchToThread(); }
+#else
+        void Thread::start(void *param) {
+            jltassert(m_state.load(std::memory_order_acquire) == ThreadState::Created);
+
+            pthread_t thandle;
+
+            m_param = param;
+
+            // The state must be set before the thread can terminate
+            m_state.store(ThreadState::Running, std::memory_order_release);
+
+            JLT_MAYBE_UNUSED int const result =
+              ::pthread_create(&thandle, nullptr, &::start_new_thread, this);
+            jltassert(result == 0);
+
+            m_handle = thandle;
+        }
+
+        bool Thread::try_join(unsigned const timeout_ms) {
+            thread_id tid = m_id.load(std::memory_order_acquire);
+
+            jltassert(tid != get_current().get_id() && tid != INVALID_THREAD_ID);
+
+            ThreadState const state = m_state.load(std::memory_order_acquire);
+
+            jltassert(state == ThreadState::Running || state == ThreadState::Terminated);
+
+            // Unlike Windows handles, POSIX threads must be joined exactly once
+            if(!m_handle) {
+                return true;
+            }
+
+            int result;
+
+            if(timeout_ms == std::numeric_limits<unsigned>::max()) {
+                result = ::pthread_join(m_handle, nullptr);
+            } else {
+                timespec deadline;
+
+                ::clock_gettime(CLOCK_REALTIME, &deadline);
+
+                deadline.tv_sec += timeout_ms / 1000;
+                deadline.tv_nsec += static_cast<long>(timeout_ms % 1000) * 1000000;
+
+                if(deadline.tv_nsec >= 1000000000) {
+                    deadline.tv_sec += 1;
+                    deadline.tv_nsec -= 1000000000;
+                }
+
+                result = ::pthread_timedjoin_np(m_handle, nullptr, &deadline);
+            }
+
+            jltassert(result == 0 || result == ETIMEDOUT);
+
+            if(result) {
+                return false;
+            }
+
+            m_handle = {};
+
+            return true;
+        }
+
+        unsigned get_available_processor_count() {
+            return static_cast<unsigned>(::sysconf(_SC_NPROCESSORS_ONLN));
+        }
+
+        uint64_t get_process_affinity_mask() { return get_process_affinity().to_mask(); }
+
+        CpuSet get_process_affinity() {
+            cpu_set_t os_cpus;
+            CpuSet cpus;
+
+            JLT_MAYBE_UNUSED int const result = ::sched_getaffinity(0, sizeof(os_cpus), &os_cpus);
+            jltassert(result == 0);
+
+            for(unsigned i = 0; i < CpuSet::MAX_CPUS && i < CPU_SETSIZE; ++i) {
+                if(CPU_ISSET(i, &os_cpus)) {
+                    cpus.add(i);
+                }
+            }
+
+            return cpus;
+        }
+
+        void Thread::set_affinity(uint64_t mask) const { set_affinity(CpuSet::from_mask(mask)); }
+
+        static void set_thread_affinity(pthread_t const handle, CpuSet const &cpus) {
+            cpu_set_t os_cpus;
+
+            CPU_ZERO(&os_cpus);
+
+            for(unsigned i = cpus.get_first(); i < CPU_SETSIZE && i != CpuSet::INVALID_CPU;
+                i = cpus.get_next(i + 1)) {
+                CPU_SET(i, &os_cpus);
+            }
+
+            JLT_MAYBE_UNUSED int const result =
+              ::pthread_setaffinity_np(handle, sizeof(os_cpus), &os_cpus);
+            jltassert(result == 0);
+        }
+
+        void Thread::set_affinity(CpuSet const &cpus) const { set_thread_affinity(m_handle, cpus); }
+
+        void set_current_thread_affinity(CpuSet const &cpus) { set_thread_affinity(::pthread_self(), cpus); }
+
+        void initialize() {}
+
+        void sleep(size_t duration_ms) {
+            timespec duration{
+              static_cast<time_t>(duration_ms / 1000), static_cast<long>(duration_ms % 1000) * 1000000};
+
+            while(::nanosleep(&duration, &duration) && errno == EINTR) {}
+        }
+
+        void sleep_for(uint64_t const duration_ns) {
+            timespec duration{
+              static_cast<time_t>(duration_ns / 1000000000), static_cast<long>(duration_ns % 1000000000)};
+
+            // Sleep for the remaining time when interrupted by a signal
+            while(::clock_nanosleep(CLOCK_MONOTONIC, 0, &duration, &duration) == EINTR) {}
+        }
+
+        void yield() { ::sched_yield(); }
+#endif // _WIN32
     } // namespace threading
 } // namespace jolt
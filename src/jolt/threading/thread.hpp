@@ -7,14 +7,28 @@
 
 #ifdef _WIN32
     #include <Windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sys/types.h>
+#else
+    #error OS not supported
 #endif // _WIN32
 
 #include <jolt/api.hpp>
+#include "cpuset.hpp"
 
 namespace jolt {
     namespace threading {
         using thread_id = uint32_t;
+
+#ifdef _WIN32
         using os_thread_id = DWORD;
+        using os_thread_handle = HANDLE;
+#else
+        using os_thread_id = pid_t;
+        using os_thread_handle = pthread_t;
+#endif // _WIN32
+
         constexpr thread_id INVALID_THREAD_ID = std::numeric_limits<thread_id>::max();
         constexpr os_thread_id INVALID_OS_THREAD_ID = 0;
         extern JLTAPI const char *const UNNAMED_THREAD_NAME;
@@ -54,10 +68,7 @@ namespace jolt {
             volatile void *m_param;                     /**< Current param */
             volatile std::atomic<ThreadState> m_state;  /**< State of the thread object */
             volatile thread_handler_ptr m_handler;      /**< Pointer to the thread starting function */
-
-#ifdef _WIN32
-            volatile HANDLE m_win_handle; /**< Windows handle to the thread */
-#endif                                    // _WIN32
+            volatile os_thread_handle m_handle;         /**< OS handle to the thread */
 
           public:
             /**
@@ -68,13 +79,15 @@ namespace jolt {
              * @param thread_name A string containing the thread's name.
              */
             Thread(
-              thread_id os_id, ThreadState const state, const char *const thread_name = UNNAMED_THREAD_NAME);
+              os_thread_id os_id,
+              ThreadState const state,
+              const char *const thread_name = UNNAMED_THREAD_NAME);
 
             Thread(Thread &&other) :
               m_id{other.m_id.load(std::memory_order_acquire)},
               m_os_id{other.m_os_id.load(std::memory_order_acquire)}, m_name{std::move(other.m_name)},
               m_param{std::move(other.m_param)}, m_state{other.m_state.load(std::memory_order_acquire)},
-              m_handler{std::move(other.m_handler)}, m_win_handle{std::move(other.m_win_handle)} {
+              m_handler{std::move(other.m_handler)}, m_handle{std::move(other.m_handle)} {
                 other.m_id.store(INVALID_THREAD_ID, std::memory_order_release);
                 other.m_state.store(ThreadState::Invalid, std::memory_order_release);
             }
@@ -89,7 +102,7 @@ namespace jolt {
               :
               m_id{s_next_id++},
               m_os_id{INVALID_OS_THREAD_ID}, m_name{thread_name}, m_param{nullptr},
-              m_state{ThreadState::Created}, m_handler{handler}, m_win_handle{NULL} {}
+              m_state{ThreadState::Created}, m_handler{handler}, m_handle{} {}
 
             Thread(Thread &other) = delete;
             Thread &operator=(Thread &other) = delete;
@@ -104,7 +117,8 @@ namespace jolt {
             /**
              * Get the OS thread ID as assigned by the threading system.
              *
-             * @return The OS thread ID or `INVALID_OS_THREAD_ID`.
+             * @return The OS thread ID or `INVALID_OS_THREAD_ID`. On Linux, the ID is only available
+             * once the thread has begun running.
              */
             os_thread_id get_os_id() const { return m_os_id.load(std::memory_order_acquire); }
 
@@ -115,7 +129,8 @@ namespace jolt {
             ThreadState get_state() const { return m_state.load(std::memory_order_acquire); }
 
             /**
-             * Start the thread.
+             * Start the thread. On Linux, the thread name is also given to the OS thread, truncated to
+             * 15 characters, so that it shows up in tools like `perf` and `top`.
              *
              * @param param The optional parameter to pass to the newly created thread's function.
              */
@@ -140,6 +155,14 @@ namespace jolt {
              */
             void set_affinity(uint64_t mask) const;
 
+            /**
+             * Set the processors the thread may run on.
+             *
+             * @param cpus The set of processors. On Windows, all the processors must belong to the
+             * same processor group.
+             */
+            void set_affinity(CpuSet const &cpus) const;
+
             /**
              * Get the name of the thread.
              *
@@ -174,6 +197,19 @@ namespace jolt {
          */
         void JLTAPI sleep(size_t duration_ms);
 
+        /**
+         * Make the current thread sleep for a certain amount of ns. Unlike `sleep()`, the duration
+         * isn't rounded up to the scheduler tick where the OS supports high-resolution timers.
+         *
+         * @param duration_ns The minimum amount of time to wait in ns.
+         */
+        void JLTAPI sleep_for(uint64_t duration_ns);
+
+        /**
+         * Give the rest of the current time slice to another thread ready to run, if any.
+         */
+        void JLTAPI yield();
+
         /**
          * Get the number of available logical processors on the machine.
          *
@@ -187,6 +223,25 @@ namespace jolt {
          * @return The affinity mask of the currently running process.
          */
         JLTAPI uint64_t get_process_affinity_mask();
+
+        /**
+         * Get the set of processors the current process may run on.
+         *
+         * @return The set of processors. Unlike `get_process_affinity_mask()`, processors beyond the
+         * first 64 are included.
+         */
+        JLTAPI CpuSet get_process_affinity();
+
+        /**
+         * Set the processors the calling thread may run on.
+         *
+         * @param cpus The set of processors. On Windows, all the processors must belong to the
+         * same processor group.
+         *
+         * @remarks Unlike `Thread::set_affinity()`, this doesn't need the thread's handle, so a thread
+         * can pin itself before the thread that started it is done with `Thread::start()`.
+         */
+        void JLTAPI set_current_thread_affinity(CpuSet const &cpus);
     } // namespace threading
 } // namespace jolt
 
@@ -0,0 +1,92 @@
+#include <jolt/debug.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "threadpool.hpp"
+
+namespace jolt {
+    namespace threading {
+        static const char *const WORKER_THREAD_NAME = "Pool worker";
+
+        ThreadPool::ThreadPool(
+          unsigned n_threads, CpuSet const *const worker_cpus, size_t const queue_capacity) :
+          m_tasks{queue_capacity}, m_workers{nullptr}, m_threads{nullptr}, m_n_threads{n_threads},
+          m_stop{false}, m_wake_sem{0} {
+            jltassert(m_n_threads);
+
+            m_workers = memory::allocate_array<Worker>(m_n_threads);
+            m_threads = memory::allocate_array<Thread>(m_n_threads);
+
+            for(unsigned i = 0; i < m_n_threads; ++i) {
+                memory::construct(m_workers + i, Worker{this, worker_cpus ? worker_cpus[i] : CpuSet{}});
+                memory::construct(m_threads + i, &worker_main, WORKER_THREAD_NAME);
+                m_threads[i].start(m_workers + i);
+            }
+        }
+
+        ThreadPool::ThreadPool(unsigned n_threads, size_t const queue_capacity) :
+          ThreadPool{
+            n_threads ? n_threads : max(get_available_processor_count(), 2u) - 1, nullptr, queue_capacity} {}
+
+        ThreadPool::ThreadPool(collections::Vector<CpuSet> const &worker_cpus, size_t const queue_capacity) :
+          ThreadPool{
+            static_cast<unsigned>(worker_cpus.get_length()), worker_cpus.get_data(), queue_capacity} {}
+
+        ThreadPool::~ThreadPool() {
+            m_stop.store(true, std::memory_order_release);
+            m_wake_sem.release(m_n_threads);
+
+            for(unsigned i = 0; i < m_n_threads; ++i) { m_threads[i].join(); }
+
+            while(run_pending_task()) {}
+
+            memory::free_array(m_threads);
+            memory::free_array(m_workers);
+        }
+
+        void ThreadPool::worker_main(void *param) {
+            auto const &worker = *reinterpret_cast<Worker const *>(param);
+            ThreadPool &pool = *worker.m_pool;
+
+            // Pin the worker before it can touch any task or memory
+            if(!worker.m_cpus.is_empty()) {
+                set_current_thread_affinity(worker.m_cpus);
+            }
+
+            while(true) {
+                pool.m_wake_sem.acquire();
+
+                if(pool.m_stop.load(std::memory_order_acquire)) {
+                    break;
+                }
+
+                // The task may have been taken by a helping thread already
+                pool.run_pending_task();
+            }
+        }
+
+        void ThreadPool::submit(task_func const func, void *const param) {
+            if(m_tasks.push(Task{func, param})) {
+                m_wake_sem.release();
+            } else {
+                func(param);
+            }
+        }
+
+        bool ThreadPool::run_pending_task() {
+            Task task;
+
+            if(!m_tasks.pop(task)) {
+                return false;
+            }
+
+            task.m_func(task.m_param);
+
+            return true;
+        }
+
+        ThreadPool &get_default_thread_pool() {
+            static ThreadPool pool;
+
+            return pool;
+        }
+    } // namespace threading
+} // namespace jolt
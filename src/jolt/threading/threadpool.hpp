@@ -0,0 +1,117 @@
+#ifndef JLT_THREADING_THREADPOOL_HPP
+#define JLT_THREADING_THREADPOOL_HPP
+
+#include <atomic>
+#include <jolt/api.hpp>
+#include <jolt/collections/mpmcqueue.hpp>
+#include <jolt/collections/vector.hpp>
+#include "semaphore.hpp"
+#include "thread.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A fixed set of worker threads executing tasks from a shared queue.
+         *
+         * Idle workers sleep until a task is submitted. Threads waiting for some tasks to complete
+         * should help by calling `run_pending_task()` rather than blocking, so that nested waits
+         * can't starve the pool.
+         */
+        class JLTAPI ThreadPool {
+          public:
+            using task_func = void (*)(void *param);
+
+            static constexpr size_t DEFAULT_QUEUE_CAPACITY = 4096; //< The default task queue capacity.
+
+          private:
+            struct Task {
+                task_func m_func; //< Task entry point.
+                void *m_param;    //< Parameter passed to the entry point.
+            };
+
+            struct Worker {
+                ThreadPool *m_pool; //< The pool the worker belongs to.
+                CpuSet m_cpus;      //< The processors the worker is pinned to, empty if it isn't pinned.
+            };
+
+            collections::MPMCQueue<Task> m_tasks; //< Pending tasks.
+            Worker *m_workers;                    //< Start parameters of the worker threads.
+            Thread *m_threads;                    //< Worker threads.
+            unsigned const m_n_threads;           //< Number of worker threads.
+            std::atomic<bool> m_stop;             //< Set when the workers must terminate.
+            Semaphore m_wake_sem;                 //< Released once per submitted task.
+
+            /**
+             * Create a new thread pool and start its workers.
+             *
+             * @param n_threads The number of worker threads.
+             * @param worker_cpus The processors each worker is pinned to, or `nullptr` not to pin them.
+             * @param queue_capacity The maximum number of pending tasks.
+             */
+            ThreadPool(unsigned n_threads, CpuSet const *worker_cpus, size_t queue_capacity);
+
+            /**
+             * Entry point of the worker threads. Pinned workers set their own affinity before waiting
+             * for any task.
+             */
+            static void worker_main(void *param);
+
+          public:
+            /**
+             * Create a new thread pool and start its workers.
+             *
+             * @param n_threads The number of worker threads. Set to 0 to use one less than the number
+             * of available processors, leaving one for the thread submitting the work.
+             * @param queue_capacity The maximum number of pending tasks.
+             */
+            explicit ThreadPool(unsigned n_threads = 0, size_t queue_capacity = DEFAULT_QUEUE_CAPACITY);
+
+            /**
+             * Create a new thread pool and start one worker per processor set, pinned to it.
+             *
+             * @param worker_cpus The processors each worker may run on, such as those returned by
+             * `CpuTopology::get_worker_cpus()`. It must not be empty.
+             * @param queue_capacity The maximum number of pending tasks.
+             */
+            explicit ThreadPool(
+              collections::Vector<CpuSet> const &worker_cpus, size_t queue_capacity = DEFAULT_QUEUE_CAPACITY);
+
+            ThreadPool(const ThreadPool &) = delete;
+            ThreadPool &operator=(const ThreadPool &) = delete;
+
+            /**
+             * Stop and join the workers. Any task still pending is run by the calling thread.
+             */
+            ~ThreadPool();
+
+            /**
+             * Submit a task for execution on a worker thread.
+             *
+             * @param func The task entry point.
+             * @param param The parameter to pass to `func`.
+             *
+             * @remarks If the queue is full, the task is executed immediately by the calling thread.
+             */
+            void submit(task_func const func, void *const param);
+
+            /**
+             * Remove a pending task from the queue and execute it on the calling thread.
+             *
+             * @return True if a task has been executed, false if the queue was empty.
+             */
+            bool run_pending_task();
+
+            /**
+             * Return the number of worker threads.
+             */
+            JLT_NODISCARD unsigned get_thread_count() const { return m_n_threads; }
+        };
+
+        /**
+         * Return the default thread pool, creating it on first use.
+         */
+        JLTAPI ThreadPool &get_default_thread_pool();
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_THREADPOOL_HPP */
@@ -0,0 +1,97 @@
+#ifndef JLT_THREADING_TICKETLOCK_HPP
+#define JLT_THREADING_TICKETLOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <emmintrin.h>
+#include <jolt/api.hpp>
+#include <jolt/memory/defs.hpp>
+#include "thread.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * A fair spin lock, granting the lock in the order it was requested.
+         *
+         * Each thread takes a ticket and waits for it to be served. Waiters pause in proportion to
+         * the number of threads ahead of them, so that they don't read the lock state more often
+         * than it can change.
+         *
+         * @remarks All the waiters spin on the same cache line, which is invalidated on every
+         * release. With many contending cores, `MCSLock` scales better.
+         */
+        class TicketLock {
+          public:
+            using ticket_type = uint32_t;
+
+            static constexpr unsigned BACKOFF_PER_WAITER = 32; //< Pauses per thread ahead in the queue.
+            static constexpr unsigned SPIN_COUNT = 64;         //< Number of backoffs before yielding.
+
+          private:
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<ticket_type> m_next;    //< Next ticket to hand out.
+            alignas(memory::CACHE_LINE_SIZE) std::atomic<ticket_type> m_serving; //< Ticket holding the lock.
+
+          public:
+            JLT_NODISCARD TicketLock() noexcept : m_next{0}, m_serving{0} {}
+
+            TicketLock(TicketLock const &) = delete;
+            TicketLock &operator=(TicketLock const &) = delete;
+
+            /**
+             * Try to acquire the lock and if it's already held, give up immediately.
+             *
+             * @return True if the lock has been acquired, false if it hasn't.
+             */
+            JLT_INLINE bool try_acquire() noexcept {
+                ticket_type serving = m_serving.load(std::memory_order_relaxed);
+
+                return m_next.compare_exchange_strong(
+                  serving, serving + 1, std::memory_order_acquire, std::memory_order_relaxed);
+            }
+
+            /**
+             * Wait until all the threads that requested the lock earlier have released it and then
+             * acquire it.
+             */
+            JLT_INLINE void acquire() noexcept {
+                ticket_type const ticket = m_next.fetch_add(1, std::memory_order_relaxed);
+
+                for(unsigned spins = 0;; ++spins) {
+                    ticket_type const serving = m_serving.load(std::memory_order_acquire);
+
+                    if(serving == ticket) {
+                        break;
+                    }
+
+                    // Waiters ahead may have been preempted: past a while, let them run
+                    if(spins >= SPIN_COUNT) {
+                        yield();
+
+                        continue;
+                    }
+
+                    unsigned const n_pauses = (ticket - serving) * BACKOFF_PER_WAITER;
+
+                    for(unsigned i = 0; i < n_pauses; ++i) { _mm_pause(); }
+                }
+            }
+
+            /**
+             * Release the lock.
+             */
+            JLT_INLINE void release() noexcept {
+                // Only the owner writes this value
+                m_serving.store(m_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            /**
+             * Return a value stating whether this lock has been acquired.
+             */
+            JLT_NODISCARD JLT_INLINE bool is_acquired() const noexcept {
+                return m_next.load(std::memory_order_relaxed) != m_serving.load(std::memory_order_relaxed);
+            }
+        };
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_TICKETLOCK_HPP */
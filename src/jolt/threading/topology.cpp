@@ -0,0 +1,330 @@
+#ifdef _WIN32
+    #include <Windows.h>
+#else
+    #include <cstdio>
+    #include <cstdlib>
+#endif // _WIN32
+
+#include <jolt/debug.hpp>
+#include <jolt/memory/allocator.hpp>
+#include "thread.hpp"
+#include "topology.hpp"
+
+using namespace jolt;
+using namespace jolt::threading;
+
+namespace {
+    /**
+     * Leave the processors not in `cpus` out of every set and remove the sets left empty.
+     */
+    void restrict_sets(collections::Vector<CpuSet> &sets, CpuSet const &cpus) {
+        size_t n_sets = 0;
+
+        for(size_t i = 0; i < sets.get_length(); ++i) {
+            CpuSet set = sets[i];
+
+            set &= cpus;
+
+            if(!set.is_empty()) {
+                sets[n_sets++] = set;
+            }
+        }
+
+        sets.truncate(n_sets);
+    }
+
+#ifdef _WIN32
+    CpuSet from_group_affinity(GROUP_AFFINITY const &affinity) {
+        return CpuSet::from_mask((uint64_t)affinity.Mask, affinity.Group);
+    }
+#else
+    /**
+     * Read a sysfs processor list, such as "0-3,8,10-11".
+     *
+     * @param path The path of the file.
+     * @param cpus The set to add the processors to.
+     *
+     * @return True if the file has been read, false if it doesn't exist.
+     */
+    bool read_cpu_list(char const *const path, CpuSet &cpus) {
+        FILE *const f = fopen(path, "r");
+        char buffer[8192];
+
+        if(!f) {
+            return false;
+        }
+
+        bool const result = fgets(buffer, sizeof(buffer), f) != nullptr;
+
+        fclose(f);
+
+        for(char *p = buffer; result && *p >= '0' && *p <= '9';) {
+            unsigned long const first = strtoul(p, &p, 10);
+            unsigned long last = first;
+
+            if(*p == '-') {
+                last = strtoul(p + 1, &p, 10);
+            }
+
+            for(unsigned long cpu = first; cpu <= last && cpu < CpuSet::MAX_CPUS; ++cpu) {
+                cpus.add(static_cast<unsigned>(cpu));
+            }
+
+            if(*p == ',') {
+                ++p;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Read a sysfs file containing a number.
+     *
+     * @return True if the file has been read, false if it doesn't exist.
+     */
+    bool read_unsigned(char const *const path, unsigned &value) {
+        FILE *const f = fopen(path, "r");
+
+        if(!f) {
+            return false;
+        }
+
+        bool const result = fscanf(f, "%u", &value) == 1;
+
+        fclose(f);
+
+        return result;
+    }
+#endif // _WIN32
+} // namespace
+
+namespace jolt {
+    namespace threading {
+        CpuTopology::CpuTopology() : m_cpus{get_process_affinity()} {
+            query();
+            restrict_to_cpus();
+        }
+
+        CpuTopology::CpuTopology(
+          CpuSet const &cpus,
+          collections::Vector<CpuSet> const &cores,
+          collections::Vector<CpuSet> const &l3_domains,
+          collections::Vector<CpuSet> const &numa_nodes) :
+          m_cpus{cpus},
+          m_cores{cores}, m_l3_domains{l3_domains}, m_numa_nodes{numa_nodes} {
+            restrict_to_cpus();
+        }
+
+        void CpuTopology::restrict_to_cpus() {
+            CpuSet described;
+
+            restrict_sets(m_cores, m_cpus);
+            restrict_sets(m_l3_domains, m_cpus);
+            restrict_sets(m_numa_nodes, m_cpus);
+
+            for(CpuSet const &core : m_cores) { described |= core; }
+
+            // Processors not belonging to any known core are assumed to have one each
+            for(unsigned cpu = m_cpus.get_first(); cpu != CpuSet::INVALID_CPU;
+                cpu = m_cpus.get_next(cpu + 1)) {
+                if(!described.contains(cpu)) {
+                    CpuSet core;
+
+                    core.add(cpu);
+                    m_cores.push(core);
+                }
+            }
+
+            if(!m_l3_domains.get_length()) {
+                m_l3_domains.push(m_cpus);
+            }
+
+            if(!m_numa_nodes.get_length()) {
+                m_numa_nodes.push(m_cpus);
+            }
+        }
+
+        collections::Vector<CpuSet> CpuTopology::get_worker_cpus(CpuSet const &cpus, bool const smt) const {
+            collections::Vector<CpuSet> worker_cpus;
+
+            for(CpuSet const &core : m_cores) {
+                CpuSet core_cpus = core;
+
+                core_cpus &= cpus;
+
+                if(core_cpus.is_empty()) {
+                    continue;
+                }
+
+                if(!smt) {
+                    worker_cpus.push(core_cpus);
+
+                    continue;
+                }
+
+                for(unsigned cpu = core_cpus.get_first(); cpu != CpuSet::INVALID_CPU;
+                    cpu = core_cpus.get_next(cpu + 1)) {
+                    CpuSet worker;
+
+                    worker.add(cpu);
+                    worker_cpus.push(worker);
+                }
+            }
+
+            return worker_cpus;
+        }
+
+        CpuSet CpuTopology::reserve_cores(CpuSet &cpus, unsigned const n_cores) const {
+            CpuSet reserved;
+            unsigned n_reserved = 0, n_available = 0;
+
+            for(CpuSet const &core : m_cores) {
+                CpuSet core_cpus = core;
+
+                core_cpus -= cpus;
+                n_available += core_cpus.is_empty();
+            }
+
+            if(n_available <= n_cores) {
+                return reserved;
+            }
+
+            for(size_t i = m_cores.get_length(); i > 0 && n_reserved < n_cores; --i) {
+                CpuSet core_cpus = m_cores[i - 1];
+
+                core_cpus -= cpus;
+
+                if(core_cpus.is_empty()) {
+                    reserved |= m_cores[i - 1];
+                    ++n_reserved;
+                }
+            }
+
+            cpus -= reserved;
+
+            return reserved;
+        }
+
+#ifdef _WIN32
+        void CpuTopology::query() {
+            DWORD size = 0;
+
+            GetLogicalProcessorInformationEx(RelationAll, nullptr, &size);
+            jltassert(GetLastError() == ERROR_INSUFFICIENT_BUFFER);
+
+            uint8_t *const buffer = memory::allocate_array<uint8_t>(size);
+
+            JLT_MAYBE_UNUSED BOOL const result = GetLogicalProcessorInformationEx(
+              RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer), &size);
+            jltassert(result);
+
+            for(DWORD offset = 0; offset < size;) {
+                auto const &info =
+                  *reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const *>(buffer + offset);
+
+                switch(info.Relationship) {
+                    case RelationProcessorCore: {
+                        CpuSet core;
+
+                        for(WORD i = 0; i < info.Processor.GroupCount; ++i) {
+                            core |= from_group_affinity(info.Processor.GroupMask[i]);
+                        }
+
+                        m_cores.push(core);
+                        break;
+                    }
+
+                    case RelationCache:
+                        if(info.Cache.Level == 3) {
+                            m_l3_domains.push(from_group_affinity(info.Cache.GroupMask));
+                        }
+                        break;
+
+                    case RelationNumaNode:
+                        m_numa_nodes.push(from_group_affinity(info.NumaNode.GroupMask));
+                        break;
+
+                    default:
+                        break;
+                }
+
+                offset += info.Size;
+            }
+
+            memory::free_array(buffer);
+        }
+#else
+        void CpuTopology::query() {
+            constexpr size_t PATH_SIZE = 128;
+            char path[PATH_SIZE];
+            CpuSet in_core, in_l3_domain, nodes;
+
+            for(unsigned cpu = m_cpus.get_first(); cpu != CpuSet::INVALID_CPU;
+                cpu = m_cpus.get_next(cpu + 1)) {
+                if(!in_core.contains(cpu)) {
+                    CpuSet core;
+
+                    snprintf(
+                      path, PATH_SIZE, "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", cpu);
+                    read_cpu_list(path, core);
+                    core.add(cpu);
+
+                    in_core |= core;
+                    m_cores.push(core);
+                }
+
+                if(!in_l3_domain.contains(cpu)) {
+                    unsigned level;
+
+                    for(unsigned index = 0;; ++index) {
+                        snprintf(
+                          path, PATH_SIZE, "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+
+                        if(!read_unsigned(path, level)) {
+                            break;
+                        }
+
+                        if(level == 3) {
+                            CpuSet domain;
+
+                            snprintf(
+                              path,
+                              PATH_SIZE,
+                              "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list",
+                              cpu,
+                              index);
+
+                            if(read_cpu_list(path, domain)) {
+                                in_l3_domain |= domain;
+                                m_l3_domains.push(domain);
+                            }
+
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if(read_cpu_list("/sys/devices/system/node/online", nodes)) {
+                for(unsigned node = nodes.get_first(); node != CpuSet::INVALID_CPU;
+                    node = nodes.get_next(node + 1)) {
+                    CpuSet node_cpus;
+
+                    snprintf(path, PATH_SIZE, "/sys/devices/system/node/node%u/cpulist", node);
+
+                    if(read_cpu_list(path, node_cpus)) {
+                        m_numa_nodes.push(node_cpus);
+                    }
+                }
+            }
+        }
+#endif // _WIN32
+
+        CpuTopology const &get_cpu_topology() {
+            static CpuTopology topology;
+
+            return topology;
+        }
+    } // namespace threading
+} // namespace jolt
@@ -0,0 +1,120 @@
+#ifndef JLT_THREADING_TOPOLOGY_HPP
+#define JLT_THREADING_TOPOLOGY_HPP
+
+#include <jolt/api.hpp>
+#include <jolt/collections/vector.hpp>
+#include "cpuset.hpp"
+
+namespace jolt {
+    namespace threading {
+        /**
+         * The layout of the logical processors the process may run on.
+         *
+         * Processors are grouped into physical cores, whose processors are SMT siblings sharing the
+         * execution units and the private caches of the core, into L3 cache domains and into NUMA
+         * nodes. Processors the process may not run on are left out of every group.
+         */
+        class JLTAPI CpuTopology {
+            CpuSet m_cpus;                            //< Available processors.
+            collections::Vector<CpuSet> m_cores;      //< Processors of each physical core.
+            collections::Vector<CpuSet> m_l3_domains; //< Processors sharing each L3 cache.
+            collections::Vector<CpuSet> m_numa_nodes; //< Processors of each NUMA node.
+
+            /**
+             * Query the OS for the layout of all the processors.
+             */
+            void query();
+
+            /**
+             * Leave the unavailable processors out of every group and fill in the groups the OS
+             * didn't describe.
+             */
+            void restrict_to_cpus();
+
+          public:
+            /**
+             * Create a new instance of this class, describing the current machine.
+             */
+            JLT_NODISCARD CpuTopology();
+
+            /**
+             * Create a new instance of this class from a known layout.
+             *
+             * @param cpus The available processors.
+             * @param cores The processors of each physical core.
+             * @param l3_domains The processors sharing each L3 cache. If empty, all the processors are
+             * assumed to share one.
+             * @param numa_nodes The processors of each NUMA node. If empty, all the processors are
+             * assumed to belong to one.
+             */
+            JLT_NODISCARD CpuTopology(
+              CpuSet const &cpus,
+              collections::Vector<CpuSet> const &cores,
+              collections::Vector<CpuSet> const &l3_domains,
+              collections::Vector<CpuSet> const &numa_nodes);
+
+            /**
+             * Return the available processors.
+             */
+            JLT_NODISCARD CpuSet const &get_cpus() const { return m_cpus; }
+
+            /**
+             * Return the processors of each physical core.
+             */
+            JLT_NODISCARD collections::Vector<CpuSet> const &get_cores() const { return m_cores; }
+
+            /**
+             * Return the processors sharing each L3 cache.
+             */
+            JLT_NODISCARD collections::Vector<CpuSet> const &get_l3_domains() const { return m_l3_domains; }
+
+            /**
+             * Return the processors of each NUMA node.
+             */
+            JLT_NODISCARD collections::Vector<CpuSet> const &get_numa_nodes() const { return m_numa_nodes; }
+
+            /**
+             * Return the number of physical cores with at least one available processor.
+             */
+            JLT_NODISCARD unsigned get_core_count() const {
+                return static_cast<unsigned>(m_cores.get_length());
+            }
+
+            /**
+             * Return the processors a thread pool should pin its workers to.
+             *
+             * @param cpus The processors the workers may run on.
+             * @param smt If false, return one set per physical core, with the core's processors in
+             * `cpus`, so that no two workers compete for the execution units of a core. If true, return
+             * one set per processor in `cpus`.
+             *
+             * @return The processor sets, one per worker.
+             */
+            JLT_NODISCARD collections::Vector<CpuSet>
+            get_worker_cpus(CpuSet const &cpus, bool const smt = false) const;
+
+            /**
+             * Reserve whole physical cores for latency-critical threads, such as the render or audio
+             * threads, and remove them from a set of processors.
+             *
+             * Only cores whose processors are all in `cpus` are reserved, starting from the last one, as
+             * the OS usually services interrupts on the first processors. At least one core is left in
+             * `cpus`.
+             *
+             * @param cpus The processors to reserve the cores from.
+             * @param n_cores The number of cores to reserve.
+             *
+             * @return The processors of the reserved cores, or an empty set if there are not enough cores
+             * to reserve, in which case `cpus` is left untouched.
+             */
+            CpuSet reserve_cores(CpuSet &cpus, unsigned const n_cores) const;
+        };
+
+        /**
+         * Return the layout of the processors of the current machine, querying it on first use.
+         */
+        JLTAPI CpuTopology const &get_cpu_topology();
+    } // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_TOPOLOGY_HPP */
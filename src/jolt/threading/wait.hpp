@@ -0,0 +1,51 @@
+#ifndef JLT_THREADING_WAIT_HPP
+#define JLT_THREADING_WAIT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <emmintrin.h>
+#include <jolt/api.hpp>
+
+namespace jolt {
+    namespace threading {
+        namespace detail {
+            constexpr unsigned WAIT_SPIN_COUNT = 128; //< Number of spins before sleeping.
+
+            /**
+             * Spin for a short while until a condition is met.
+             *
+             * @param ready A function returning true once the condition is met.
+             *
+             * @return True if the condition has been met, false if the caller should sleep.
+             */
+            template<typename F>
+            JLT_INLINE bool spin_until(F &&ready) {
+                for(unsigned i = 0; i < WAIT_SPIN_COUNT; ++i) {
+                    if(ready()) {
+                        return true;
+                    }
+
+                    _mm_pause();
+                }
+
+                return false;
+            }
+
+            /**
+             * Wait until an atomic value differs from `value`, spinning first, then sleeping on the
+             * address of the value.
+             */
+            inline void wait_while_equal(std::atomic<uint32_t> &atomic, uint32_t const value) {
+                auto const changed = [&atomic, value] {
+                    return atomic.load(std::memory_order_acquire) != value;
+                };
+
+                if(!spin_until(changed)) {
+                    atomic.wait(value, std::memory_order_acquire);
+                }
+            }
+        } // namespace detail
+    }     // namespace threading
+} // namespace jolt
+
+#endif /* JLT_THREADING_WAIT_HPP */
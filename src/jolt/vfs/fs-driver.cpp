@@ -1,6 +1,7 @@
 #include <cstdlib>
 #include <jolt/memory/allocator.hpp>
-#include <jolt/collections/linkedlist.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/deque.hpp>
 #include <jolt/io/stream.hpp>
 #include "fs-driver.hpp"
 
@@ -35,11 +36,12 @@ namespace jolt {
         FSDriver::file_name_vec FSDriver::list_impl(path::Path const &path, bool const recurse) const {
             WIN32_FIND_DATAA find_data;
             file_name_vec result{256};
-            collections::LinkedList<Path> folders{virtual_to_actual(path)};
+            collections::Deque<Path> folders; // Folders to visit
 
-            while(folders.get_first_node()) {
-                decltype(folders)::Node *const cur_node = folders.get_first_node();
-                Path const cur_dir = cur_node->get_value();
+            folders.push_back(virtual_to_actual(path));
+
+            while(folders.get_length()) {
+                Path const cur_dir = folders.pop_front();
                 Path const pattern = cur_dir + "/*";
 
                 HANDLE h_find = FindFirstFileA(reinterpret_cast<const char *>(pattern.get_raw()), &find_data);
@@ -54,7 +56,7 @@ namespace jolt {
                         result.push(vpath);
 
                         if(find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY && recurse) {
-                            folders.add(file_path);
+                            folders.push_back(file_path);
                         }
                     }
                 } while(FindNextFileA(h_find, &find_data));
@@ -62,7 +64,6 @@ namespace jolt {
                 jltassert2(GetLastError() == ERROR_NO_MORE_FILES, "Error returned by FindNextFile()");
 
                 FindClose(h_find);
-                folders.remove(*cur_node);
             }
 
             return result;
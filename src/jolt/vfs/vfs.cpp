@@ -63,9 +63,15 @@ namespace jolt {
         }
 
         Driver *VirtualFileSystem::get_path_driver(Path const &path) const {
-            for(auto const &[key, value] : m_mounts) {
-                if(path.starts_with(key)) {
-                    return value;
+            // Any mount point that is a prefix of `path` is ordered before or at `path`, and a longer
+            // prefix is ordered after a shorter one: walking backwards yields the longest match first.
+            auto const it_begin = m_mounts.begin();
+
+            for(auto it = m_mounts.upper_bound(path); it != it_begin;) {
+                --it;
+
+                if(path.starts_with((*it).get_key())) {
+                    return (*it).get_value();
                 }
             }
 
@@ -2,10 +2,9 @@
 #define JLT_VFS_VFS_HPP
 
 #include <jolt/util.hpp>
-#include <jolt/hash.hpp>
 #include <jolt/path.hpp>
 #include <jolt/text/string.hpp>
-#include <jolt/collections/hashmap.hpp>
+#include <jolt/collections/flatmap.hpp>
 #include "driver.hpp"
 #include "fs-driver.hpp"
 
@@ -16,8 +15,7 @@ namespace jolt {
          */
         class JLTAPI VirtualFileSystem {
           public:
-            using mp_table =
-              collections::HashMap<path::Path, Driver *, hash::ObjectHash<>>; //< Mount point table.
+            using mp_table = collections::FlatMap<path::Path, Driver *>; //< Mount point table, sorted by path.
 
           private:
             mp_table m_mounts; //< Table of active mount points.
@@ -26,6 +24,9 @@ namespace jolt {
             jolt::vfs::FSDriver *m_driver_build; //< The default-mounted /build driver.
 #endif
 
+            /**
+             * Return the driver of the most specific mount point containing a path.
+             */
             Driver *get_path_driver(path::Path const &path) const;
 
           public:
@@ -9,7 +9,7 @@ SETUP { initialize(); }
 
 CLEANUP { shutdown(); }
 
-TEST(quicksort) {
+TEST(sort) {
     const int input[] = {1, -2, -3, 4, 4, 5, 0, 1, 2, 0};
     size_t constexpr input_len = sizeof(input) / sizeof(int);
     int const expected_output[input_len] = {-3, -2, 0, 0, 1, 1, 2, 4, 4, 5};
@@ -17,7 +17,7 @@ TEST(quicksort) {
 
     memcpy(actual_output, input, sizeof(input));
 
-    quicksort(actual_output, input_len, [](int x) { return x; });
+    sort(actual_output, input_len, [](int x) { return x; });
 
     for(size_t i = 0; i < input_len; ++i) { assert(actual_output[i] == expected_output[i]); }
 }
@@ -30,7 +30,7 @@ TEST(sort__2) {
 
     memcpy(actual_output, input, sizeof(input));
 
-    quicksort(actual_output, input_len, [](int x) { return x; });
+    sort(actual_output, input_len, [](int x) { return x; });
 
     for(size_t i = 0; i < input_len; ++i) { assert(actual_output[i] == expected_output[i]); }
 }
@@ -42,7 +42,7 @@ TEST(sort__same_value) {
 
     memcpy(actual_output, input, sizeof(input));
 
-    quicksort(actual_output, input_len, [](int x) { return x; });
+    sort(actual_output, input_len, [](int x) { return x; });
 
     for(size_t i = 0; i < input_len; ++i) { assert(actual_output[i] == input[i]); }
 }
@@ -54,7 +54,7 @@ TEST(sort__already_sorted) {
 
     memcpy(actual_output, input, sizeof(input));
 
-    quicksort(actual_output, input_len, [](int x) { return x; });
+    sort(actual_output, input_len, [](int x) { return x; });
 
     for(size_t i = 0; i < input_len; ++i) { assert(actual_output[i] == input[i]); }
 }
@@ -67,7 +67,7 @@ TEST(sort__reversed) {
 
     memcpy(actual_output, input, sizeof(input));
 
-    quicksort(actual_output, input_len, [](int x) { return x; });
+    sort(actual_output, input_len, [](int x) { return x; });
 
     for(size_t i = 0; i < input_len; ++i) { assert(actual_output[i] == expected_output[i]); }
 }
@@ -84,7 +84,137 @@ TEST(sort__struct) {
 
     memcpy(actual_output, input, sizeof(input));
 
-    quicksort(actual_output, input_len, [](SortStruct const &x) { return x.a; });
+    sort(actual_output, input_len, [](SortStruct const &x) { return x.a; });
 
     for(size_t i = 0; i < input_len; ++i) { assert(actual_output[i].a == expected_output[i].a); }
 }
+
+/**
+ * Fill an array with pseudo-random values from a linear congruential generator.
+ */
+static void fill_random(int *const arr, size_t const len, int const mod) {
+    uint32_t state = 12345;
+
+    for(size_t i = 0; i < len; ++i) {
+        state = state * 1664525u + 1013904223u;
+        arr[i] = static_cast<int>(state >> 8) % mod - mod / 2;
+    }
+}
+
+static bool is_sorted(int const *const arr, size_t const len) {
+    for(size_t i = 1; i < len; ++i) {
+        if(arr[i - 1] > arr[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST(sort__large_distributions) {
+    constexpr size_t len = 20000;
+    int *const arr = memory::allocate_array<int>(len);
+    auto const key = [](int x) { return x; };
+
+    // Random
+    fill_random(arr, len, 1 << 30);
+    sort(arr, len, key);
+    assert2(is_sorted(arr, len), "Random");
+
+    // Few unique values
+    fill_random(arr, len, 4);
+    sort(arr, len, key);
+    assert2(is_sorted(arr, len), "Few unique");
+
+    // Descending
+    for(size_t i = 0; i < len; ++i) { arr[i] = static_cast<int>(len - i); }
+    sort(arr, len, key);
+    assert2(is_sorted(arr, len), "Descending");
+
+    // Organ pipe
+    for(size_t i = 0; i < len; ++i) { arr[i] = static_cast<int>(min(i, len - i)); }
+    sort(arr, len, key);
+    assert2(is_sorted(arr, len), "Organ pipe");
+
+    memory::free_array(arr);
+}
+
+TEST(sort__non_trivial) {
+    text::String arr[] = {"d", "b", "a", "c", "b"};
+
+    sort(arr, 5, [](text::String const &s) -> text::String const & { return s; });
+
+    assert(arr[0] == "a");
+    assert(arr[1] == "b");
+    assert(arr[2] == "b");
+    assert(arr[3] == "c");
+    assert(arr[4] == "d");
+}
+
+TEST(radix_sort__int) {
+    constexpr size_t len = 5000;
+    int *const arr = memory::allocate_array<int>(len);
+
+    fill_random(arr, len, 1 << 30);
+    radix_sort(arr, len, [](int x) { return x; });
+    assert(is_sorted(arr, len));
+
+    memory::free_array(arr);
+}
+
+TEST(radix_sort__float) {
+    constexpr size_t len = 1000;
+    float *const arr = memory::allocate_array<float>(len);
+    int *const src = memory::allocate_array<int>(len);
+
+    fill_random(src, len, 1 << 20);
+
+    for(size_t i = 0; i < len; ++i) { arr[i] = static_cast<float>(src[i]) * 0.25f; }
+
+    radix_sort(arr, len, [](float x) { return x; });
+
+    for(size_t i = 1; i < len; ++i) { assert(arr[i - 1] <= arr[i]); }
+
+    memory::free_array(src);
+    memory::free_array(arr);
+}
+
+TEST(radix_sort__stable) {
+    struct Item {
+        uint16_t key;
+        uint32_t order;
+    };
+
+    constexpr size_t len = 1000;
+    Item *const arr = memory::allocate_array<Item>(len);
+
+    for(size_t i = 0; i < len; ++i) { arr[i] = {static_cast<uint16_t>((i * 7) % 10), static_cast<uint32_t>(i)}; }
+
+    radix_sort(arr, len, [](Item const &x) { return x.key; });
+
+    for(size_t i = 1; i < len; ++i) {
+        assert(arr[i - 1].key <= arr[i].key);
+        assert(arr[i - 1].key < arr[i].key || arr[i - 1].order < arr[i].order);
+    }
+
+    memory::free_array(arr);
+}
+
+TEST(radix_sort__stable_short) {
+    struct Item {
+        uint16_t key;
+        uint32_t order;
+    };
+
+    constexpr size_t len = 40; // Below the radix sort threshold
+    Item arr[len];
+
+    for(size_t i = 0; i < len; ++i) { arr[i] = {static_cast<uint16_t>((i * 7) % 3), static_cast<uint32_t>(i)}; }
+
+    radix_sort(arr, len, [](Item const &x) { return x.key; });
+
+    for(size_t i = 1; i < len; ++i) {
+        assert(arr[i - 1].key <= arr[i].key);
+        assert(arr[i - 1].key < arr[i].key || arr[i - 1].order < arr[i].order);
+    }
+}
@@ -0,0 +1,191 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/threadpool.hpp>
+#include <jolt/text/string.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/array.hpp>
+#include <jolt/parallel-algorithms.hpp>
+
+using namespace jolt;
+using namespace jolt::algorithms;
+
+size_t mem_begin;
+
+constexpr size_t N_ITEMS = 300000;
+
+struct Rng {
+    uint64_t m_state = 0x9E3779B97F4A7C15ull;
+
+    uint32_t next() {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+
+        return static_cast<uint32_t>(m_state >> 32);
+    }
+};
+
+SETUP {
+    threading::initialize();
+
+    // The default pool lives until exit
+    threading::get_default_thread_pool();
+
+    mem_begin = memory::get_allocated_size();
+}
+
+TEST(thread_pool__submit) {
+    constexpr int n_tasks = 1000;
+    std::atomic<int> counter{0};
+
+    {
+        threading::ThreadPool pool{3, 64};
+
+        for(int i = 0; i < n_tasks; ++i) {
+            pool.submit(
+              [](void *p) { reinterpret_cast<std::atomic<int> *>(p)->fetch_add(1); }, &counter);
+        }
+    }
+
+    assert(counter.load() == n_tasks);
+}
+
+TEST(parallel_for) {
+    uint8_t *const visited = memory::allocate_array<uint8_t>(N_ITEMS);
+
+    memset(visited, 0, N_ITEMS);
+
+    parallel_for(N_ITEMS, [visited](size_t const begin, size_t const end) {
+        for(size_t i = begin; i < end; ++i) { ++visited[i]; }
+    });
+
+    for(size_t i = 0; i < N_ITEMS; ++i) { assert(visited[i] == 1); }
+
+    memory::free_array(visited);
+}
+
+TEST(parallel_for__empty) {
+    bool called = false;
+
+    parallel_for(0, [&called](size_t, size_t) { called = true; });
+
+    assert(!called);
+}
+
+TEST(parallel_for_each) {
+    collections::Vector<int> v;
+
+    for(int i = 0; i < static_cast<int>(N_ITEMS); ++i) { v.push(i); }
+
+    parallel_for_each(v, [](int &x) { x *= 2; });
+
+    for(int i = 0; i < static_cast<int>(N_ITEMS); ++i) { assert(v[i] == i * 2); }
+}
+
+TEST(parallel_transform) {
+    collections::Array<int> in{N_ITEMS};
+    collections::Array<int64_t> out{N_ITEMS};
+
+    for(size_t i = 0; i < N_ITEMS; ++i) { in[i] = static_cast<int>(i); }
+
+    parallel_transform(in, out, [](int const x) { return static_cast<int64_t>(x) * x; });
+
+    for(size_t i = 0; i < N_ITEMS; ++i) {
+        int64_t const x = static_cast<int64_t>(i);
+
+        assert(out[i] == x * x);
+    }
+}
+
+TEST(parallel_reduce) {
+    uint32_t *const arr = memory::allocate_array<uint32_t>(N_ITEMS);
+
+    for(size_t i = 0; i < N_ITEMS; ++i) { arr[i] = static_cast<uint32_t>(i); }
+
+    uint64_t const sum = parallel_reduce(
+      arr,
+      N_ITEMS,
+      static_cast<uint64_t>(0),
+      [](uint32_t const x) { return static_cast<uint64_t>(x); },
+      [](uint64_t const a, uint64_t const b) { return a + b; });
+
+    assert(sum == static_cast<uint64_t>(N_ITEMS) * (N_ITEMS - 1) / 2);
+
+    memory::free_array(arr);
+}
+
+TEST(parallel_reduce__ordered) {
+    // Non-commutative: concatenation must preserve the chunk order
+    constexpr size_t len = 1000;
+    char *const arr = memory::allocate_array<char>(len);
+
+    for(size_t i = 0; i < len; ++i) { arr[i] = 'a' + i % 26; }
+
+    text::String const result = parallel_reduce(
+      arr,
+      len,
+      text::String{},
+      [](char const c) { return text::String{&c, 1}; },
+      [](text::String const &a, text::String const &b) { return a + b; },
+      16);
+
+    assert(result.get_length() == len);
+
+    for(size_t i = 0; i < len; ++i) { assert(result.get_raw()[i] == arr[i]); }
+
+    memory::free_array(arr);
+}
+
+TEST(parallel_sort) {
+    uint32_t *const arr = memory::allocate_array<uint32_t>(N_ITEMS);
+    uint64_t expected_sum = 0, actual_sum = 0;
+    Rng rng;
+
+    for(size_t i = 0; i < N_ITEMS; ++i) {
+        arr[i] = rng.next();
+        expected_sum += arr[i];
+    }
+
+    parallel_sort(arr, N_ITEMS, [](uint32_t const x) { return x; });
+
+    for(size_t i = 0; i < N_ITEMS; ++i) { actual_sum += arr[i]; }
+    for(size_t i = 1; i < N_ITEMS; ++i) { assert(arr[i - 1] <= arr[i]); }
+
+    assert(actual_sum == expected_sum);
+
+    memory::free_array(arr);
+}
+
+TEST(parallel_sort__few_unique) {
+    collections::Vector<int> v;
+    Rng rng;
+
+    for(size_t i = 0; i < N_ITEMS; ++i) { v.push(rng.next() % 4); }
+
+    parallel_sort(v, [](int const x) { return x; });
+
+    for(size_t i = 1; i < N_ITEMS; ++i) { assert(v[i - 1] <= v[i]); }
+}
+
+TEST(parallel_sort__non_trivial) {
+    constexpr size_t len = 100000;
+    collections::Vector<text::String> v;
+    Rng rng;
+
+    for(size_t i = 0; i < len; ++i) {
+        char buf[6];
+        uint32_t x = rng.next();
+
+        for(int d = 5; d >= 0; --d, x /= 10) { buf[d] = '0' + x % 10; }
+
+        v.push(text::String{buf, 6});
+    }
+
+    parallel_sort(v, [](text::String const &s) -> text::String const & { return s; });
+
+    for(size_t i = 1; i < len; ++i) { assert(!(v[i] < v[i - 1])); }
+}
+
+TEST(memory_leaks) { assert(memory::get_allocated_size() == mem_begin); }
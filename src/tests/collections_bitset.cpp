@@ -0,0 +1,238 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/bitset.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(ctor) {
+    BitSet a{100}, b{100, true};
+
+    assert(a.get_length() == 100);
+    assert(a.none());
+    assert(b.count() == 100);
+    assert(b.get(99));
+}
+
+TEST(set__reset__flip) {
+    BitSet s{200};
+
+    s.set(0);
+    s.set(64);
+    s.set(199);
+    s.set(5, true);
+    s.reset(64);
+    s.flip(6);
+
+    assert(s.get(0));
+    assert(!s.get(64));
+    assert(s[199]);
+    assert(s[5]);
+    assert(s[6]);
+    assert(s.count() == 4);
+}
+
+TEST(set_range) {
+    BitSet s{300};
+
+    s.set_range(3, 5, true);
+    s.set_range(60, 260, true);
+
+    assert(s.count() == 202);
+    assert(!s[2] && s[3] && s[4] && !s[5]);
+    assert(!s[59] && s[60] && s[259] && !s[260]);
+
+    s.set_range(64, 256, false);
+
+    assert(s.count() == 10);
+}
+
+TEST(set_length) {
+    BitSet s{10};
+
+    s.set_length(300, true);
+
+    assert(s.count() == 290);
+    assert(!s[9] && s[10]);
+
+    s.set_length(20);
+
+    assert(s.count() == 10);
+
+    s.set_length(300);
+
+    assert(s.count() == 10);
+}
+
+TEST(find_first) {
+    BitSet s{500};
+
+    assert(s.find_first_set() == BitSet::NOT_FOUND);
+    assert(s.find_first_unset(499) == 499);
+
+    s.set(70);
+    s.set(300);
+
+    assert(s.find_first_set() == 70);
+    assert(s.find_first_set(70) == 70);
+    assert(s.find_first_set(71) == 300);
+    assert(s.find_first_set(301) == BitSet::NOT_FOUND);
+
+    s.set_all();
+    s.reset(450);
+
+    assert(s.find_first_unset() == 450);
+    assert(s.find_first_unset(451) == BitSet::NOT_FOUND);
+}
+
+TEST(find_unset_run) {
+    BitSet s{256, true};
+
+    s.set_range(10, 13, false);
+    s.set_range(100, 140, false);
+
+    assert(s.find_unset_run(3) == 10);
+    assert(s.find_unset_run(4) == 100);
+    assert(s.find_unset_run(40) == 100);
+    assert(s.find_unset_run(41) == BitSet::NOT_FOUND);
+}
+
+TEST(for_each_run) {
+    BitSet s{200};
+    size_t n_runs = 0, n_bits = 0;
+    bool ok = true;
+
+    s.set_range(0, 2, true);
+    s.set_range(63, 130, true);
+    s.set(199);
+
+    s.for_each_run([&n_runs, &n_bits, &ok](size_t const begin, size_t const end) {
+        ok &= begin < end;
+        n_bits += end - begin;
+        ++n_runs;
+    });
+
+    assert(ok);
+    assert(n_runs == 3);
+    assert(n_bits == s.count());
+}
+
+TEST(for_each_set) {
+    BitSet s{1000};
+    size_t sum = 0;
+
+    s.set(1);
+    s.set(500);
+    s.set(999);
+
+    s.for_each_set([&sum](size_t const bit) { sum += bit; });
+
+    assert(sum == 1500);
+}
+
+TEST(set_operations) {
+    BitSet a{600}, b{600};
+
+    a.set_range(0, 400, true);
+    b.set_range(200, 600, true);
+
+    BitSet c{a}, d{a}, e{a};
+
+    c &= b;
+    d |= b;
+    e ^= b;
+    a.and_not(b);
+
+    assert(c.count() == 200 && c.find_first_set() == 200);
+    assert(d.count() == 600);
+    assert(e.count() == 400 && !e[200] && e[400]);
+    assert(a.count() == 200 && a.find_first_unset() == 200);
+}
+
+TEST(set_operations__reference) {
+    constexpr size_t LENGTH = 1000; // Not a multiple of the block size
+    BitSet a{LENGTH}, b{LENGTH};
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    for(size_t i = 0; i < LENGTH; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+
+        a.set(i, (state >> 33) & 1);
+        b.set(i, (state >> 34) & 1);
+    }
+
+    BitSet c{a}, d{a}, e{a}, f{a};
+
+    c &= b;
+    d |= b;
+    e ^= b;
+    f.and_not(b);
+
+    // Checked bit by bit against the scalar operations
+    for(size_t i = 0; i < LENGTH; ++i) {
+        assert(c[i] == (a[i] && b[i]));
+        assert(d[i] == (a[i] || b[i]));
+        assert(e[i] == (a[i] != b[i]));
+        assert(f[i] == (a[i] && !b[i]));
+    }
+
+    size_t const n_different = e.count();
+
+    // Bits past the length must stay clear
+    e.flip_all();
+
+    assert(e.count() == LENGTH - n_different);
+}
+
+TEST(flip_all) {
+    BitSet s{70};
+
+    s.set(3);
+    s.flip_all();
+
+    assert(s.count() == 69);
+    assert(!s[3]);
+}
+
+TEST(copy__move) {
+    BitSet a{100};
+
+    a.set(42);
+
+    BitSet b{a};
+    BitSet c{std::move(b)};
+    BitSet d;
+
+    d = c;
+
+    assert(b.get_length() == 0);
+    assert(c == a);
+    assert(d == a);
+
+    d.reset(42);
+
+    assert(d != a);
+}
+
+TEST(alloc_flags) {
+    push_force_flags(ALLOC_PERSIST);
+    BitSet s{100};
+    pop_force_flags();
+
+    s.set_length(1000);
+
+    auto const words = const_cast<BitSet::word_type *>(s.get_words());
+
+    assert((get_alloc_flags(reinterpret_cast<size_t *>(words) - 1) & ALLOC_PERSIST) == ALLOC_PERSIST);
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
@@ -0,0 +1,151 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/text/string.hpp>
+#include <jolt/collections/btreemap.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+using namespace jolt::text;
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+// Deterministic permutation of [0, n) for a prime `n`
+static int permute(int const i, int const n) { return static_cast<int>((i * 7919LL) % n); }
+
+static String make_key(int const i) {
+    char buf[] = "key000";
+
+    buf[3] += i / 100;
+    buf[4] += i / 10 % 10;
+    buf[5] += i % 10;
+
+    return String{buf, sizeof(buf) - 1};
+}
+
+TEST(add__get_value) {
+    BTreeMap<int, int> m;
+
+    m.add(3, 30);
+    m.add(1, 10);
+    m.add(2, 20);
+
+    assert(m.get_length() == 3);
+    assert(*m.get_value(1) == 10);
+    assert(*m.get_value(2) == 20);
+    assert(*m.get_value(3) == 30);
+    assert(m.get_value(4) == nullptr);
+    assert(m.get_value_with_default(4, 40) == 40);
+
+    m.set_value(2, 21);
+
+    assert(m.get_length() == 3);
+    assert(*m.get_value(2) == 21);
+}
+
+TEST(add__many) {
+    BTreeMap<int, int> m;
+    constexpr int n = 10007;
+
+    for(int i = 0; i < n; ++i) {
+        int const k = permute(i, n);
+
+        m.add(k, k * 2);
+    }
+
+    assert(m.get_length() == n);
+
+    for(int i = 0; i < n; ++i) { assert(*m.get_value(i) == i * 2); }
+
+    int expected = 0;
+
+    for(auto const entry : m) {
+        assert(entry.get_key() == expected);
+        assert(entry.get_value() == expected * 2);
+
+        ++expected;
+    }
+
+    assert(expected == n);
+}
+
+TEST(remove__many) {
+    BTreeMap<int, int> m;
+    constexpr int n = 10007;
+
+    for(int i = 0; i < n; ++i) { m.add(i, i); }
+
+    // Remove odd keys in scrambled order
+    for(int i = 0; i < n; ++i) {
+        int const k = permute(i, n);
+
+        if(k & 1) {
+            assert(m.remove(k));
+        }
+    }
+
+    assert(!m.remove(1));
+    assert(m.get_length() == (n + 1) / 2);
+
+    int expected = 0;
+
+    for(auto const entry : m) {
+        assert(entry.get_key() == expected);
+
+        expected += 2;
+    }
+
+    for(int i = 0; i < n; i += 2) { assert(m.remove(i)); }
+
+    assert(m.get_length() == 0);
+    assert(m.begin() == m.end());
+
+    m.add(1, 1);
+
+    assert(*m.get_value(1) == 1);
+}
+
+TEST(lower_bound__upper_bound__range) {
+    BTreeMap<int, int> m;
+
+    for(int i = 0; i < 1000; i += 2) { m.add(i, i); }
+
+    assert(m.lower_bound(500).get_key() == 500);
+    assert(m.lower_bound(501).get_key() == 502);
+    assert(m.upper_bound(500).get_key() == 502);
+    assert(m.lower_bound(999) == m.end());
+
+    int expected = 100, count = 0;
+
+    for(auto const entry : m.range(100, 200)) {
+        assert(entry.get_key() == expected);
+
+        expected += 2;
+        ++count;
+    }
+
+    assert(count == 50);
+}
+
+TEST(string_keys) {
+    BTreeMap<String, int> m;
+
+    for(int i = 0; i < 200; ++i) { m.add(make_key(i), i); }
+    for(int i = 0; i < 200; i += 3) { m.remove(make_key(i)); }
+
+    BTreeMap<String, int> m2 = m;
+
+    assert(m2.get_length() == m.get_length());
+    assert(*m2.get_value("key001") == 1);
+    assert(!m2.contains_key("key000"));
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -0,0 +1,204 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/concurrenthashmap.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+using namespace jolt::collections;
+
+using map_type = ConcurrentHashMap<int, int, jolt::hash::Identity>;
+
+size_t mem_begin;
+
+constexpr int N_THREADS = 4;
+constexpr int N_KEYS = 5000; // Per writer
+
+struct test_data {
+    map_type map{4, 4};
+    std::atomic<int> n_writers_done{0};
+    std::atomic<int> n_bad_reads{0};
+    std::atomic<int> next_id{0};
+};
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(ctor) {
+    map_type m{10};
+
+    assert(m.get_stripe_count() == 16);
+    assert(m.get_length() == 0);
+    assert(map_type::LOCK_FREE_READS);
+}
+
+TEST(set_value__get_value) {
+    map_type m;
+    int value;
+
+    for(int i = 0; i < 1000; ++i) { m.set_value(i, i * 2); }
+
+    assert(m.get_length() == 1000);
+
+    for(int i = 0; i < 1000; ++i) {
+        assert(m.get_value(i, value));
+        assert(value == i * 2);
+    }
+
+    assert(!m.get_value(1000, value));
+    assert(m.get_value_with_default(1000, -1) == -1);
+
+    m.set_value(10, 0);
+
+    assert(m.get_value_with_default(10, -1) == 0);
+    assert(m.get_length() == 1000);
+}
+
+TEST(add_if_absent) {
+    map_type m;
+
+    assert(m.add_if_absent(1, 1));
+    assert(!m.add_if_absent(1, 2));
+    assert(m.get_value_with_default(1, 0) == 1);
+}
+
+TEST(remove) {
+    map_type m{1, 4};
+
+    for(int i = 0; i < 100; ++i) { m.add(i, i); }
+    for(int i = 0; i < 100; i += 2) { assert(m.remove(i)); }
+
+    assert(!m.remove(0));
+    assert(m.get_length() == 50);
+
+    for(int i = 0; i < 100; ++i) { assert(m.contains_key(i) == static_cast<bool>(i % 2)); }
+
+    // Slots freed by removals are reused
+    for(int i = 0; i < 100; i += 2) { m.add(i, -i); }
+
+    assert(m.get_length() == 100);
+    assert(m.get_value_with_default(42, 0) == -42);
+}
+
+TEST(update__for_each) {
+    map_type m;
+    long long sum = 0;
+
+    for(int i = 0; i < 100; ++i) { m.add(i, i); }
+
+    assert(m.update(5, [](int &v) { v += 1000; }));
+    assert(!m.update(500, [](int &v) { v += 1000; }));
+
+    m.for_each([&sum](int const, int const v) { sum += v; });
+
+    assert(sum == 99 * 100 / 2 + 1000);
+
+    m.clear();
+
+    assert(m.get_length() == 0);
+    assert(!m.contains_key(5));
+}
+
+TEST(non_trivial) {
+    ConcurrentHashMap<int, Vector<int>, jolt::hash::Identity> m{2, 4};
+    Vector<int> v;
+
+    assert(!decltype(m)::LOCK_FREE_READS);
+
+    for(int i = 0; i < 100; ++i) {
+        Vector<int> item;
+
+        item.push(i);
+        m.set_value(i, item);
+    }
+
+    m.remove(3);
+
+    assert(m.get_value(50, v));
+    assert(v[0] == 50);
+    assert(!m.contains_key(3));
+}
+
+TEST(add__remove__bounded_memory) {
+    map_type m{1, 16};
+
+    // Every few iterations, tombstones force the table to be rebuilt and the old one retired
+    for(int i = 0; i < 100; ++i) {
+        m.set_value(i, i);
+        m.remove(i);
+    }
+
+    size_t const mem_size = get_allocated_size();
+
+    for(int i = 100; i < 100000; ++i) {
+        m.set_value(i, i);
+        m.remove(i);
+    }
+
+    assert(get_allocated_size() == mem_size);
+    assert(m.get_length() == 0);
+}
+
+void writer_handler(void *param) noexcept {
+    auto &tdata = *reinterpret_cast<test_data *>(param);
+    int const base = tdata.next_id++ * N_KEYS;
+
+    for(int i = 0; i < N_KEYS; ++i) { tdata.map.set_value(base + i, (base + i) * 3); }
+
+    ++tdata.n_writers_done;
+}
+
+void reader_handler(void *param) noexcept {
+    auto &tdata = *reinterpret_cast<test_data *>(param);
+    int value;
+
+    while(tdata.n_writers_done.load() < N_THREADS) {
+        for(int key = 0; key < N_THREADS * N_KEYS; key += 7) {
+            if(tdata.map.get_value(key, value) && value != key * 3) {
+                ++tdata.n_bad_reads;
+            }
+        }
+    }
+}
+
+TEST(concurrent_read_write) {
+    test_data tdata;
+    Thread *writers[N_THREADS];
+    Thread *readers[N_THREADS];
+    int value;
+
+    for(int i = 0; i < N_THREADS; ++i) {
+        writers[i] = jltnew(Thread, &writer_handler);
+        readers[i] = jltnew(Thread, &reader_handler);
+
+        writers[i]->start(&tdata);
+        readers[i]->start(&tdata);
+    }
+
+    for(int i = 0; i < N_THREADS; ++i) {
+        writers[i]->join();
+        readers[i]->join();
+
+        jltfree(writers[i]);
+        jltfree(readers[i]);
+    }
+
+    assert2(tdata.n_bad_reads.load() == 0, "Torn or stale read");
+    assert(tdata.map.get_length() == N_THREADS * N_KEYS);
+
+    for(int key = 0; key < N_THREADS * N_KEYS; ++key) {
+        assert(tdata.map.get_value(key, value));
+        assert(value == key * 3);
+    }
+
+    tdata.map.reclaim();
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
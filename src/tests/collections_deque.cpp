@@ -0,0 +1,178 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/deque.hpp>
+#include <jolt/collections/vector.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(ctor) {
+    Deque<int> d{100};
+
+    assert(d.get_length() == 0);
+    assert(d.get_capacity() == 128);
+}
+
+TEST(push_back__pop_front) {
+    Deque<int> d{4};
+
+    for(int i = 0; i < 100; ++i) { d.push_back(i); }
+
+    assert(d.get_length() == 100);
+
+    for(int i = 0; i < 100; ++i) { assert(d.pop_front() == i); }
+
+    assert(d.get_length() == 0);
+}
+
+TEST(push_front__pop_back) {
+    Deque<int> d{4};
+
+    for(int i = 0; i < 100; ++i) { d.push_front(i); }
+
+    for(int i = 0; i < 100; ++i) { assert(d.pop_back() == i); }
+}
+
+TEST(index__wrap_around) {
+    Deque<int> d{8};
+
+    for(int i = 0; i < 6; ++i) { d.push_back(i); }
+    for(int i = 0; i < 4; ++i) { (void)d.pop_front(); }
+    for(int i = 6; i < 12; ++i) { d.push_back(i); }
+
+    assert(d.get_capacity() == 8);
+    assert(d.get_length() == 8);
+    assert(d.get_first() == 4);
+    assert(d.get_last() == 11);
+
+    for(size_t i = 0; i < d.get_length(); ++i) { assert(d[i] == static_cast<int>(i) + 4); }
+
+    d.push_back(12); // Grow while wrapped
+
+    assert(d.get_capacity() == 16);
+
+    for(size_t i = 0; i < d.get_length(); ++i) { assert(d[i] == static_cast<int>(i) + 4); }
+}
+
+TEST(iterator) {
+    Deque<int> d;
+    int expected = 0;
+
+    d.push_back(1);
+    d.push_back(2);
+    d.push_front(0);
+
+    for(int const x : d) { assert(x == expected++); }
+
+    assert(expected == 3);
+}
+
+TEST(non_trivial) {
+    Deque<Vector<int>> d{2};
+
+    for(int i = 0; i < 20; ++i) {
+        Vector<int> v;
+
+        v.push(i);
+
+        if(i % 2) {
+            d.push_back(std::move(v));
+        } else {
+            d.push_front(std::move(v));
+        }
+    }
+
+    assert(d.get_length() == 20);
+    assert(d.get_first()[0] == 18);
+    assert(d.get_last()[0] == 19);
+
+    Vector<int> const v = d.pop_front();
+
+    assert(v[0] == 18);
+}
+
+TEST(copy__move) {
+    Deque<Vector<int>> d;
+
+    for(int i = 0; i < 10; ++i) {
+        Vector<int> v;
+
+        v.push(i);
+        d.push_front(v);
+    }
+
+    Deque<Vector<int>> d2{d};
+    Deque<Vector<int>> d3{std::move(d2)};
+    Deque<Vector<int>> d4;
+
+    d4 = d3;
+    d2.push_back(Vector<int>{});
+
+    assert(d2.get_length() == 1);
+    assert(d3.get_length() == 10);
+    assert(d4.get_length() == 10);
+    assert(d4[0][0] == 9);
+    assert(d4[9][0] == 0);
+}
+
+/**
+ * Return the allocation flags of the ring buffer of a deque whose head is at its first position.
+ */
+flags_t get_storage_flags(Deque<int> &d) { return get_alloc_flags(reinterpret_cast<size_t *>(&d[0]) - 1); }
+
+TEST(copy__alloc_flags) {
+    push_force_flags(ALLOC_PERSIST);
+    Deque<int> d;
+    pop_force_flags();
+
+    d.push_back(1);
+
+    Deque<int> d2{d};
+
+    assert((get_storage_flags(d2) & ALLOC_PERSIST) == ALLOC_PERSIST);
+
+    d2.reserve_capacity(100);
+
+    assert((get_storage_flags(d2) & ALLOC_PERSIST) == ALLOC_PERSIST);
+}
+
+TEST(emplace__self_reference) {
+    Deque<Vector<int>> d;
+
+    for(int i = 0; i < 16; ++i) {
+        Vector<int> v;
+
+        v.push(i);
+        d.push_back(v);
+    }
+
+    size_t const capacity = d.get_capacity();
+
+    while(d.get_length() < capacity) {
+        d.push_back(d.get_last());
+    }
+
+    d.push_back(d[0]);
+    assert(d.get_capacity() > capacity);
+    assert(d.get_last()[0] == 0);
+
+    while(d.get_length() < d.get_capacity()) {
+        d.push_front(d.get_first());
+    }
+
+    d.push_front(d.get_last());
+    assert(d.get_first()[0] == 0);
+    assert(d.get_last()[0] == 0);
+    assert(d[1][0] == 0);
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
@@ -0,0 +1,125 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/text/string.hpp>
+#include <jolt/collections/flatmap.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+using namespace jolt::text;
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(add__get_value) {
+    FlatMap<int, int> m;
+
+    m.add(3, 30);
+    m.add(1, 10);
+    m.add(2, 20);
+
+    assert(m.get_length() == 3);
+    assert(*m.get_value(1) == 10);
+    assert(*m.get_value(2) == 20);
+    assert(*m.get_value(3) == 30);
+    assert(m.get_value(4) == nullptr);
+    assert(m.get_value_with_default(4, 40) == 40);
+}
+
+TEST(set_value__overwrite) {
+    FlatMap<int, int> m;
+
+    m.add(1, 10);
+    m.set_value(1, 11);
+
+    assert(m.get_length() == 1);
+    assert(*m.get_value(1) == 11);
+}
+
+TEST(ordering) {
+    FlatMap<int, int> m;
+    int const keys[] = {5, 2, 8, 1, 9, 3, 7, 4, 6, 0};
+
+    for(int const k : keys) { m.add(k, k * 10); }
+
+    int expected = 0;
+
+    for(auto const &pair : m) {
+        assert(pair.get_key() == expected);
+        assert(pair.get_value() == expected * 10);
+
+        ++expected;
+    }
+
+    assert(expected == 10);
+}
+
+TEST(ordering__greater) {
+    FlatMap<int, int, Greater> m;
+
+    for(int i = 0; i < 10; ++i) { m.add(i, i); }
+
+    int expected = 9;
+
+    for(auto const &pair : m) { assert(pair.get_key() == expected--); }
+}
+
+TEST(remove) {
+    FlatMap<int, int> m;
+
+    for(int i = 0; i < 10; ++i) { m.add(i, i); }
+
+    m.remove(0);
+    m.remove(5);
+    m.remove(9);
+    m.remove(42);
+
+    assert(m.get_length() == 7);
+    assert(!m.contains_key(0));
+    assert(!m.contains_key(5));
+    assert(!m.contains_key(9));
+
+    int last = -1;
+
+    for(auto const &pair : m) {
+        assert(pair.get_key() > last);
+
+        last = pair.get_key();
+    }
+}
+
+TEST(lower_bound__upper_bound) {
+    FlatMap<int, int> m;
+
+    for(int i = 0; i < 10; i += 2) { m.add(i, i); }
+
+    assert((*m.lower_bound(4)).get_key() == 4);
+    assert((*m.lower_bound(5)).get_key() == 6);
+    assert((*m.upper_bound(4)).get_key() == 6);
+    assert(m.lower_bound(9) == m.end());
+    assert(m.upper_bound(-1) == m.begin());
+}
+
+TEST(string_keys) {
+    FlatMap<String, String> m;
+
+    m.add("/data", "data");
+    m.add("/build", "build");
+    m.add("/cache", "cache");
+    m.remove("/cache");
+
+    FlatMap<String, String> m2 = m;
+
+    assert(m2.get_length() == 2);
+    assert(*m2.get_value("/build") == "build");
+    assert((*m2.begin()).get_key() == "/build");
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -0,0 +1,132 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/intrusivelist.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+struct Item {
+    int value;
+    IntrusiveListHook<Item> hook_a;
+    IntrusiveListHook<Item> hook_b;
+
+    Item(int v) : value{v} {}
+};
+
+using list_a = IntrusiveList<Item, &Item::hook_a>;
+using list_b = IntrusiveList<Item, &Item::hook_b>;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(push_back__push_front) {
+    Item i1{1}, i2{2}, i3{3};
+    list_a lst;
+
+    lst.push_back(i2);
+    lst.push_back(i3);
+    lst.push_front(i1);
+
+    assert(lst.get_length() == 3);
+    assert(lst.get_first() == &i1);
+    assert(lst.get_last() == &i3);
+    assert(list_a::get_next(i1) == &i2);
+    assert(list_a::get_previous(i3) == &i2);
+    assert(list_a::get_previous(i1) == nullptr);
+}
+
+TEST(add_after) {
+    Item i1{1}, i2{2}, i3{3};
+    list_a lst;
+
+    lst.push_back(i1);
+    lst.push_back(i3);
+    lst.add_after(i2, &i1);
+
+    int expected = 1;
+
+    for(Item &item : lst) { assert(item.value == expected++); }
+
+    assert(expected == 4);
+}
+
+TEST(remove) {
+    Item i1{1}, i2{2}, i3{3};
+    list_a lst;
+
+    lst.push_back(i1);
+    lst.push_back(i2);
+    lst.push_back(i3);
+
+    lst.remove(i2);
+
+    assert(lst.get_length() == 2);
+    assert(!lst.contains(i2));
+    assert(list_a::get_next(i1) == &i3);
+    assert(list_a::get_previous(i3) == &i1);
+
+    lst.remove(i1);
+    lst.remove(i3);
+
+    assert(lst.get_length() == 0);
+    assert(lst.get_first() == nullptr);
+    assert(lst.get_last() == nullptr);
+
+    // Removed items can be linked again
+    lst.push_back(i2);
+
+    assert(lst.get_first() == &i2);
+}
+
+TEST(pop) {
+    Item i1{1}, i2{2};
+    list_a lst;
+
+    lst.push_back(i1);
+    lst.push_back(i2);
+
+    assert(lst.pop_back() == &i2);
+    assert(lst.pop_front() == &i1);
+    assert(lst.pop_front() == nullptr);
+}
+
+TEST(multiple_hooks) {
+    Item i1{1}, i2{2};
+    list_a a;
+    list_b b;
+
+    a.push_back(i1);
+    a.push_back(i2);
+    b.push_back(i2);
+    b.push_back(i1);
+
+    assert(a.get_first() == &i1);
+    assert(b.get_first() == &i2);
+
+    a.remove(i1);
+
+    assert(b.contains(i1));
+    assert(b.get_length() == 2);
+
+    b.clear();
+}
+
+TEST(move) {
+    Item i1{1};
+    list_a lst;
+
+    lst.push_back(i1);
+
+    list_a lst2{std::move(lst)};
+
+    assert(lst.get_length() == 0);
+    assert(lst2.get_first() == &i1);
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
@@ -0,0 +1,128 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/lrucache.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+using cache_type = LruCache<int, int, LruCacheUnitSize, jolt::hash::Identity>;
+
+struct VectorByteSize {
+    size_t operator()(int const, Vector<int> const &v) const { return v.get_length() * sizeof(int); }
+};
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(put__get) {
+    cache_type c{100};
+
+    for(int i = 0; i < 50; ++i) { c.put(i, i * 2); }
+
+    assert(c.get_length() == 50);
+    assert(c.get_used_size() == 50);
+
+    for(int i = 0; i < 50; ++i) { assert(*c.get(i) == i * 2); }
+
+    assert(c.get(50) == nullptr);
+
+    c.put(3, 0);
+
+    assert(*c.peek(3) == 0);
+    assert(c.get_length() == 50);
+}
+
+TEST(evict_lru) {
+    cache_type c{3};
+
+    c.put(1, 1);
+    c.put(2, 2);
+    c.put(3, 3);
+    (void)c.get(1); // 2 is now the least recently used
+    c.put(4, 4);
+
+    assert(c.get_length() == 3);
+    assert(!c.contains(2));
+    assert(c.contains(1) && c.contains(3) && c.contains(4));
+
+    (void)c.peek(3); // Doesn't change the order
+    c.put(5, 5);
+
+    assert(!c.contains(3));
+}
+
+struct EvictionLog {
+    int n_evicted = 0;
+    int last_key = -1;
+};
+
+void on_evict(int const &key, int &, void *user_data) {
+    auto &log = *reinterpret_cast<EvictionLog *>(user_data);
+
+    ++log.n_evicted;
+    log.last_key = key;
+}
+
+TEST(eviction_callback) {
+    cache_type c{10};
+    EvictionLog log;
+
+    c.set_eviction_callback(&on_evict, &log);
+
+    for(int i = 0; i < 20; ++i) { c.put(i, i); }
+
+    assert(log.n_evicted == 10);
+    assert(log.last_key == 9);
+
+    c.remove(19);
+    c.clear();
+
+    assert(log.n_evicted == 10);
+}
+
+TEST(set_budget) {
+    cache_type c{10};
+
+    for(int i = 0; i < 10; ++i) { c.put(i, i); }
+
+    c.set_budget(4);
+
+    assert(c.get_length() == 4);
+    assert(c.contains(9) && c.contains(6) && !c.contains(5));
+}
+
+TEST(remove) {
+    cache_type c{1000};
+
+    for(int i = 0; i < 500; ++i) { c.put(i, i); }
+    for(int i = 0; i < 500; i += 3) { assert(c.remove(i)); }
+
+    assert(!c.remove(0));
+
+    for(int i = 0; i < 500; ++i) { assert(c.contains(i) == static_cast<bool>(i % 3)); }
+}
+
+TEST(byte_budget) {
+    LruCache<int, Vector<int>, VectorByteSize, jolt::hash::Identity> c{100 * sizeof(int)};
+
+    for(int i = 0; i < 10; ++i) {
+        Vector<int> v;
+
+        for(int j = 0; j < 30; ++j) { v.push(j); }
+
+        c.put(i, std::move(v));
+    }
+
+    assert(c.get_length() == 3);
+    assert(c.get_used_size() == 90 * sizeof(int));
+    assert((*c.get(9))[29] == 29);
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
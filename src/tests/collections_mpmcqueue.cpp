@@ -0,0 +1,113 @@
+#include <atomic>
+#include <emmintrin.h>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/mpmcqueue.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+constexpr int N_THREADS = 4;
+constexpr int N_ITEMS = 25000; // Per producer
+
+struct TestStruct {
+    int value = 0;
+
+    TestStruct() {}
+    TestStruct(int v) : value{v} {}
+    ~TestStruct() {}
+};
+
+struct test_data {
+    MPMCQueue<int> q{256};
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+};
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(ctor) {
+    MPMCQueue<int> q{100};
+
+    assert(q.get_capacity() == 128);
+    assert(q.is_empty());
+}
+
+TEST(push__pop) {
+    MPMCQueue<TestStruct> q{8};
+    TestStruct x;
+
+    for(int i = 0; i < 8; ++i) { assert(q.push(TestStruct{i})); }
+
+    assert2(!q.push(TestStruct{8}), "Pushed to a full queue");
+    assert(q.get_length() == 8);
+
+    for(int i = 0; i < 8; ++i) {
+        assert(q.pop(x));
+        assert(x.value == i);
+    }
+
+    assert2(!q.pop(x), "Popped from an empty queue");
+}
+
+void producer_handler(void *param) noexcept {
+    auto &tdata = *reinterpret_cast<test_data *>(param);
+
+    for(int i = 1; i <= N_ITEMS; ++i) {
+        while(!tdata.q.push(i)) { _mm_pause(); }
+    }
+}
+
+void consumer_handler(void *param) noexcept {
+    auto &tdata = *reinterpret_cast<test_data *>(param);
+    int x;
+
+    while(tdata.consumed.load() < N_THREADS * N_ITEMS) {
+        if(tdata.q.pop(x)) {
+            tdata.sum += x;
+            ++tdata.consumed;
+        } else {
+            _mm_pause();
+        }
+    }
+}
+
+TEST(push__pop_mt) {
+    test_data tdata;
+    Thread *producers[N_THREADS];
+    Thread *consumers[N_THREADS];
+
+    for(int i = 0; i < N_THREADS; ++i) {
+        producers[i] = jltnew(Thread, &producer_handler);
+        consumers[i] = jltnew(Thread, &consumer_handler);
+
+        producers[i]->start(&tdata);
+        consumers[i]->start(&tdata);
+    }
+
+    for(int i = 0; i < N_THREADS; ++i) {
+        producers[i]->join();
+        consumers[i]->join();
+
+        jltfree(producers[i]);
+        jltfree(consumers[i]);
+    }
+
+    long long const expected_sum = static_cast<long long>(N_ITEMS) * (N_ITEMS + 1) / 2 * N_THREADS;
+
+    assert(tdata.consumed.load() == N_THREADS * N_ITEMS);
+    assert2(tdata.sum.load() == expected_sum, "Items lost or duplicated");
+    assert(tdata.q.is_empty());
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
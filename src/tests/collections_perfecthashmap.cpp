@@ -0,0 +1,89 @@
+#include <string_view>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/perfecthashmap.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+enum class Color { Red, Green, Blue, Yellow };
+
+constexpr auto g_colors = make_perfect_hash_map<std::string_view, Color>(
+  {{"red", Color::Red}, {"green", Color::Green}, {"blue", Color::Blue}, {"yellow", Color::Yellow}});
+
+constexpr auto g_primes = make_perfect_hash_map<int, int>(
+  {{2, 0}, {3, 1}, {5, 2}, {7, 3}, {11, 4}, {13, 5}, {17, 6}, {19, 7}, {23, 8}, {29, 9}, {31, 10}});
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(string_keys) {
+    assert(*g_colors.get_value("red") == Color::Red);
+    assert(*g_colors.get_value("green") == Color::Green);
+    assert(*g_colors.get_value("blue") == Color::Blue);
+    assert(*g_colors.get_value("yellow") == Color::Yellow);
+    assert(g_colors.get_value("purple") == nullptr);
+    assert(g_colors.get_value("") == nullptr);
+    assert(g_colors.get_value_with_default("cyan", Color::Red) == Color::Red);
+}
+
+TEST(integer_keys) {
+    int n_found = 0;
+
+    for(int i = 0; i < 100; ++i) {
+        int const *const index = g_primes.get_value(i);
+
+        if(index) {
+            assert(g_primes.contains_key(i));
+            ++n_found;
+        }
+    }
+
+    assert(n_found == 11);
+    assert(*g_primes.get_value(29) == 9);
+}
+
+TEST(compile_time_lookup) {
+    static_assert(*g_colors.get_value("blue") == Color::Blue);
+    static_assert(!g_primes.contains_key(4));
+    static_assert(g_primes.get_length() == 11);
+    static_assert(g_primes.get_capacity() >= 11);
+
+    constexpr PerfectHashMap<int, int, 0> empty;
+
+    static_assert(!empty.contains_key(0));
+}
+
+TEST(large) {
+    constexpr auto map = make_perfect_hash_map<std::string_view, int>(
+      {{"VK_KHR_surface", 0},
+       {"VK_KHR_win32_surface", 1},
+       {"VK_KHR_xlib_surface", 2},
+       {"VK_KHR_xcb_surface", 3},
+       {"VK_KHR_wayland_surface", 4},
+       {"VK_KHR_swapchain", 5},
+       {"VK_EXT_debug_utils", 6},
+       {"VK_EXT_debug_report", 7},
+       {"VK_KHR_maintenance1", 8},
+       {"VK_KHR_maintenance2", 9},
+       {"VK_KHR_maintenance3", 10},
+       {"VK_KHR_dynamic_rendering", 11},
+       {"VK_KHR_synchronization2", 12},
+       {"VK_EXT_descriptor_indexing", 13},
+       {"VK_KHR_timeline_semaphore", 14},
+       {"VK_LAYER_KHRONOS_validation", 15}});
+
+    assert(*map.get_value("VK_KHR_swapchain") == 5);
+    assert(*map.get_value("VK_LAYER_KHRONOS_validation") == 15);
+    assert(!map.contains_key("VK_KHR_maintenance4"));
+
+    static_assert(*map.get_value("VK_EXT_debug_utils") == 6);
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
@@ -0,0 +1,103 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/slotmap.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+struct TestStruct {
+    int value = 0;
+
+    TestStruct(int v) : value{v} {}
+    ~TestStruct() {}
+};
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(insert__get) {
+    SlotMap<int> m;
+
+    SlotMapHandle const h1 = m.insert(10);
+    SlotMapHandle const h2 = m.insert(20);
+
+    assert(m.get_length() == 2);
+    assert(*m.get(h1) == 10);
+    assert(*m.get(h2) == 20);
+    assert(m.get(INVALID_SLOT_MAP_HANDLE) == nullptr);
+}
+
+TEST(erase) {
+    SlotMap<TestStruct> m;
+
+    SlotMapHandle const h1 = m.insert(1);
+    SlotMapHandle const h2 = m.insert(2);
+    SlotMapHandle const h3 = m.insert(3);
+
+    assert(m.erase(h1));
+    assert2(!m.erase(h1), "Erased twice");
+
+    assert(m.get_length() == 2);
+    assert(!m.contains(h1));
+    assert2(m.get(h2)->value == 2, "Handle broken by relocation");
+    assert2(m.get(h3)->value == 3, "Handle broken by relocation");
+}
+
+TEST(stale_handle) {
+    SlotMap<int> m;
+
+    SlotMapHandle const h1 = m.insert(1);
+    m.erase(h1);
+    SlotMapHandle const h2 = m.insert(2);
+
+    assert2(h2.m_index == h1.m_index, "Slot not reused");
+    assert2(m.get(h1) == nullptr, "Stale handle resolved");
+    assert(*m.get(h2) == 2);
+}
+
+TEST(null_handle) {
+    SlotMap<int> m;
+
+    m.insert(1);
+
+    assert2(m.get(SlotMapHandle{}) == nullptr, "Zero-initialized handle resolved");
+    assert(!m.contains(SlotMapHandle{}));
+    assert(!m.erase(SlotMapHandle{}));
+    assert(m.get_length() == 1);
+}
+
+TEST(iteration) {
+    SlotMap<int> m;
+    SlotMapHandle handles[100];
+    int sum = 0;
+
+    for(int i = 0; i < 100; ++i) { handles[i] = m.insert(i); }
+    for(int i = 0; i < 100; i += 2) { m.erase(handles[i]); }
+    for(int const x : m) { sum += x; }
+
+    assert(m.get_length() == 50);
+    assert(sum == 2500);
+
+    for(size_t i = 0; i < m.get_length(); ++i) { assert(*m.get(m.get_handle_at(i)) == *(m.begin() + i)); }
+}
+
+TEST(clear) {
+    SlotMap<int> m;
+
+    SlotMapHandle const h = m.insert(1);
+    m.clear();
+
+    assert(m.get_length() == 0);
+    assert(!m.contains(h));
+    assert(*m.get(m.insert(5)) == 5);
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
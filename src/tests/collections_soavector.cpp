@@ -0,0 +1,153 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/soavector.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+using Particles = SoAVector<float, double, uint8_t>;
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(ctor) {
+    Particles v{100};
+
+    assert(v.get_length() == 0);
+    assert(v.get_capacity() >= 100);
+    assert(v.get_capacity() % Particles::SIMD_BLOCK_LENGTH == 0);
+}
+
+TEST(push__get) {
+    Particles v;
+
+    for(int i = 0; i < 1000; ++i) { v.push(i * 0.5f, i * 2.0, static_cast<uint8_t>(i)); }
+
+    assert(v.get_length() == 1000);
+
+    for(int i = 0; i < 1000; ++i) {
+        assert(v[i].get<0>() == i * 0.5f);
+        assert(v[i].get<1>() == i * 2.0);
+        assert(v[i].get<2>() == static_cast<uint8_t>(i));
+    }
+}
+
+TEST(field_alignment) {
+    Particles v{10};
+
+    for(int i = 0; i < 100; ++i) { v.push(0.0f, 0.0, 0); }
+
+    assert(reinterpret_cast<uintptr_t>(v.get_field<0>().get_data()) % Particles::FIELD_ALIGNMENT == 0);
+    assert(reinterpret_cast<uintptr_t>(v.get_field<1>().get_data()) % Particles::FIELD_ALIGNMENT == 0);
+    assert(reinterpret_cast<uintptr_t>(v.get_field<2>().get_data()) % Particles::FIELD_ALIGNMENT == 0);
+    assert(v.get_field<0>().get_length() == 100);
+}
+
+TEST(reference__set) {
+    Particles v;
+
+    v.push(1.0f, 2.0, 3);
+    v[0].get<1>() = 5.0;
+
+    assert(v.get_field<1>()[0] == 5.0);
+
+    v[0].set(7.0f, 8.0, 9);
+
+    assert(v[0].get<0>() == 7.0f);
+    assert(v[0].get<1>() == 8.0);
+    assert(v[0].get<2>() == 9);
+}
+
+TEST(remove_at) {
+    Particles v;
+
+    for(int i = 0; i < 5; ++i) { v.push(static_cast<float>(i), i, i); }
+
+    v.remove_at(1);
+
+    assert(v.get_length() == 4);
+    assert(v[0].get<0>() == 0.0f);
+    assert(v[1].get<0>() == 2.0f);
+    assert(v[3].get<1>() == 4.0);
+    assert(v[3].get<2>() == 4);
+}
+
+TEST(swap_remove_at) {
+    Particles v;
+
+    for(int i = 0; i < 5; ++i) { v.push(static_cast<float>(i), i, i); }
+
+    v.swap_remove_at(1);
+
+    assert(v.get_length() == 4);
+    assert(v[1].get<0>() == 4.0f);
+    assert(v[1].get<1>() == 4.0);
+    assert(v[1].get<2>() == 4);
+
+    // Removing the last item has nothing to move
+    v.swap_remove_at(3);
+
+    assert(v.get_length() == 3);
+    assert(v[2].get<0>() == 2.0f);
+}
+
+TEST(set_length) {
+    Particles v;
+
+    v.push(1.0f, 1.0, 1);
+    v.set_length(50);
+
+    assert(v.get_length() == 50);
+    assert(v[0].get<0>() == 1.0f);
+    assert(v[49].get<0>() == 0.0f);
+    assert(v[49].get<2>() == 0);
+}
+
+TEST(copy__move) {
+    Particles v;
+
+    for(int i = 0; i < 100; ++i) { v.push(static_cast<float>(i), i, i); }
+
+    Particles v2{v};
+    Particles v3{std::move(v2)};
+    Particles v4;
+
+    v4 = v3;
+
+    assert(v3.get_length() == 100);
+    assert(v4.get_length() == 100);
+    assert(v4[99].get<1>() == 99.0);
+
+    Particles &same = v4;
+
+    v4 = std::move(same);
+
+    assert(v4.get_length() == 100);
+    assert(v4[99].get<1>() == 99.0);
+}
+
+TEST(for_each_simd_block) {
+    Particles v;
+    size_t n_items = 0;
+    bool aligned = true;
+
+    for(int i = 0; i < 100; ++i) { v.push(static_cast<float>(i), i, i); }
+
+    v.for_each_simd_block([&n_items, &aligned](size_t const begin, size_t const end) {
+        aligned &= begin % Particles::SIMD_BLOCK_LENGTH == 0;
+        n_items += end - begin;
+    });
+
+    assert(aligned);
+    assert(n_items == 100);
+    assert(v.get_padded_length() == 128);
+    assert(v.get_capacity() >= v.get_padded_length());
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
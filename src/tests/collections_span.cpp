@@ -0,0 +1,82 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/array.hpp>
+#include <jolt/collections/span.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+static int sum(Span<const int> const items) {
+    int result = 0;
+
+    for(int const x : items) { result += x; }
+
+    return result;
+}
+
+TEST(from_containers) {
+    Vector<int> v;
+    Array<int> a{3};
+    StaticArray<int, 2> sa{10, 20};
+    int c[] = {100, 200, 300, 400};
+
+    for(int i = 1; i <= 4; ++i) { v.push(i); }
+    a.fill(5);
+
+    Vector<int> const &cv = v;
+
+    assert(sum(v) == 10);
+    assert(sum(cv) == 10);
+    assert(sum(a) == 15);
+    assert(sum(sa) == 30);
+    assert(sum(c) == 1000);
+    assert(sum({7, 8}) == 15);
+    assert(sum({}) == 0);
+}
+
+TEST(empty) {
+    Vector<int> v;
+    Span<const int> s{v};
+
+    assert(s.is_empty());
+    assert(s.get_length() == 0);
+    assert(s.begin() == s.end());
+}
+
+TEST(subspan) {
+    int c[] = {1, 2, 3, 4, 5};
+    Span<int> s{c};
+
+    assert(sum(s.subspan(1, 3)) == 9);
+    assert(sum(s.subspan(3)) == 9);
+    assert(sum(s.subspan(2, 100)) == 12);
+    assert(s.subspan(5).is_empty());
+}
+
+TEST(write_through) {
+    Vector<int> v;
+
+    v.push(1);
+    v.push(2);
+
+    Span<int> s{v};
+
+    s[1] = 42;
+    for(int &x : s.subspan(0, 1)) { x = 24; }
+
+    assert(v[0] == 24);
+    assert(v[1] == 42);
+    assert(s.get_data() == &v[0]);
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
@@ -0,0 +1,131 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/vector.hpp>
+#include <jolt/collections/sparseset.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+SETUP {
+    jolt::threading::initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(add__get) {
+    SparseSet<int> s;
+
+    s.add(5, 50);
+    s.add(100000, 7);
+    s.add(0, 1);
+
+    assert(s.get_length() == 3);
+    assert(*s.get(5) == 50);
+    assert(*s.get(100000) == 7);
+    assert(*s.get(0) == 1);
+    assert(s.get(6) == nullptr);
+    assert(s.get(1000000) == nullptr);
+    assert(s.contains(100000));
+    assert(!s.contains(99999));
+}
+
+TEST(remove) {
+    SparseSet<int> s;
+
+    for(uint32_t i = 0; i < 100; ++i) { s.add(i * 3, i); }
+    for(uint32_t i = 0; i < 100; i += 2) { assert(s.remove(i * 3)); }
+
+    assert(!s.remove(0));
+    assert(s.get_length() == 50);
+
+    for(uint32_t i = 0; i < 100; ++i) {
+        assert(s.contains(i * 3) == static_cast<bool>(i % 2));
+
+        if(i % 2) {
+            assert(*s.get(i * 3) == static_cast<int>(i));
+        }
+    }
+}
+
+TEST(dense_iteration) {
+    SparseSet<int> s;
+    int sum = 0;
+
+    s.add(10, 1);
+    s.add(2000, 2);
+    s.add(30, 3);
+    s.remove(10);
+
+    for(int const x : s) { sum += x; }
+
+    assert(sum == 5);
+
+    for(size_t i = 0; i < s.get_length(); ++i) { assert(*s.get(s.get_id_at(i)) == s.get_at(i)); }
+}
+
+TEST(clear) {
+    SparseSet<int> s;
+
+    s.add(1, 1);
+    s.add(2, 2);
+    s.clear();
+
+    assert(s.get_length() == 0);
+    assert(!s.contains(1));
+
+    s.add(1, 3);
+
+    assert(*s.get(1) == 3);
+}
+
+TEST(non_trivial__copy) {
+    SparseSet<Vector<int>> s;
+
+    for(uint32_t i = 0; i < 20; ++i) {
+        Vector<int> v;
+
+        v.push(static_cast<int>(i));
+        s.add(i * 100, v);
+    }
+
+    s.remove(0);
+
+    SparseSet<Vector<int>> s2{s};
+    SparseSet<Vector<int>> s3{std::move(s2)};
+
+    assert(s3.get_length() == 19);
+    assert((*s3.get(500))[0] == 5);
+    assert(!s3.contains(0));
+}
+
+TEST(join) {
+    SparseSet<int> a;
+    SparseSet<float> b;
+    SparseSet<char> c;
+    uint32_t id_sum = 0;
+    int n_calls = 0;
+    bool values_ok = true;
+
+    for(uint32_t i = 0; i < 1000; ++i) { a.add(i, static_cast<int>(i)); }
+    for(uint32_t i = 0; i < 1000; i += 2) { b.add(i, static_cast<float>(i)); }
+    for(uint32_t i = 0; i < 1000; i += 3) { c.add(i, 'x'); }
+
+    sparse_set_join(
+      [&id_sum, &n_calls, &values_ok](uint32_t const id, int &x, float &y, char &z) {
+          values_ok &= x == static_cast<int>(id) && y == static_cast<float>(id) && z == 'x';
+          id_sum += id;
+          ++n_calls;
+      },
+      a,
+      b,
+      c);
+
+    assert(values_ok);
+    assert(n_calls == 167); // Multiples of 6 below 1000
+    assert(id_sum == 6 * 166 * 167 / 2);
+}
+
+TEST(memory_leaks) { assert(get_allocated_size() == mem_begin); }
@@ -0,0 +1,93 @@
+#include <emmintrin.h>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/spscqueue.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+constexpr int N_ITEMS = 100000;
+
+struct TestStruct {
+    int value = 0;
+
+    TestStruct() {}
+    TestStruct(int v) : value{v} {}
+    ~TestStruct() {}
+};
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(ctor) {
+    SPSCQueue<int> q{100};
+
+    assert(q.get_capacity() == 128);
+    assert(q.is_empty());
+}
+
+TEST(push__pop) {
+    SPSCQueue<int> q{8};
+    int x;
+
+    for(int i = 0; i < 8; ++i) { assert(q.push(i)); }
+
+    assert2(!q.push(8), "Pushed to a full queue");
+    assert(q.get_length() == 8);
+
+    for(int i = 0; i < 8; ++i) {
+        assert(q.pop(x));
+        assert(x == i);
+    }
+
+    assert2(!q.pop(x), "Popped from an empty queue");
+}
+
+TEST(wrap_around) {
+    SPSCQueue<TestStruct> q{4};
+    TestStruct x;
+
+    for(int i = 0; i < 100; ++i) {
+        assert(q.push(TestStruct{i}));
+        assert(q.push(TestStruct{i + 1}));
+        assert(q.pop(x) && x.value == i);
+        assert(q.pop(x) && x.value == i + 1);
+    }
+
+    assert(q.is_empty());
+}
+
+void producer_handler(void *param) noexcept {
+    auto &q = *reinterpret_cast<SPSCQueue<int> *>(param);
+
+    for(int i = 0; i < N_ITEMS; ++i) {
+        while(!q.push(i)) { _mm_pause(); }
+    }
+}
+
+TEST(push__pop_mt) {
+    SPSCQueue<int> q{64};
+    Thread t{&producer_handler};
+    int x;
+
+    t.start(&q);
+
+    for(int i = 0; i < N_ITEMS; ++i) {
+        while(!q.pop(x)) { _mm_pause(); }
+
+        assert2(x == i, "Items out of order");
+    }
+
+    t.join();
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
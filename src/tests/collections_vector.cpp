@@ -114,6 +114,85 @@ TEST(clear) {
     assert(s.get_length() == 0);
 }
 
+TEST(swap_remove_at) {
+    Vector<int> numbers = {1, 2, 3, 4, 5};
+
+    numbers.swap_remove_at(1);
+    numbers.swap_remove_at(3);
+
+    assert(numbers.get_length() == 3);
+    assert(numbers[0] == 1);
+    assert(numbers[1] == 5);
+    assert(numbers[2] == 3);
+}
+
+TEST(remove_range) {
+    Vector<int> numbers = {1, 2, 3, 4, 5, 6};
+
+    numbers.remove_range(1, 3);
+
+    assert(numbers.get_length() == 3);
+    assert(numbers[0] == 1);
+    assert(numbers[1] == 5);
+    assert(numbers[2] == 6);
+
+    numbers.remove_range(1, 2);
+
+    assert(numbers.get_length() == 1);
+    assert(numbers[0] == 1);
+}
+
+TEST(remove_if) {
+    Vector<int> numbers;
+
+    for(int i = 0; i < 100; ++i) { numbers.push(i); }
+
+    assert(numbers.remove_if([](int const x) { return x % 3 == 0; }) == 34);
+    assert(numbers.get_length() == 66);
+
+    for(size_t i = 0; i < numbers.get_length(); ++i) {
+        assert(numbers[i] % 3 != 0);
+
+        if(i) {
+            assert(numbers[i] > numbers[i - 1]);
+        }
+    }
+}
+
+TEST(truncate) {
+    Vector<int> numbers = {1, 2, 3, 4, 5};
+
+    numbers.truncate(10);
+    assert(numbers.get_length() == 5);
+
+    numbers.truncate(2);
+    assert(numbers.get_length() == 2);
+    assert(numbers[1] == 2);
+}
+
+TEST(remove__non_trivial) {
+    Vector<Vector<int>> vectors;
+
+    for(int i = 0; i < 10; ++i) {
+        Vector<int> v;
+
+        v.push(i);
+        vectors.push(v);
+    }
+
+    vectors.remove_at(0);
+    vectors.swap_remove_at(0);
+    vectors.remove_range(2, 2);
+    vectors.remove_if([](Vector<int> const &v) { return v[0] == 9; });
+    vectors.add(vectors[0], 1);
+    (void)vectors.pop();
+    vectors.set_length(2);
+    vectors.truncate(1);
+
+    assert(vectors.get_length() == 1);
+    assert(vectors[0][0] == 2);
+}
+
 TEST(memory_leaks) { // Must be last test
     assert(get_allocated_size() == mem_begin);
 }
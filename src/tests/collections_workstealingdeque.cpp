@@ -0,0 +1,122 @@
+#include <atomic>
+#include <emmintrin.h>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/collections/workstealingdeque.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+using namespace jolt::collections;
+
+size_t mem_begin;
+
+constexpr int N_THIEVES = 3;
+constexpr int N_ITEMS = 100000;
+
+struct test_data {
+    WorkStealingDeque<int> deque{16};
+    std::atomic<bool> done{false};
+    std::atomic<long long> sum{0};
+    std::atomic<int> taken{0};
+};
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+TEST(push__pop) {
+    WorkStealingDeque<int> d{4};
+    int x;
+
+    for(int i = 0; i < 10; ++i) { d.push(i); }
+
+    assert(d.get_length() == 10);
+    assert(d.get_capacity() == 16);
+
+    for(int i = 9; i >= 0; --i) {
+        assert(d.pop(x));
+        assert(x == i);
+    }
+
+    assert2(!d.pop(x), "Popped from an empty deque");
+    assert(d.is_empty());
+}
+
+TEST(steal) {
+    WorkStealingDeque<int> d{4};
+    int x;
+
+    for(int i = 0; i < 5; ++i) { d.push(i); }
+
+    assert(d.steal(x) && x == 0);
+    assert(d.steal(x) && x == 1);
+    assert(d.pop(x) && x == 4);
+    assert(d.get_length() == 2);
+
+    d.push(5);
+
+    assert(d.steal(x) && x == 2);
+    assert(d.pop(x) && x == 5);
+    assert(d.pop(x) && x == 3);
+    assert2(!d.steal(x), "Stole from an empty deque");
+}
+
+void thief_handler(void *param) noexcept {
+    auto &tdata = *reinterpret_cast<test_data *>(param);
+    int x;
+
+    while(!tdata.done.load() || !tdata.deque.is_empty()) {
+        if(tdata.deque.steal(x)) {
+            tdata.sum += x;
+            ++tdata.taken;
+        } else {
+            _mm_pause();
+        }
+    }
+}
+
+TEST(push__pop__steal_mt) {
+    test_data tdata;
+    Thread *thieves[N_THIEVES];
+    long long owner_sum = 0;
+    int owner_taken = 0;
+    int x;
+
+    for(int i = 0; i < N_THIEVES; ++i) {
+        thieves[i] = jltnew(Thread, &thief_handler);
+        thieves[i]->start(&tdata);
+    }
+
+    for(int i = 1; i <= N_ITEMS; ++i) {
+        tdata.deque.push(i);
+
+        if(i % 3 == 0 && tdata.deque.pop(x)) {
+            owner_sum += x;
+            ++owner_taken;
+        }
+    }
+
+    while(tdata.deque.pop(x)) {
+        owner_sum += x;
+        ++owner_taken;
+    }
+
+    tdata.done.store(true);
+
+    for(int i = 0; i < N_THIEVES; ++i) {
+        thieves[i]->join();
+        jltfree(thieves[i]);
+    }
+
+    long long const expected_sum = static_cast<long long>(N_ITEMS) * (N_ITEMS + 1) / 2;
+
+    assert(owner_taken + tdata.taken.load() == N_ITEMS);
+    assert2(owner_sum + tdata.sum.load() == expected_sum, "Items lost or duplicated");
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -4,6 +4,13 @@
 
 void free_mt_handler(void *ptr) { jolt::memory::free_array(ptr); }
 
+struct non_trivial {
+    int value;
+
+    non_trivial() : value{0} {}
+    non_trivial(non_trivial &&other) : value{other.value} { other.value = -1; }
+};
+
 SETUP { jolt::threading::initialize(); }
 
 TEST(allocate__free) {
@@ -54,6 +61,24 @@ TEST(reallocate) {
     assert(d == c);
 }
 
+TEST(reallocate__non_trivial) {
+    non_trivial *a = jolt::memory::allocate_array<non_trivial>(100);
+    int *b = jolt::memory::allocate_array<int>(500);
+
+    for(int i = 0; i < 100; ++i) { a[i].value = i; }
+
+    // Moved by the allocator, which must not take the slot lock again while holding it
+    non_trivial *c = jolt::memory::reallocate(a, 2000);
+    non_trivial *d = jolt::memory::reallocate(c, 800);
+
+    assert(c != a);
+
+    for(int i = 0; i < 100; ++i) { assert(d[i].value == i); }
+
+    jolt::memory::free_array(b);
+    jolt::memory::free_array(d);
+}
+
 TEST(free__mt) {
     size_t const mem_alloc = jolt::memory::get_allocated_size();
     int *a = jolt::memory::allocate_array<int>(100);
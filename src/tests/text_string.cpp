@@ -75,6 +75,19 @@ TEST(op_equals) {
     assert(s2 != s4);
 }
 
+TEST(op_less) {
+    String s1{u8"abc"};
+    String s2{u8"abd"};
+    String s3{u8"ab"};
+    String s4{u8""};
+
+    assert(s1 < s2);
+    assert(!(s2 < s1));
+    assert(s3 < s1);
+    assert(s4 < s3);
+    assert(!(s1 < s1));
+}
+
 TEST(op_plus) {
     String s1{u8"blah blah"};
     String s2{u8"blah grab"};
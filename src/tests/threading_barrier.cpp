@@ -0,0 +1,74 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/barrier.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+constexpr unsigned N_THREADS = 4;
+constexpr unsigned N_PHASES = 1000;
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+struct test_data {
+    Barrier barrier{N_THREADS};
+    std::atomic<unsigned> n_arrived[N_PHASES];
+    std::atomic<unsigned> n_last{0};
+    std::atomic<bool> in_order{true};
+};
+
+TEST(single_thread) {
+    Barrier barrier{1};
+
+    assert(barrier.arrive_and_wait());
+    assert(barrier.arrive_and_wait());
+}
+
+void phase_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    for(unsigned i = 0; i < N_PHASES; ++i) {
+        ++data.n_arrived[i];
+
+        if(data.barrier.arrive_and_wait()) {
+            ++data.n_last;
+        }
+
+        // Every thread must have arrived before any of them proceeds
+        if(data.n_arrived[i].load() != N_THREADS) {
+            data.in_order = false;
+        }
+    }
+}
+
+TEST(phases) {
+    test_data data;
+    Thread *threads[N_THREADS];
+
+    for(std::atomic<unsigned> &n_arrived : data.n_arrived) { n_arrived = 0; }
+
+    for(unsigned i = 0; i < N_THREADS; ++i) {
+        threads[i] = jltnew(Thread, &phase_handler);
+        threads[i]->start(&data);
+    }
+
+    for(unsigned i = 0; i < N_THREADS; ++i) {
+        threads[i]->join();
+        jltfree(threads[i]);
+    }
+
+    assert(data.in_order.load());
+    assert2(data.n_last.load() == N_PHASES, "Not exactly one last thread per phase");
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -0,0 +1,123 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/event.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+constexpr unsigned N_ROUNDS = 10000;
+constexpr unsigned N_WAITERS = 4;
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+struct ping_pong_data {
+    Event ping{true};
+    Event pong{true};
+    unsigned counter = 0;
+};
+
+struct broadcast_data {
+    Event event;
+    std::atomic<unsigned> n_released{0};
+};
+
+TEST(manual_reset) {
+    Event event;
+
+    assert(!event.is_set());
+    assert(!event.try_wait());
+
+    event.set();
+
+    assert(event.is_set());
+    assert(event.try_wait());
+    assert(event.try_wait());
+
+    event.wait();
+    event.reset();
+
+    assert(!event.try_wait());
+}
+
+TEST(auto_reset) {
+    Event event{true, true};
+
+    assert(event.is_set());
+    assert(event.try_wait());
+    assert(!event.is_set());
+    assert(!event.try_wait());
+
+    event.set();
+    event.set();
+    event.wait();
+
+    assert(!event.try_wait());
+}
+
+void ping_pong_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<ping_pong_data *>(param);
+
+    for(unsigned i = 0; i < N_ROUNDS; ++i) {
+        data.ping.wait();
+        data.counter = data.counter + 1;
+        data.pong.set();
+    }
+}
+
+TEST(ping_pong) {
+    ping_pong_data data;
+    Thread t{&ping_pong_handler};
+
+    t.start(&data);
+
+    for(unsigned i = 0; i < N_ROUNDS; ++i) {
+        data.ping.set();
+        data.pong.wait();
+
+        assert(data.counter == i + 1);
+    }
+
+    t.join();
+}
+
+void broadcast_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<broadcast_data *>(param);
+
+    data.event.wait();
+    ++data.n_released;
+}
+
+TEST(broadcast) {
+    broadcast_data data;
+    Thread *threads[N_WAITERS];
+
+    for(unsigned i = 0; i < N_WAITERS; ++i) {
+        threads[i] = jltnew(Thread, &broadcast_handler);
+        threads[i]->start(&data);
+    }
+
+    jolt::threading::sleep(10);
+
+    assert(data.n_released.load() == 0);
+
+    data.event.set();
+
+    for(unsigned i = 0; i < N_WAITERS; ++i) {
+        threads[i]->join();
+        jltfree(threads[i]);
+    }
+
+    assert(data.n_released.load() == N_WAITERS);
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
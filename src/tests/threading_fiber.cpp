@@ -0,0 +1,80 @@
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/fiber.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+struct test_data {
+    Fiber *caller;
+    int value;
+};
+
+struct migration_data {
+    test_data *data;
+    Fiber *fiber;
+};
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+void counting_fiber(void *param) {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    while(true) {
+        ++data.value;
+        data.caller->switch_to();
+    }
+}
+
+TEST(switch_to) {
+    Fiber main_fiber;
+    test_data data{&main_fiber, 0};
+    Fiber fiber{&counting_fiber, &data};
+
+    for(int i = 1; i <= 10; ++i) {
+        fiber.switch_to();
+
+        assert(data.value == i);
+    }
+}
+
+void migrating_thread(void *param) {
+    auto &data = *reinterpret_cast<migration_data *>(param);
+    Fiber thread_fiber;
+
+    // Resume on this thread a fiber first run by the main thread
+    data.data->caller = &thread_fiber;
+    data.fiber->switch_to();
+}
+
+TEST(resume_on_other_thread) {
+    Fiber main_fiber;
+    test_data data{&main_fiber, 0};
+    Fiber fiber{&counting_fiber, &data};
+    migration_data mdata{&data, &fiber};
+    Thread thread{&migrating_thread};
+
+    fiber.switch_to();
+    assert(data.value == 1);
+
+    thread.start(&mdata);
+    thread.join();
+
+    assert(data.value == 2);
+
+    data.caller = &main_fiber;
+    fiber.switch_to();
+
+    assert(data.value == 3);
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -0,0 +1,200 @@
+#include <atomic>
+#include <chrono>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/jobsystem.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+constexpr int N_JOBS = 10000;
+constexpr int N_CHILDREN = 16;
+
+struct test_data {
+    JobSystem *system;
+    std::atomic<int> n_runs{0};
+    std::atomic<long long> sum{0};
+};
+
+struct parent_data {
+    test_data *data;
+    int value;
+};
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+void count_job(void *param) {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    ++data.n_runs;
+}
+
+TEST(run__wait) {
+    JobSystem system{4};
+    test_data data{&system};
+    JobCounter counter;
+
+    assert(system.get_worker_count() == 4);
+
+    for(int i = 0; i < N_JOBS; ++i) { system.run(&count_job, &data, &counter); }
+
+    system.wait(counter);
+
+    assert(counter.is_done());
+    assert(data.n_runs.load() == N_JOBS);
+}
+
+void child_job(void *param) {
+    auto &parent = *reinterpret_cast<parent_data *>(param);
+
+    parent.data->sum += parent.value;
+}
+
+void parent_job(void *param) {
+    auto &parent = *reinterpret_cast<parent_data *>(param);
+    parent_data children[N_CHILDREN];
+    JobCounter counter;
+
+    for(int i = 0; i < N_CHILDREN; ++i) {
+        children[i] = parent_data{parent.data, parent.value * N_CHILDREN + i};
+        parent.data->system->run(&child_job, children + i, &counter);
+    }
+
+    // Waiting inside a job helps running other jobs instead of blocking the worker
+    parent.data->system->wait(counter);
+    ++parent.data->n_runs;
+}
+
+TEST(nested) {
+    constexpr int N_PARENTS = 64;
+
+    JobSystem system{4};
+    test_data data{&system};
+    parent_data parents[N_PARENTS];
+    JobCounter counter;
+
+    for(int i = 0; i < N_PARENTS; ++i) {
+        parents[i] = parent_data{&data, i};
+        system.run(&parent_job, parents + i, &counter);
+    }
+
+    system.wait(counter);
+
+    long long const n = N_PARENTS * N_CHILDREN;
+
+    assert(data.n_runs.load() == N_PARENTS);
+    assert(data.sum.load() == n * (n - 1) / 2);
+}
+
+void external_submitter(void *param) {
+    auto &data = *reinterpret_cast<test_data *>(param);
+    JobCounter counter;
+
+    for(int i = 0; i < N_JOBS; ++i) { data.system->run(&count_job, &data, &counter); }
+
+    data.system->wait(counter);
+}
+
+TEST(external_threads) {
+    JobSystem system{3};
+    test_data data{&system};
+    Thread *submitters[2];
+
+    for(int i = 0; i < 2; ++i) {
+        submitters[i] = jltnew(Thread, &external_submitter);
+        submitters[i]->start(&data);
+    }
+
+    for(int i = 0; i < 2; ++i) {
+        submitters[i]->join();
+        jltfree(submitters[i]);
+    }
+
+    assert(data.n_runs.load() == 2 * N_JOBS);
+}
+
+struct gate_data {
+    JobSystem *system;
+    JobCounter *gate;
+    std::atomic<int> n_started{0};
+    std::atomic<int> n_resumed{0};
+};
+
+void gated_job(void *param) {
+    auto &data = *reinterpret_cast<gate_data *>(param);
+
+    ++data.n_started;
+    data.system->wait(*data.gate);
+    ++data.n_resumed;
+}
+
+TEST(wait__suspend) {
+    constexpr int N_WAITERS = 64;
+
+    JobSystem system{3};
+    JobCounter gate;
+    JobCounter counter;
+    gate_data data{&system, &gate};
+
+    // Completed by this thread, as it would be by an I/O or GPU completion
+    gate.add();
+
+    for(int i = 0; i < N_WAITERS; ++i) { system.run(&gated_job, &data, &counter); }
+
+    // More jobs than workers are waiting: the workers must have suspended them
+    while(data.n_started.load() < N_WAITERS) { jolt::threading::sleep(1); }
+
+    assert(data.n_resumed.load() == 0);
+
+    gate.done();
+    system.wait(counter);
+
+    assert(data.n_resumed.load() == N_WAITERS);
+}
+
+TEST(single_worker) {
+    JobSystem system{1};
+    test_data data{&system};
+    JobCounter counter;
+
+    for(int i = 0; i < 100; ++i) { system.run(&count_job, &data, &counter); }
+
+    system.wait(counter);
+
+    assert(data.n_runs.load() == 100);
+}
+
+bool never_ready(void *) { return false; }
+
+TEST(run_when__never_ready) {
+    test_data data;
+    JobCounter counter;
+    auto const begin = std::chrono::steady_clock::now();
+
+    {
+        JobSystem system{4, 50};
+
+        data.system = &system;
+        system.run_when(&never_ready, &count_job, &data, &counter);
+
+        for(int i = 0; i < 100; ++i) { system.run(&count_job, &data); }
+    }
+
+    auto const elapsed = std::chrono::steady_clock::now() - begin;
+
+    // The workers are joined despite the deferred job, which is dropped after the timeout
+    assert(elapsed < std::chrono::seconds{5});
+    assert(data.n_runs.load() == 100);
+    assert(counter.get_value() == 1);
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -0,0 +1,78 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/latch.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+constexpr unsigned N_THREADS = 4;
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+struct test_data {
+    Latch started{N_THREADS};
+    Latch go{1};
+    std::atomic<unsigned> n_started{0};
+    std::atomic<unsigned> n_finished{0};
+};
+
+TEST(count_down_st) {
+    Latch latch{3};
+
+    assert(!latch.try_wait());
+
+    latch.count_down();
+    latch.count_down(2);
+
+    assert(latch.try_wait());
+
+    latch.wait();
+}
+
+void worker_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    ++data.n_started;
+    data.started.count_down();
+    data.go.wait();
+    ++data.n_finished;
+}
+
+TEST(start_gate) {
+    test_data data;
+    Thread *threads[N_THREADS];
+
+    for(unsigned i = 0; i < N_THREADS; ++i) {
+        threads[i] = jltnew(Thread, &worker_handler);
+        threads[i]->start(&data);
+    }
+
+    data.started.wait();
+
+    assert(data.n_started.load() == N_THREADS);
+
+    jolt::threading::sleep(10);
+
+    assert(data.n_finished.load() == 0);
+
+    data.go.count_down();
+
+    for(unsigned i = 0; i < N_THREADS; ++i) {
+        threads[i]->join();
+        jltfree(threads[i]);
+    }
+
+    assert(data.n_finished.load() == N_THREADS);
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -25,10 +25,10 @@ TEST(acquire_release_mt) {
 
     tdata.lock.acquire();
     t.start(&tdata);
-    sleep(100);
+    jolt::threading::sleep(100);
     assert2(!tdata.complete, "Lock was acquired twice");
     tdata.lock.release();
-    sleep(100);
+    jolt::threading::sleep(100);
     assert2(tdata.complete, "Lock wasn't released");
 }
 
@@ -50,3 +50,37 @@ TEST(try_acquire) {
 
     assert(tdata.complete);
 }
+
+constexpr unsigned N_CONTENDERS = 4;
+constexpr unsigned N_INCREMENTS = 100000;
+
+struct contended_data {
+    Lock lock;
+    unsigned counter = 0;
+};
+
+void increment_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<contended_data *>(param);
+
+    for(unsigned i = 0; i < N_INCREMENTS; ++i) {
+        data.lock.acquire();
+        data.counter = data.counter + 1;
+        data.lock.release();
+    }
+}
+
+TEST(acquire_release_contended) {
+    contended_data data;
+    Thread t0{&increment_handler}, t1{&increment_handler}, t2{&increment_handler};
+
+    t0.start(&data);
+    t1.start(&data);
+    t2.start(&data);
+    increment_handler(&data);
+
+    t0.join();
+    t1.join();
+    t2.join();
+
+    assert(data.counter == N_CONTENDERS * N_INCREMENTS);
+}
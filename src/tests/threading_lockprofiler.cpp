@@ -0,0 +1,155 @@
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <jolt/test.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/lock.hpp>
+#include <jolt/threading/lockguard.hpp>
+#include <jolt/threading/spinlock.hpp>
+#include <jolt/threading/lockprofiler.hpp>
+
+using namespace jolt::threading;
+
+SETUP { initialize(); }
+
+#ifdef JLT_WITH_LOCK_PROFILING
+constexpr uint32_t HOLD_TIME_MS = 50;
+constexpr uint64_t MIN_HOLD_TIME = 40'000'000; //< Lower bound of the hold time, in ns.
+
+template<typename T>
+struct test_data {
+    T lock;
+
+    explicit test_data(LockSite const site) : lock{site} {}
+};
+
+template<typename T>
+void lock_handler(void *param) noexcept {
+    test_data<T> *tdata = reinterpret_cast<test_data<T> *>(param);
+
+    tdata->lock.acquire();
+    tdata->lock.release();
+}
+
+template<typename T>
+void guard_handler(void *param) noexcept {
+    test_data<T> *tdata = reinterpret_cast<test_data<T> *>(param);
+
+    LockGuard guard{tdata->lock, LockSite{"test::guard"}};
+}
+
+/**
+ * Hold the lock while another thread waits on it.
+ */
+template<typename T>
+void contend(test_data<T> &tdata, thread_handler_ptr const handler) {
+    Thread t{handler};
+
+    tdata.lock.acquire();
+    t.start(&tdata);
+    sleep(HOLD_TIME_MS);
+    tdata.lock.release();
+    t.join();
+}
+
+/**
+ * Return a value stating whether the statistics of a site match those recorded by `contend()`.
+ */
+bool is_contended(LockSite const site) {
+    LockStats const &stats = get_lock_stats(site);
+
+    return stats.m_n_acquisitions.load() == 2 && stats.m_n_contended.load() == 1
+           && stats.m_wait_time.load() == stats.m_max_wait_time.load()
+           && stats.m_max_wait_time.load() >= MIN_HOLD_TIME && stats.m_max_hold_time.load() >= MIN_HOLD_TIME
+           && stats.m_hold_time.load() >= stats.m_max_hold_time.load();
+}
+
+TEST(lock) {
+    test_data<Lock> tdata{LockSite{"test::lock"}};
+
+    reset_lock_stats();
+    contend(tdata, &lock_handler<Lock>);
+    assert(is_contended(LockSite{"test::lock"}));
+
+    assert(tdata.lock.try_acquire());
+    tdata.lock.release();
+
+    LockStats const &stats = get_lock_stats(LockSite{"test::lock"});
+
+    assert(stats.m_n_acquisitions.load() == 3);
+    assert(stats.m_n_contended.load() == 1);
+}
+
+TEST(spinlock) {
+    test_data<SpinLock> tdata{LockSite{"test::spinlock"}};
+
+    reset_lock_stats();
+    contend(tdata, &lock_handler<SpinLock>);
+    assert(is_contended(LockSite{"test::spinlock"}));
+}
+
+TEST(lock_guard) {
+    test_data<Lock> tdata{LockSite{"test::guarded_lock"}};
+
+    reset_lock_stats();
+    contend(tdata, &guard_handler<Lock>);
+    assert(is_contended(LockSite{"test::guarded_lock"}));
+
+    LockStats const &stats = get_lock_stats(LockSite{"test::guard"});
+
+    assert(stats.m_n_acquisitions.load() == 1);
+    assert(stats.m_n_contended.load() == 1);
+    assert(stats.m_wait_time.load() >= MIN_HOLD_TIME);
+}
+
+TEST(site) {
+    Lock lock; // Profiled under the location it's created at
+    uint32_t const line = __LINE__ - 1;
+    Lock named_a{LockSite{"test::shared"}}, named_b{LockSite{"test::shared"}};
+    LockSite site{__FILE__};
+
+    reset_lock_stats();
+
+    lock.acquire();
+    lock.release();
+    named_a.acquire();
+    named_a.release();
+    named_b.acquire();
+    named_b.release();
+
+    site.m_line = line;
+
+    assert(get_lock_stats(site).m_n_acquisitions.load() == 1);
+    assert(get_lock_stats(LockSite{"test::shared"}).m_n_acquisitions.load() == 2);
+}
+
+TEST(dump_lock_stats) {
+    Lock lock{LockSite{"test::dump"}};
+    FILE *const f = tmpfile();
+    char buffer[4096];
+
+    lock.acquire();
+    lock.release();
+
+    dump_lock_stats(f);
+    rewind(f);
+
+    size_t const length = fread(buffer, 1, sizeof(buffer) - 1, f);
+
+    fclose(f);
+    buffer[length] = '\0';
+
+    assert(strstr(buffer, "Lock site") == buffer);
+    assert(strstr(buffer, "test::dump"));
+}
+#else
+TEST(disabled) {
+    assert(std::is_empty_v<LockSite>);
+
+    Lock lock{LockSite{"test::disabled"}};
+
+    lock.acquire();
+    lock.release();
+    dump_lock_stats();
+}
+#endif // JLT_WITH_LOCK_PROFILING
@@ -0,0 +1,80 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/mcslock.hpp>
+
+using namespace jolt::threading;
+
+constexpr unsigned N_INCREMENTS = 100000;
+
+SETUP { initialize(); }
+
+struct test_data {
+    MCSLock lock;
+    unsigned counter = 0;
+    std::atomic<bool> complete{false};
+};
+
+TEST(acquire_release_st) {
+    MCSLock lock;
+    MCSLock::Node node, other_node;
+
+    assert2(!lock.is_acquired(), "Invalid initial state");
+    lock.acquire(node);
+    assert2(lock.is_acquired(), "Not acquired");
+    lock.release(node);
+    assert2(!lock.is_acquired(), "Not released");
+
+    assert(lock.try_acquire(node));
+    assert(!lock.try_acquire(other_node));
+    lock.release(node);
+    assert(!lock.is_acquired());
+}
+
+void try_acquire_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+    MCSLock::Node node;
+
+    if(!data.lock.try_acquire(node)) {
+        data.complete = true;
+    }
+}
+
+TEST(try_acquire) {
+    test_data data;
+    Thread t{&try_acquire_handler};
+
+    {
+        MCSLock::Guard guard{data.lock};
+
+        t.start(&data);
+        t.join();
+    }
+
+    assert(data.complete.load());
+    assert(!data.lock.is_acquired());
+}
+
+void increment_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    for(unsigned i = 0; i < N_INCREMENTS; ++i) {
+        MCSLock::Guard guard{data.lock};
+
+        data.counter = data.counter + 1;
+    }
+}
+
+TEST(acquire_release_contended) {
+    test_data data;
+    Thread t0{&increment_handler}, t1{&increment_handler};
+
+    t0.start(&data);
+    t1.start(&data);
+    increment_handler(&data);
+    t0.join();
+    t1.join();
+
+    assert(data.counter == 3 * N_INCREMENTS);
+    assert(!data.lock.is_acquired());
+}
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/rwlock.hpp>
+
+using namespace jolt::threading;
+
+constexpr unsigned N_READERS = 3;
+constexpr unsigned N_ITERATIONS = 20000;
+
+SETUP { initialize(); }
+
+struct test_data {
+    RWLock lock;
+    std::atomic<bool> acquired{false};
+    std::atomic<bool> done{false};
+};
+
+void try_read_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    if(data.lock.try_acquire_read()) {
+        data.acquired = true;
+        data.lock.release_read();
+    }
+}
+
+void try_write_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    if(data.lock.try_acquire_write()) {
+        data.acquired = true;
+        data.lock.release_write();
+    }
+}
+
+void write_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    data.lock.acquire_write();
+    data.acquired = true;
+    data.lock.release_write();
+}
+
+TEST(acquire_read__shared) {
+    test_data data;
+    Thread t{&try_read_handler};
+
+    data.lock.acquire_read();
+    t.start(&data);
+    t.join();
+    data.lock.release_read();
+
+    assert2(data.acquired.load(), "Readers excluded each other");
+}
+
+TEST(acquire_read__excludes_writers) {
+    test_data data;
+    Thread t{&try_write_handler};
+
+    data.lock.acquire_read();
+    t.start(&data);
+    t.join();
+    data.lock.release_read();
+
+    assert2(!data.acquired.load(), "Writer acquired the lock held by a reader");
+}
+
+TEST(acquire_write__exclusive) {
+    test_data data;
+    Thread t0{&try_read_handler}, t1{&try_write_handler};
+
+    data.lock.acquire_write();
+    t0.start(&data);
+    t0.join();
+    t1.start(&data);
+    t1.join();
+    data.lock.release_write();
+
+    assert2(!data.acquired.load(), "Lock acquired while held by a writer");
+}
+
+TEST(acquire_write__writer_preference) {
+    test_data data;
+    Thread t{&write_handler};
+
+    data.lock.acquire_read();
+    t.start(&data);
+    jolt::threading::sleep(50);
+
+    // The writer is waiting: new readers queue behind it
+    assert(!data.acquired.load());
+    assert(!data.lock.try_acquire_read());
+
+    data.lock.release_read();
+    t.join();
+
+    assert(data.acquired.load());
+}
+
+struct contended_data {
+    RWLock lock;
+    unsigned a = 0; //< Always equal to `b` outside of the lock.
+    unsigned b = 0; //< Always equal to `a` outside of the lock.
+    std::atomic<unsigned> n_torn{0};
+};
+
+void reader_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<contended_data *>(param);
+
+    for(unsigned i = 0; i < N_ITERATIONS; ++i) {
+        ReadGuard guard{data.lock};
+
+        if(data.a != data.b) {
+            ++data.n_torn;
+        }
+    }
+}
+
+TEST(acquire__contended) {
+    contended_data data;
+    Thread t0{&reader_handler}, t1{&reader_handler}, t2{&reader_handler};
+
+    t0.start(&data);
+    t1.start(&data);
+    t2.start(&data);
+
+    for(unsigned i = 0; i < N_ITERATIONS; ++i) {
+        WriteGuard guard{data.lock};
+
+        data.a = data.a + 1;
+        data.b = data.b + 1;
+    }
+
+    t0.join();
+    t1.join();
+    t2.join();
+
+    assert(data.n_torn.load() == 0);
+    assert(data.a == N_ITERATIONS && data.b == N_ITERATIONS);
+}
@@ -0,0 +1,108 @@
+#include <atomic>
+#include <chrono>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/semaphore.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+constexpr unsigned N_CONSUMERS = 4;
+constexpr unsigned N_ITEMS = 10000; // Per consumer
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+struct test_data {
+    Semaphore items;
+    std::atomic<unsigned> n_consumed{0};
+};
+
+TEST(acquire_release_st) {
+    Semaphore sem{2};
+
+    assert(sem.get_count() == 2);
+    assert(sem.try_acquire());
+
+    sem.acquire();
+
+    assert(sem.get_count() == 0);
+    assert(!sem.try_acquire());
+
+    sem.release(3);
+
+    assert(sem.get_count() == 3);
+}
+
+TEST(try_acquire_for) {
+    Semaphore sem;
+    auto const begin = std::chrono::steady_clock::now();
+
+    assert(!sem.try_acquire_for(2'000'000));
+    assert(std::chrono::steady_clock::now() - begin >= std::chrono::milliseconds{2});
+
+    sem.release();
+
+    assert(sem.try_acquire_for(2'000'000));
+    assert(sem.get_count() == 0);
+}
+
+void release_handler(void *param) noexcept {
+    auto &sem = *reinterpret_cast<Semaphore *>(param);
+
+    jolt::threading::sleep(5);
+    sem.release();
+}
+
+TEST(try_acquire_for__release) {
+    Semaphore sem;
+    Thread t{&release_handler};
+
+    t.start(&sem);
+
+    assert(sem.try_acquire_for(10'000'000'000ull));
+
+    t.join();
+}
+
+void consumer_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    for(unsigned i = 0; i < N_ITEMS; ++i) {
+        data.items.acquire();
+        ++data.n_consumed;
+    }
+}
+
+TEST(producer_consumer) {
+    test_data data;
+    Thread *consumers[N_CONSUMERS];
+
+    for(unsigned i = 0; i < N_CONSUMERS; ++i) {
+        consumers[i] = jltnew(Thread, &consumer_handler);
+        consumers[i]->start(&data);
+    }
+
+    // Alternate single and batched releases, so that consumers both spin and sleep
+    for(unsigned i = 0; i < N_CONSUMERS * N_ITEMS / 2; ++i) { data.items.release(); }
+
+    for(unsigned i = 0; i < N_CONSUMERS * N_ITEMS / 2; i += 100) { data.items.release(100); }
+
+    for(unsigned i = 0; i < N_CONSUMERS; ++i) {
+        consumers[i]->join();
+        jltfree(consumers[i]);
+    }
+
+    assert(data.n_consumed.load() == N_CONSUMERS * N_ITEMS);
+    assert(data.items.get_count() == 0);
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -0,0 +1,93 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/seqlock.hpp>
+
+using namespace jolt::threading;
+
+constexpr unsigned N_ITERATIONS = 100000;
+
+SETUP { initialize(); }
+
+struct state {
+    uint32_t frame;
+    uint64_t doubled;
+    float inverse;
+    uint8_t parity;
+};
+
+struct test_data {
+    SeqLock<state> lock{state{0, 0, 0.0f, 0}};
+    std::atomic<bool> done{false};
+    std::atomic<unsigned> n_torn{0};
+};
+
+TEST(load__store) {
+    SeqLock<state> lock;
+    state const initial = lock.load();
+
+    assert(initial.frame == 0 && initial.doubled == 0 && initial.parity == 0);
+
+    lock.store(state{3, 6, -3.0f, 1});
+
+    state const value = lock.load();
+
+    assert(value.frame == 3 && value.doubled == 6 && value.inverse == -3.0f && value.parity == 1);
+}
+
+void reader_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    while(!data.done.load(std::memory_order_acquire)) {
+        state const value = data.lock.load();
+
+        if(value.doubled != value.frame * 2ull || value.inverse != -static_cast<float>(value.frame)
+           || value.parity != (value.frame & 1)) {
+            ++data.n_torn;
+        }
+    }
+}
+
+TEST(load__concurrent) {
+    test_data data;
+    Thread t0{&reader_handler}, t1{&reader_handler};
+
+    t0.start(&data);
+    t1.start(&data);
+
+    for(uint32_t i = 1; i <= N_ITERATIONS; ++i) {
+        data.lock.store(state{i, i * 2ull, -static_cast<float>(i), static_cast<uint8_t>(i & 1)});
+    }
+
+    data.done.store(true, std::memory_order_release);
+    t0.join();
+    t1.join();
+
+    assert(data.n_torn.load() == 0);
+    assert(data.lock.load().frame == N_ITERATIONS);
+}
+
+void update_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    for(unsigned i = 0; i < N_ITERATIONS; ++i) {
+        data.lock.update([](state &value) {
+            ++value.frame;
+            value.doubled = value.frame * 2ull;
+        });
+    }
+}
+
+TEST(update) {
+    test_data data;
+    Thread t{&update_handler};
+
+    t.start(&data);
+    update_handler(&data);
+    t.join();
+
+    state const value = data.lock.load();
+
+    assert(value.frame == 2 * N_ITERATIONS);
+    assert(value.doubled == 4ull * N_ITERATIONS);
+}
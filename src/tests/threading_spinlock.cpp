@@ -64,7 +64,7 @@ TEST(acquire_release_mt) {
     tdata.can_start = true;
 
     while(!tdata.other_thread_started) { _mm_pause(); }
-    sleep(50);
+    jolt::threading::sleep(50);
 
     assert2(!tdata.complete, "Lock was acquired twice");
     tdata.lock.release();
@@ -0,0 +1,163 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/jobsystem.hpp>
+#include <jolt/threading/task.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+constexpr int N_TASKS = 8;
+constexpr int N_ROUNDS = 256;
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+Task<int> square(int const x) { co_return x * x; }
+
+Task<int> sum_of_squares(int const n) {
+    int sum = 0;
+
+    for(int i = 1; i <= n; ++i) { sum += co_await square(i); }
+
+    co_return sum;
+}
+
+TEST(co_await__sync_wait) {
+    JobSystem system{2};
+
+    assert(sync_wait(system, square(7)) == 49);
+    assert(sync_wait(system, sum_of_squares(10)) == 385);
+}
+
+Task<int> on_worker(JobSystem &system, int const x) {
+    co_await schedule(system);
+
+    co_return x + 1;
+}
+
+Task<> add_on_worker(JobSystem &system, std::atomic<int> &sum, int const x) {
+    sum += co_await on_worker(system, x);
+}
+
+TEST(schedule) {
+    JobSystem system{4};
+    std::atomic<int> sum{0};
+
+    sync_wait(system, add_on_worker(system, sum, 41));
+
+    assert(sum.load() == 42);
+}
+
+Task<> run_all(JobSystem &system, std::atomic<int> &sum) {
+    Task<> tasks[N_TASKS] = {
+      add_on_worker(system, sum, 1),
+      add_on_worker(system, sum, 2),
+      add_on_worker(system, sum, 3),
+      add_on_worker(system, sum, 4),
+      add_on_worker(system, sum, 5),
+      add_on_worker(system, sum, 6),
+      add_on_worker(system, sum, 7),
+      add_on_worker(system, sum, 8)};
+
+    co_await when_all(system, jolt::collections::Span<Task<>>{tasks});
+}
+
+Task<int> compute(JobSystem &system, int const x) {
+    co_await schedule(system);
+
+    co_return x * 2;
+}
+
+Task<int> sum_all(JobSystem &system) {
+    Task<int> tasks[4] = {compute(system, 1), compute(system, 2), compute(system, 3), compute(system, 4)};
+    int sum = 0;
+
+    co_await when_all(system, jolt::collections::Span<Task<int>>{tasks});
+
+    for(Task<int> &task : tasks) { sum += task.get_result(); }
+
+    co_return sum;
+}
+
+TEST(when_all) {
+    JobSystem system{4};
+    std::atomic<int> sum{0};
+
+    sync_wait(system, run_all(system, sum));
+
+    assert(sum.load() == N_TASKS * (N_TASKS + 3) / 2);
+    assert(sync_wait(system, sum_all(system)) == 20);
+}
+
+Task<> write_result(JobSystem &system, int *const results, int const i) {
+    co_await schedule(system);
+
+    results[i] = i * i + 1;
+}
+
+Task<bool> check_results(JobSystem &system) {
+    int results[N_TASKS] = {};
+    Task<> tasks[N_TASKS] = {
+      write_result(system, results, 0),
+      write_result(system, results, 1),
+      write_result(system, results, 2),
+      write_result(system, results, 3),
+      write_result(system, results, 4),
+      write_result(system, results, 5),
+      write_result(system, results, 6),
+      write_result(system, results, 7)};
+
+    co_await when_all(system, jolt::collections::Span<Task<>>{tasks});
+
+    // Plain writes of the other tasks must be visible to the continuation
+    for(int i = 0; i < N_TASKS; ++i) {
+        if(results[i] != i * i + 1) {
+            co_return false;
+        }
+    }
+
+    co_return true;
+}
+
+TEST(when_all__results) {
+    JobSystem system{4};
+
+    for(int i = 0; i < N_ROUNDS; ++i) { assert(sync_wait(system, check_results(system))); }
+}
+
+bool is_flag_set(void *param) { return reinterpret_cast<std::atomic<bool> *>(param)->load(); }
+
+Task<int> wait_for_flag(JobSystem &system, std::atomic<bool> &flag) {
+    co_await when_ready(system, &is_flag_set, &flag);
+
+    co_return 1;
+}
+
+void set_flag(void *param) {
+    jolt::threading::sleep(10);
+    reinterpret_cast<std::atomic<bool> *>(param)->store(true);
+}
+
+TEST(when_ready) {
+    JobSystem system{2};
+    std::atomic<bool> flag{false};
+    Thread thread{&set_flag};
+
+    // Set by a thread unknown to the job system, as it would be by the GPU
+    thread.start(&flag);
+
+    assert(sync_wait(system, wait_for_flag(system, flag)) == 1);
+
+    thread.join();
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
@@ -0,0 +1,199 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/taskgraph.hpp>
+
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+using node_id = TaskGraph::node_id;
+
+size_t mem_begin;
+
+constexpr int N_NODES = 8;
+constexpr int N_FRAMES = 16;
+
+struct test_data {
+    std::atomic<int> sequence{0};
+    int finished_at[N_NODES];
+};
+
+struct node_data {
+    test_data *data;
+    int index;
+};
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+void record_job(void *param) {
+    auto &node = *reinterpret_cast<node_data *>(param);
+
+    jolt::threading::sleep(1);
+    node.data->finished_at[node.index] = node.data->sequence++;
+}
+
+/**
+ * Add `n` nodes recording when they complete.
+ */
+void add_nodes(TaskGraph &graph, test_data &data, node_data *const nodes, int const n) {
+    for(int i = 0; i < n; ++i) {
+        nodes[i] = node_data{&data, i};
+        graph.add_node("node", &record_job, &nodes[i]);
+    }
+}
+
+TEST(add_dependency) {
+    JobSystem system{4};
+    TaskGraph graph;
+    test_data data;
+    node_data nodes[4];
+
+    // Diamond: 0 -> {1, 2} -> 3
+    add_nodes(graph, data, nodes, 4);
+    graph.add_dependency(0, 1);
+    graph.add_dependency(0, 2);
+    graph.add_dependency(1, 3);
+    graph.add_dependency(2, 3);
+    graph.build();
+
+    for(int frame = 0; frame < N_FRAMES; ++frame) {
+        data.sequence = 0;
+        graph.execute(system);
+
+        assert(data.sequence.load() == 4);
+        assert(data.finished_at[0] == 0);
+        assert(data.finished_at[3] == 3);
+    }
+}
+
+TEST(read__write) {
+    JobSystem system{4};
+    TaskGraph graph;
+    test_data data;
+    node_data nodes[5];
+    TaskGraph::resource_id const resource = 42;
+
+    // Writer, three readers, writer: the readers may run in parallel, but not with the writers
+    add_nodes(graph, data, nodes, 5);
+    graph.write(0, resource);
+    graph.read(3, resource);
+    graph.read(1, resource);
+    graph.read(2, resource);
+    graph.write(4, resource);
+    graph.build();
+
+    graph.execute(system);
+
+    assert(data.sequence.load() == 5);
+    assert(data.finished_at[0] == 0);
+    assert(data.finished_at[4] == 4);
+
+    for(int i = 1; i < 4; ++i) { assert(data.finished_at[i] > 0 && data.finished_at[i] < 4); }
+}
+
+TEST(execution_order) {
+    JobSystem system{2};
+    TaskGraph graph;
+    test_data data;
+    node_data nodes[N_NODES];
+
+    // Each node reads what the previous one wrote: the resources chain all the nodes
+    add_nodes(graph, data, nodes, N_NODES);
+
+    for(int i = 0; i < N_NODES; ++i) {
+        graph.write(i, 1 + (i & 1));
+
+        if(i > 0) {
+            graph.read(i, 1 + ((i - 1) & 1));
+        }
+    }
+
+    graph.build();
+
+    auto const &order = graph.get_execution_order();
+
+    assert(order.get_length() == N_NODES);
+
+    for(int i = 0; i < N_NODES; ++i) { assert(order[i] == static_cast<node_id>(i)); }
+
+    for(int frame = 0; frame < N_FRAMES; ++frame) {
+        data.sequence = 0;
+        graph.execute(system);
+
+        for(int i = 0; i < N_NODES; ++i) { assert(data.finished_at[i] == i); }
+    }
+
+    for(int i = 0; i < N_NODES; ++i) { assert(graph.get_node_duration(i) > 0); }
+
+    assert(graph.get_critical_path_duration() > 0);
+}
+
+TEST(critical_path) {
+    JobSystem system{1};
+    TaskGraph graph;
+    test_data data;
+    node_data nodes[4];
+
+    // 0 and 1 are independent, 1 -> 2 -> 3: the critical path goes through 1
+    add_nodes(graph, data, nodes, 4);
+    graph.add_dependency(1, 2);
+    graph.add_dependency(2, 3);
+    graph.build();
+
+    for(int frame = 0; frame < N_FRAMES; ++frame) {
+        data.sequence = 0;
+        graph.execute(system);
+
+        assert(data.sequence.load() == 4);
+    }
+
+    // With a single worker, the root of the longest path runs first
+    assert(data.finished_at[1] < data.finished_at[0]);
+    assert(graph.get_critical_path_duration() > 0);
+}
+
+struct external_data {
+    JobSystem *system;
+    TaskGraph *graph;
+};
+
+void execute_graph(void *param) noexcept {
+    auto &ext = *reinterpret_cast<external_data *>(param);
+
+    ext.graph->execute(*ext.system);
+}
+
+TEST(critical_path__external) {
+    JobSystem system{1};
+    TaskGraph graph;
+    test_data data;
+    node_data nodes[4];
+    external_data ext{&system, &graph};
+
+    // Same graph as above, executed from a thread that isn't a worker: its jobs go through the
+    // FIFO external queue and only that thread runs them while waiting
+    add_nodes(graph, data, nodes, 4);
+    graph.add_dependency(1, 2);
+    graph.add_dependency(2, 3);
+    graph.build();
+
+    for(int frame = 0; frame < N_FRAMES; ++frame) {
+        Thread t{&execute_graph};
+
+        data.sequence = 0;
+        t.start(&ext);
+        t.join();
+
+        assert(data.sequence.load() == 4);
+        assert(data.finished_at[1] < data.finished_at[0]);
+    }
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}
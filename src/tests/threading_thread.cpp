@@ -58,7 +58,7 @@ TEST(ctor_move) {
     assert(t.get_name() == thr_name);
 }
 
-void join_handler(JLT_MAYBE_UNUSED void *param) noexcept { sleep(1000); }
+void join_handler(JLT_MAYBE_UNUSED void *param) noexcept { jolt::threading::sleep(1000); }
 
 TEST(join) {
     Thread t{&join_handler};
@@ -82,3 +82,14 @@ TEST(try_join) {
     bool const should_succeed = t.try_join(1200);
     assert2(should_succeed, "Didn't succeed where it should have");
 }
+
+TEST(sleep_for) {
+    constexpr uint64_t duration_ns = 200000;
+
+    auto t_begin = std::chrono::steady_clock::now();
+    sleep_for(duration_ns);
+    auto t_end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> t_delta = t_end - t_begin;
+
+    assert(t_delta.count() >= duration_ns / 1.0e9 && t_delta.count() < 1);
+}
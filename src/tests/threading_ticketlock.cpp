@@ -0,0 +1,74 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/ticketlock.hpp>
+
+using namespace jolt::threading;
+
+constexpr unsigned N_INCREMENTS = 100000;
+
+SETUP { initialize(); }
+
+struct test_data {
+    TicketLock lock;
+    unsigned counter = 0;
+    std::atomic<bool> complete{false};
+};
+
+TEST(acquire_release_st) {
+    TicketLock lock;
+
+    assert2(!lock.is_acquired(), "Invalid initial state");
+    lock.acquire();
+    assert2(lock.is_acquired(), "Not acquired");
+    lock.release();
+    assert2(!lock.is_acquired(), "Not released");
+
+    assert(lock.try_acquire());
+    assert(!lock.try_acquire());
+    lock.release();
+}
+
+void try_acquire_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    if(!data.lock.try_acquire()) {
+        data.complete = true;
+    }
+}
+
+TEST(try_acquire) {
+    test_data data;
+    Thread t{&try_acquire_handler};
+
+    data.lock.acquire();
+    t.start(&data);
+    t.join();
+    data.lock.release();
+
+    assert(data.complete.load());
+}
+
+void increment_handler(void *param) noexcept {
+    auto &data = *reinterpret_cast<test_data *>(param);
+
+    for(unsigned i = 0; i < N_INCREMENTS; ++i) {
+        data.lock.acquire();
+        data.counter = data.counter + 1;
+        data.lock.release();
+    }
+}
+
+TEST(acquire_release_contended) {
+    test_data data;
+    Thread t0{&increment_handler}, t1{&increment_handler};
+
+    t0.start(&data);
+    t1.start(&data);
+    increment_handler(&data);
+    t0.join();
+    t1.join();
+
+    assert(data.counter == 3 * N_INCREMENTS);
+    assert(!data.lock.is_acquired());
+}
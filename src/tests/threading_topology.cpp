@@ -0,0 +1,187 @@
+#include <atomic>
+#include <jolt/test.hpp>
+#include <jolt/memory/allocator.hpp>
+#include <jolt/threading/thread.hpp>
+#include <jolt/threading/threadpool.hpp>
+#include <jolt/threading/topology.hpp>
+
+using namespace jolt::collections;
+using namespace jolt::memory;
+using namespace jolt::threading;
+
+size_t mem_begin;
+
+constexpr int N_TASKS = 64;
+
+SETUP {
+    initialize();
+
+    mem_begin = get_allocated_size();
+}
+
+CpuSet make_set(std::initializer_list<unsigned> cpus) {
+    CpuSet set;
+
+    for(unsigned const cpu : cpus) { set.add(cpu); }
+
+    return set;
+}
+
+/**
+ * Two NUMA nodes of two SMT cores each, sharing an L3 cache per node, with SMT siblings numbered
+ * `n` and `n + 4`.
+ */
+CpuTopology make_topology(CpuSet const &cpus) {
+    return CpuTopology{
+      cpus,
+      Vector<CpuSet>{make_set({0, 4}), make_set({1, 5}), make_set({2, 6}), make_set({3, 7})},
+      Vector<CpuSet>{make_set({0, 1, 4, 5}), make_set({2, 3, 6, 7})},
+      Vector<CpuSet>{make_set({0, 1, 4, 5}), make_set({2, 3, 6, 7})}};
+}
+
+void count_task(void *param) { ++*reinterpret_cast<std::atomic<int> *>(param); }
+
+TEST(cpuset) {
+    CpuSet set;
+
+    assert(set.is_empty());
+    assert(set.get_first() == CpuSet::INVALID_CPU);
+
+    set.add(3);
+    set.add(64);
+    set.add(CpuSet::MAX_CPUS - 1);
+
+    assert(set.get_count() == 3);
+    assert(set.contains(64));
+    assert(!set.contains(4));
+    assert(set.get_first() == 3);
+    assert(set.get_next(4) == 64);
+    assert(set.get_next(65) == CpuSet::MAX_CPUS - 1);
+    assert(set.get_next(CpuSet::MAX_CPUS) == CpuSet::INVALID_CPU);
+    assert(set.to_mask() == 8);
+    assert(set.to_mask(1) == 1);
+
+    set.remove(CpuSet::MAX_CPUS - 1);
+
+    CpuSet expected = CpuSet::from_mask(8);
+
+    expected |= CpuSet::from_mask(1, 1);
+
+    assert(set == expected);
+
+    CpuSet other = CpuSet::from_mask(0xff);
+
+    assert(other.intersects(set));
+
+    other -= set;
+
+    assert(!other.intersects(set));
+    assert(other.get_count() == 7);
+
+    other &= CpuSet::from_mask(0xf0);
+
+    assert(other == CpuSet::from_mask(0xf0));
+}
+
+TEST(layout) {
+    CpuSet cpus = CpuSet::from_mask(0xff);
+
+    cpus.remove(7);
+
+    CpuTopology const topology = make_topology(cpus);
+
+    assert(topology.get_core_count() == 4);
+    assert(topology.get_cores()[3] == make_set({3}));
+    assert(topology.get_l3_domains().get_length() == 2);
+    assert(topology.get_l3_domains()[1] == make_set({2, 3, 6}));
+    assert(topology.get_numa_nodes().get_length() == 2);
+
+    // Missing layout information is filled in
+    CpuTopology const flat{cpus, Vector<CpuSet>{}, Vector<CpuSet>{}, Vector<CpuSet>{}};
+
+    assert(flat.get_core_count() == 7);
+    assert(flat.get_l3_domains().get_length() == 1);
+    assert(flat.get_l3_domains()[0] == cpus);
+    assert(flat.get_numa_nodes()[0] == cpus);
+}
+
+TEST(get_worker_cpus) {
+    CpuTopology const topology = make_topology(CpuSet::from_mask(0xff));
+
+    Vector<CpuSet> const per_core = topology.get_worker_cpus(topology.get_cpus());
+    Vector<CpuSet> const per_cpu = topology.get_worker_cpus(topology.get_cpus(), true);
+    Vector<CpuSet> const some = topology.get_worker_cpus(make_set({0, 1, 4}));
+
+    assert(per_core.get_length() == 4);
+    assert(per_core[1] == make_set({1, 5}));
+    assert(per_cpu.get_length() == 8);
+    assert(per_cpu[1] == make_set({4}));
+    assert(some.get_length() == 2);
+    assert(some[0] == make_set({0, 4}));
+    assert(some[1] == make_set({1}));
+}
+
+TEST(reserve_cores) {
+    CpuTopology const topology = make_topology(CpuSet::from_mask(0xff));
+    CpuSet cpus = topology.get_cpus();
+
+    CpuSet const render = topology.reserve_cores(cpus, 1);
+
+    assert(render == make_set({3, 7}));
+    assert(cpus == CpuSet::from_mask(0x77));
+
+    // Cores with a processor already taken are skipped
+    cpus.remove(2);
+
+    CpuSet const audio = topology.reserve_cores(cpus, 1);
+
+    assert(audio == make_set({1, 5}));
+    assert(cpus == make_set({0, 4, 6}));
+
+    // The last core is never reserved
+    assert(topology.reserve_cores(cpus, 1).is_empty());
+    assert(cpus == make_set({0, 4, 6}));
+}
+
+TEST(current_machine) {
+    CpuTopology const topology;
+    CpuSet cpus;
+    unsigned n_cpus = 0;
+
+    assert(!topology.get_cpus().is_empty());
+    assert(topology.get_core_count() > 0);
+    assert(topology.get_l3_domains().get_length() > 0);
+    assert(topology.get_numa_nodes().get_length() > 0);
+
+    // Cores partition the available processors
+    for(CpuSet const &core : topology.get_cores()) {
+        assert(!core.intersects(cpus));
+
+        cpus |= core;
+        n_cpus += core.get_count();
+    }
+
+    assert(cpus == topology.get_cpus());
+    assert(n_cpus == cpus.get_count());
+}
+
+TEST(pinned_pool) {
+    CpuTopology const topology;
+    std::atomic<int> n_done{0};
+
+    {
+        ThreadPool pool{topology.get_worker_cpus(topology.get_cpus())};
+
+        assert(pool.get_thread_count() == topology.get_core_count());
+
+        for(int i = 0; i < N_TASKS; ++i) { pool.submit(&count_task, &n_done); }
+
+        while(n_done.load() < N_TASKS) { pool.run_pending_task(); }
+    }
+
+    assert(n_done.load() == N_TASKS);
+}
+
+TEST(memory_leaks) { // Must be last test
+    assert(get_allocated_size() == mem_begin);
+}